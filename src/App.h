@@ -191,6 +191,11 @@ template <int num_channels> class mono_AudioSampleBuffer
 
     inline int get_size() const noexcept { return size; }
     inline void clear() noexcept { buffer.clear(); }
+    inline std::size_t get_memory_usage() const noexcept
+    {
+        return std::size_t(buffer.getNumChannels()) * std::size_t(buffer.getNumSamples()) *
+               sizeof(float);
+    }
 
     //==========================================================================
     COLD mono_AudioSampleBuffer(int numSamples) noexcept
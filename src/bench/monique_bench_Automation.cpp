@@ -0,0 +1,317 @@
+/*
+** Monique is Free and Open Source Software
+**
+** Monique is made available under the Gnu General Public License, v3.0
+** https://www.gnu.org/licenses/gpl-3.0.en.html; The authors of the code
+** reserve the right to re-license their contributions under the MIT license in the
+** future at the discretion of the project maintainers.
+**
+** Copyright 2016-2022 by various individuals as described by the git transaction log
+**
+** All source at: https://github.com/surge-synthesizer/monique-monosynth.git
+**
+** Monique was a commercial product from 2016-2021, with copyright and ownership
+** in that period held by Thomas Arndt at Monoplugs. Thomas made Monique
+** open source in December 2021.
+*/
+
+#include "monique_bench_Commands.h"
+#include "monique_bench_Host.h"
+
+#include "core/monique_core_Datastructures.h"
+#include "core/monique_core_Parameters.h"
+#include "core/monique_core_Processor.h"
+
+#include <cmath>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+struct AutomationCost
+{
+    std::int64_t calls = 0;
+    double seconds = 0;
+    double peak_seconds = 0;
+
+    void add(double seconds_) noexcept
+    {
+        ++calls;
+        seconds += seconds_;
+        peak_seconds = juce::jmax(peak_seconds, seconds_);
+    }
+    double get_mean_ns() const noexcept { return calls > 0 ? seconds / calls * 1e9 : 0; }
+};
+
+//==============================================================================
+// ONE SINE LANE PER AUTOMATABLE PARAMETER, EACH WITH ITS OWN SPEED AND PHASE
+class AutomationLanes
+{
+    juce::AudioProcessor &processor;
+    juce::Array<int> indices;
+    const double ticks_to_seconds;
+
+  public:
+    int size() const noexcept { return indices.size(); }
+
+    void apply(double time_in_seconds_, AutomationCost &cost_) noexcept
+    {
+        for (int lane = 0; lane != indices.size(); ++lane)
+        {
+            const double speed = 0.5 + (lane % 7) * 0.3;
+            const double phase = lane * 0.137;
+            const float value = float(
+                0.5 + 0.5 * std::sin(juce::MathConstants<double>::twoPi *
+                                     (time_in_seconds_ * speed + phase)));
+
+            const std::int64_t start_ticks = juce::Time::getHighResolutionTicks();
+            processor.setParameter(indices.getUnchecked(lane), value);
+            cost_.add((juce::Time::getHighResolutionTicks() - start_ticks) * ticks_to_seconds);
+        }
+    }
+
+    AutomationLanes(juce::AudioProcessor &processor_) noexcept
+        : processor(processor_),
+          ticks_to_seconds(1.0 / double(juce::Time::getHighResolutionTicksPerSecond()))
+    {
+        for (int i = 0; i != processor.getNumParameters(); ++i)
+        {
+            if (processor.isParameterAutomatable(i))
+            {
+                indices.add(i);
+            }
+        }
+    }
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(AutomationLanes)
+};
+
+//==============================================================================
+// AUDIO THREAD AUTOMATION. BETWEEN BLOCKS SETS ALL POINTS OF A BLOCK BEFORE ITS processBlock,
+// WITHIN BLOCKS SPLITS THE BLOCKS AT THE AUTOMATION POINTS AND SETS EACH POINT BEFORE ITS SLICE,
+// LIKE A HOST WITH SAMPLE ACCURATE AUTOMATION
+class AutomationListener : public MoniqueBenchHost::BlockListener
+{
+    AutomationLanes &lanes;
+    const double sample_rate;
+    const double seconds_per_block;
+    const double seconds_per_update;
+    const double samples_per_update;
+    const int updates_per_block;
+    const double ticks_to_seconds;
+    std::int64_t start_ticks;
+
+  public:
+    bool between_blocks;
+    bool within_blocks;
+    AutomationCost between_cost;
+    AutomationCost within_cost;
+    double peak_block_seconds; // INCLUDING THE AUTOMATION
+
+    void block_started(int block_id_) noexcept override
+    {
+        start_ticks = juce::Time::getHighResolutionTicks();
+        if (between_blocks)
+        {
+            for (int update = 0; update != updates_per_block; ++update)
+            {
+                lanes.apply(block_id_ * seconds_per_block + update * seconds_per_update,
+                            between_cost);
+            }
+        }
+    }
+    void block_finished(int) noexcept override
+    {
+        peak_block_seconds =
+            juce::jmax(peak_block_seconds,
+                       (juce::Time::getHighResolutionTicks() - start_ticks) * ticks_to_seconds);
+    }
+
+    // THE SLICE ENDS AT THE NEXT AUTOMATION POINT
+    int get_slice_size(std::int64_t sample_, int max_samples_) noexcept override
+    {
+        if (!within_blocks)
+        {
+            return max_samples_;
+        }
+        const double next_update = std::floor(sample_ / samples_per_update) + 1;
+        const std::int64_t next_sample = std::int64_t(std::ceil(next_update * samples_per_update));
+        return int(
+            juce::jlimit(std::int64_t(1), std::int64_t(max_samples_), next_sample - sample_));
+    }
+    void slice_started(std::int64_t sample_) noexcept override
+    {
+        if (within_blocks)
+        {
+            lanes.apply(sample_ / sample_rate, within_cost);
+        }
+    }
+
+    void reset() noexcept
+    {
+        between_cost = AutomationCost();
+        within_cost = AutomationCost();
+        peak_block_seconds = 0;
+    }
+
+    AutomationListener(AutomationLanes &lanes_, double sample_rate_, int block_size_,
+                       double update_rate_) noexcept
+        : lanes(lanes_), sample_rate(sample_rate_), seconds_per_block(block_size_ / sample_rate_),
+          seconds_per_update(1.0 / update_rate_), samples_per_update(sample_rate_ / update_rate_),
+          updates_per_block(juce::jmax(1, juce::roundToInt(seconds_per_block * update_rate_))),
+          ticks_to_seconds(1.0 / double(juce::Time::getHighResolutionTicksPerSecond())),
+          start_ticks(0), between_blocks(false), within_blocks(false), between_cost(),
+          within_cost(), peak_block_seconds(0)
+    {
+    }
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(AutomationListener)
+};
+
+//==============================================================================
+// THE MIDI LEARN OF THE USER ON ONE CONTROL, BEFORE --feedback TRAINED IT
+struct MidiLearnBackup
+{
+    MIDIControl *midi_control;
+    int midi_number;
+    juce::String is_ctrl_version_of_name;
+};
+
+// TRAINS A CC ON EVERY PARAMETER, SO EACH CHANGE ALSO SENDS MIDI FEEDBACK
+static juce::Array<MidiLearnBackup>
+train_midi_feedback(MoniqueAudioProcessor &processor_) noexcept
+{
+    juce::Array<MidiLearnBackup> trained;
+    const juce::Array<Parameter *> &parameters =
+        processor_.synth_data->get_atomateable_parameters();
+    for (int i = 0; i != parameters.size(); ++i)
+    {
+        if (Parameter *const param = parameters.getUnchecked(i))
+        {
+            MIDIControl *const midi_control = param->midi_control;
+            const MidiLearnBackup backup{midi_control, midi_control->get_midi_number(),
+                                         midi_control->get_is_ctrl_version_of_name()};
+            if (backup.midi_number != -1)
+            {
+                midi_control->clear();
+            }
+            if (midi_control->train(i % 128, static_cast<Parameter *>(nullptr), &processor_))
+            {
+                trained.add(backup);
+            }
+            else if (backup.midi_number != -1)
+            {
+                midi_control->train(backup.midi_number, backup.is_ctrl_version_of_name,
+                                    &processor_);
+            }
+        }
+    }
+    return trained;
+}
+// PUTS THE MIDI LEARN OF THE USER BACK
+static void restore_midi_learn(const juce::Array<MidiLearnBackup> &trained_,
+                               MoniqueAudioProcessor &processor_) noexcept
+{
+    for (const MidiLearnBackup &backup : trained_)
+    {
+        backup.midi_control->clear();
+        if (backup.midi_number != -1)
+        {
+            backup.midi_control->train(backup.midi_number, backup.is_ctrl_version_of_name,
+                                       &processor_);
+        }
+    }
+}
+
+//==============================================================================
+void run_bench_automation(const juce::ArgumentList &args_)
+{
+    const double seconds = get_bench_option(args_, "--seconds", 5.0);
+    const double sample_rate = get_bench_option(args_, "--rate", 48000.0);
+    const int block_size = int(get_bench_option(args_, "--block", 256.0));
+    const juce::String filter = get_bench_option(args_, "--programs", juce::String());
+    const double update_rate =
+        juce::jlimit(1.0, 1000.0, get_bench_option(args_, "--rate-hz", 1000.0));
+    const juce::String mode = get_bench_option(args_, "--mode", juce::String("both"));
+    const bool between_blocks = mode == "both" || mode == "between";
+    const bool within_blocks = mode == "both" || mode == "within";
+    if (!between_blocks && !within_blocks)
+    {
+        juce::ConsoleApplication::fail("unknown --mode " + mode + ", use between, within or both");
+    }
+
+    MoniqueBenchHost host(sample_rate, block_size);
+    const MoniqueBenchMidiScript script = MoniqueBenchMidiScript::create_default();
+    AutomationLanes lanes(host.get_audio_processor());
+    AutomationListener automation(lanes, sample_rate, block_size, update_rate);
+    host.set_block_listener(&automation);
+
+    juce::Array<MidiLearnBackup> trained;
+    if (args_.containsOption("--feedback"))
+    {
+        trained = train_midi_feedback(host.get_processor());
+    }
+
+    std::cout << "monique-bench automation: " << seconds << "s @ " << sample_rate << "Hz, block "
+              << block_size << ", " << lanes.size() << " lanes at " << update_rate << "Hz, "
+              << mode << ", " << trained.size() << " feedback CCs" << std::endl;
+    std::cout << std::left << std::setw(32) << "PROGRAM" << std::right << std::setw(9) << "RTF"
+              << std::setw(9) << "RTF auto" << std::setw(10) << "peak us" << std::setw(11)
+              << "peak auto" << std::setw(12) << "peak +hook" << std::setw(11) << "hook ns"
+              << std::setw(13) << "hook max ns" << std::setw(11) << "slice ns" << std::setw(12)
+              << "slice set" << std::endl;
+
+    auto load = [&](const juce::String &name_, const std::function<bool()> &load_) {
+        if (!load_())
+        {
+            host.set_block_listener(nullptr);
+            restore_midi_learn(trained, host.get_processor());
+            juce::ConsoleApplication::fail("can not load " + name_);
+        }
+    };
+    auto run = [&](const juce::String &name_, const std::function<bool()> &load_) {
+        load(name_, load_);
+        automation.between_blocks = false;
+        automation.within_blocks = false;
+        automation.reset();
+        const MoniqueBenchHost::RenderStats plain = host.render(name_, seconds, script);
+        host.flush(1);
+
+        load(name_, load_);
+        automation.between_blocks = between_blocks;
+        automation.within_blocks = within_blocks;
+        automation.reset();
+        const MoniqueBenchHost::RenderStats automated = host.render(name_, seconds, script);
+        automation.between_blocks = false;
+        automation.within_blocks = false;
+        host.flush(1);
+
+        std::cout << std::left << std::setw(32) << name_.substring(0, 31) << std::right
+                  << std::fixed << std::setprecision(4) << std::setw(9)
+                  << plain.get_realtime_factor() << std::setw(9)
+                  << automated.get_realtime_factor() << std::setprecision(1) << std::setw(10)
+                  << plain.get_peak_block_us() << std::setw(11) << automated.get_peak_block_us()
+                  << std::setw(12) << automation.peak_block_seconds * 1e6 << std::setw(11)
+                  << automation.between_cost.get_mean_ns() << std::setw(13)
+                  << automation.between_cost.peak_seconds * 1e9 << std::setw(11)
+                  << automation.within_cost.get_mean_ns() << std::setw(12)
+                  << automation.within_cost.calls << std::endl;
+    };
+
+    if (filter.isEmpty())
+    {
+        run("FACTORY DEFAULT", [&] {
+            host.load_default();
+            return true;
+        });
+    }
+    for (const MoniqueBenchHost::Program &program : host.collect_programs(filter))
+    {
+        run(program.get_full_name(), [&] { return host.load(program); });
+    }
+
+    host.set_block_listener(nullptr);
+    restore_midi_learn(trained, host.get_processor());
+}
@@ -0,0 +1,56 @@
+/*
+** Monique is Free and Open Source Software
+**
+** Monique is made available under the Gnu General Public License, v3.0
+** https://www.gnu.org/licenses/gpl-3.0.en.html; The authors of the code
+** reserve the right to re-license their contributions under the MIT license in the
+** future at the discretion of the project maintainers.
+**
+** Copyright 2016-2022 by various individuals as described by the git transaction log
+**
+** All source at: https://github.com/surge-synthesizer/monique-monosynth.git
+**
+** Monique was a commercial product from 2016-2021, with copyright and ownership
+** in that period held by Thomas Arndt at Monoplugs. Thomas made Monique
+** open source in December 2021.
+*/
+
+#ifndef MONIQUE_BENCH_COMMANDS_H_INCLUDED
+#define MONIQUE_BENCH_COMMANDS_H_INCLUDED
+
+#include "App.h"
+
+//==============================================================================
+// OPTION HELPERS, ACCEPT "--name=value" AND "--name value"
+static inline double get_bench_option(const juce::ArgumentList &args_, const juce::String &option_,
+                                      double default_) noexcept
+{
+    if (!args_.containsOption(option_))
+    {
+        return default_;
+    }
+    return args_.getValueForOption(option_).getDoubleValue();
+}
+static inline juce::String get_bench_option(const juce::ArgumentList &args_,
+                                            const juce::String &option_,
+                                            const juce::String &default_) noexcept
+{
+    if (!args_.containsOption(option_))
+    {
+        return default_;
+    }
+    return args_.getValueForOption(option_);
+}
+
+//==============================================================================
+// ONE FUNCTION PER BENCH MODE
+void run_bench_render(const juce::ArgumentList &args_);
+void run_bench_golden(const juce::ArgumentList &args_);
+void run_bench_dsp(const juce::ArgumentList &args_);
+void run_bench_rtcheck(const juce::ArgumentList &args_);
+void run_bench_sweep(const juce::ArgumentList &args_);
+void run_bench_automation(const juce::ArgumentList &args_);
+void run_bench_load(const juce::ArgumentList &args_);
+void run_bench_memory(const juce::ArgumentList &args_);
+
+#endif // MONIQUE_BENCH_COMMANDS_H_INCLUDED
@@ -0,0 +1,623 @@
+/*
+** Monique is Free and Open Source Software
+**
+** Monique is made available under the Gnu General Public License, v3.0
+** https://www.gnu.org/licenses/gpl-3.0.en.html; The authors of the code
+** reserve the right to re-license their contributions under the MIT license in the
+** future at the discretion of the project maintainers.
+**
+** Copyright 2016-2022 by various individuals as described by the git transaction log
+**
+** All source at: https://github.com/surge-synthesizer/monique-monosynth.git
+**
+** Monique was a commercial product from 2016-2021, with copyright and ownership
+** in that period held by Thomas Arndt at Monoplugs. Thomas made Monique
+** open source in December 2021.
+*/
+
+#include "monique_bench_Commands.h"
+#include "monique_bench_Host.h"
+
+#include "core/monique_core_Synth_dsp.h"
+
+#include <functional>
+#include <iomanip>
+#include <iostream>
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+// KEEPS THE COMPILER FROM DROPPING RESULTS THAT ARE NEVER READ
+static volatile float dsp_bench_sink = 0;
+
+struct DspBenchmark
+{
+    juce::String name;
+    std::function<void(int num_samples_)> process;
+};
+
+//==============================================================================
+// AnalogFilter::processLowResonance AS IT WAS BEFORE THE BLOCK WIDE FLUSH TO ZERO, THE BEFORE OF
+// THE DECAYING TAIL BENCHMARKS. THE INPUT AND THE STATES SNAP TO 0 BELOW 1e-8 AND THE FILTER
+// STOPS AFTER 50 SILENT SAMPLES
+#define LEGACY_UNDENORMALISE(n)                                                                    \
+    if (!(n < -1.0e-8f || n > 1.0e-8f))                                                            \
+        n = 0;
+class LegacyAnalogFilter
+{
+    float p, k, r, res;
+    float y1, y2, y3, y4;
+    float oldx;
+    float oldy1, oldy2, oldy3;
+    int zero_counter;
+
+  public:
+    //==========================================================================
+    inline float processLowResonance(float input_and_worker_) noexcept
+    {
+        LEGACY_UNDENORMALISE(input_and_worker_);
+        if (input_and_worker_ != 0)
+        {
+            zero_counter = 0;
+        }
+        else if (y4 == 0)
+        {
+            ++zero_counter;
+        }
+        else
+        {
+            zero_counter = 0;
+        }
+
+        if (zero_counter < 50)
+        {
+            // process input
+            input_and_worker_ -= r * y4;
+            LEGACY_UNDENORMALISE(y1);
+
+            // Four cascaded onepole filters (bilinear transform)
+            y1 = input_and_worker_ * p + oldx * p - k * y1;
+            y2 = y1 * p + oldy1 * p - k * y2;
+            y3 = y2 * p + oldy2 * p - k * y3;
+            y4 = y3 * p + oldy3 * p - k * y4;
+
+            // Clipper band limited sigmoid
+            y4 -= (y4 * y4 * y4) / 6;
+            LEGACY_UNDENORMALISE(y4);
+
+            oldx = input_and_worker_;
+            oldy1 = y1;
+            oldy2 = y2;
+            oldy3 = y3;
+
+            input_and_worker_ = soft_clipp_greater_1_2(sample_mix(y4, y3 * res));
+            LEGACY_UNDENORMALISE(input_and_worker_);
+        }
+
+        return input_and_worker_;
+    }
+
+    // AnalogFilter::update AND calc_coefficients WITHOUT OVERSAMPLING
+    inline void set_coefficients(float resonance_, float cutoff_, double sample_rate_) noexcept
+    {
+        res = juce::jmax(0.00001f, float(resonance_ * 0.99999));
+        const float f = float(cutoff_ / sample_rate_);
+        p = f * (1.8f - 0.8f * f);
+        k = p * 2 - 1;
+        const float t = (1.0f - p) * 1.386249f;
+        const float t2 = 12.0f + t * t;
+        r = res * (t2 + 6.0f * t) / (t2 - 6.0f * t);
+    }
+
+    //==========================================================================
+    LegacyAnalogFilter() noexcept
+        : p(0), k(0), r(0), res(0), y1(0), y2(0), y3(0), y4(0), oldx(0), oldy1(0), oldy2(0),
+          oldy3(0), zero_counter(0)
+    {
+    }
+};
+
+// INPUTS AND OUTPUTS SHARED BY ALL BENCHMARKS, SIZED FOR THE BIGGEST BLOCK
+struct DspBenchBuffers
+{
+    juce::AudioSampleBuffer noise;
+    juce::AudioSampleBuffer sine;
+    juce::AudioSampleBuffer out;
+    juce::AudioSampleBuffer power;
+    juce::AudioSampleBuffer pan;
+    juce::AudioSampleBuffer release;
+    juce::AudioSampleBuffer cutoff;
+    juce::AudioSampleBuffer resonance;
+
+    DspBenchBuffers(int max_block_size_, double sample_rate_) noexcept
+        : noise(2, max_block_size_), sine(2, max_block_size_), out(3, max_block_size_),
+          power(1, max_block_size_), pan(1, max_block_size_), release(1, max_block_size_),
+          cutoff(1, max_block_size_), resonance(1, max_block_size_)
+    {
+        // NOISE GOES UP TO +-1.5 TO HIT EVERY BRANCH OF THE CLIPPERS
+        juce::Random random(1);
+        for (int channel = 0; channel != 2; ++channel)
+        {
+            for (int sid = 0; sid != max_block_size_; ++sid)
+            {
+                noise.setSample(channel, sid, (random.nextFloat() * 2 - 1) * 1.5f);
+                sine.setSample(channel, sid,
+                               float(std::sin(sid * juce::MathConstants<double>::twoPi * 220 /
+                                              sample_rate_)));
+            }
+        }
+        for (int sid = 0; sid != max_block_size_; ++sid)
+        {
+            power.setSample(0, sid, 0.6f);
+            pan.setSample(0, sid, 0.2f);
+            release.setSample(0, sid, 0.99f);
+            // A CUTOFF SLIDER SWEEP OVER THE BLOCK, SO THE COEFFICIENTS CHANGE EVERY SAMPLE
+            cutoff.setSample(0, sid, 0.2f + 0.6f * sid / max_block_size_);
+            resonance.setSample(0, sid, 0.4f);
+        }
+        out.clear();
+    }
+};
+
+//==============================================================================
+// GROWS THE ITERATIONS UNTIL ONE RUN TAKES AT LEAST min_seconds_, RETURNS SECONDS PER CALL
+static double time_benchmark(const DspBenchmark &benchmark_, int num_samples_,
+                             double min_seconds_) noexcept
+{
+    const double ticks_to_seconds =
+        1.0 / double(juce::Time::getHighResolutionTicksPerSecond());
+
+    // WARM UP CACHES AND BRANCH PREDICTORS
+    for (int i = 0; i != 16; ++i)
+    {
+        benchmark_.process(num_samples_);
+    }
+
+    for (std::int64_t iterations = 16;; iterations *= 2)
+    {
+        const std::int64_t start_ticks = juce::Time::getHighResolutionTicks();
+        for (std::int64_t i = 0; i != iterations; ++i)
+        {
+            benchmark_.process(num_samples_);
+        }
+        const double seconds =
+            (juce::Time::getHighResolutionTicks() - start_ticks) * ticks_to_seconds;
+        if (seconds >= min_seconds_ || iterations >= (std::int64_t(1) << 40))
+        {
+            return seconds / iterations;
+        }
+    }
+}
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+void run_bench_dsp(const juce::ArgumentList &args_)
+{
+    const double sample_rate = get_bench_option(args_, "--rate", 48000.0);
+    const double min_seconds = get_bench_option(args_, "--min-time", 0.2);
+    const juce::String filter = get_bench_option(args_, "--filter", juce::String());
+    const juce::String blocks = get_bench_option(args_, "--blocks", juce::String("64,256,1024"));
+    juce::Array<int> block_sizes;
+    for (const juce::String &size : juce::StringArray::fromTokens(blocks, ",", ""))
+    {
+        if (size.getIntValue() > 0)
+        {
+            block_sizes.addIfNotAlreadyThere(size.getIntValue());
+        }
+    }
+    if (block_sizes.isEmpty())
+    {
+        juce::ConsoleApplication::fail("--blocks needs at least one size > 0");
+    }
+    block_sizes.sort();
+    const int max_block_size = block_sizes.getLast();
+
+    // THE CHORUS AND DELAY NEED THE SYNTH DATA, THE SMOOTHED BUFFERS ARE FILLED BY A SHORT RENDER
+    MoniqueBenchHost host(sample_rate, max_block_size);
+    host.load_default();
+    host.render("WARM UP", 0.5, MoniqueBenchMidiScript::create_default());
+
+    MoniqueSynthData *const synth_data = host.get_processor().synth_data;
+    RuntimeNotifyer *const notifyer = synth_data->runtime_notifyer;
+
+    DspBenchBuffers buffers(max_block_size, sample_rate);
+    const float *const noise = buffers.noise.getReadPointer(0);
+    const float *const noise_2 = buffers.noise.getReadPointer(1);
+    const float *const sine = buffers.sine.getReadPointer(0);
+    float *const out = buffers.out.getWritePointer(0);
+    float *const out_2 = buffers.out.getWritePointer(1);
+
+    //==========================================================================
+    // OSCILLATORS
+    PerfectCycleCounter cycle_counter(notifyer);
+    cycle_counter.set_frequency(220);
+    mono_BlitSaw saw;
+    saw.updateHarmonics(cycle_counter.get_cylces_per_sec());
+    mono_BlitSquare square;
+    square.updateHarmonics(cycle_counter.get_cylces_per_sec());
+    mono_PolyBlepSaw blep_saw;
+    blep_saw.updateHarmonics(cycle_counter.get_cylces_per_sec());
+    mono_PolyBlepSquare blep_square;
+    blep_square.updateHarmonics(cycle_counter.get_cylces_per_sec());
+    mono_SineWaveAutonom sine_autonom(notifyer, synth_data->sine_lookup);
+    sine_autonom.set_frequency(220);
+    // AN OCTAVE GLIDE OVER EACH BLOCK, PER SAMPLE FROM THE TUNING OR AS A FACTOR ON THE TARGET
+    MoniqueTuningData *const tuning = synth_data->tuning;
+    ExponentialGlide glide;
+
+    // FILTERS, 1 KHZ WITH SOME RESONANCE, COEFFICIENTS ONCE PER BLOCK LIKE THE FILTER PROCESSOR
+    AnalogFilter analog_filter(notifyer);
+    DoubleAnalogFilter double_filter(notifyer);
+    const float cutoff = 1000;
+    const float resonance = 0.4f;
+    // A FILTER RINGING OUT: AN IMPULSE EVERY TAIL_PERIOD SAMPLES, IN BETWEEN THE STATES DECAY FROM
+    // FULL LEVEL DOWN THROUGH THE DENORMAL RANGE. THE FILTERS BEFORE AND AFTER THE BLOCK WIDE
+    // FLUSH TO ZERO GET THE SAME INPUT
+    enum
+    {
+        TAIL_PERIOD = 1 << 14
+    };
+    AnalogFilter tail_filter(notifyer);
+    AnalogFilter ftz_tail_filter(notifyer);
+    LegacyAnalogFilter legacy_tail_filter;
+    legacy_tail_filter.set_coefficients(resonance, cutoff, sample_rate);
+    int tail_sid = 0;
+    int ftz_tail_sid = 0;
+    int legacy_tail_sid = 0;
+    auto process_decaying_tail = [&](auto &filter_, int &tail_sid_, int num_samples_) {
+        for (int sid = 0; sid != num_samples_; ++sid)
+        {
+            out[sid] = filter_.processLowResonance(tail_sid_ == 0 ? 1.0f : 0.0f);
+            tail_sid_ = (tail_sid_ + 1) % TAIL_PERIOD;
+        }
+    };
+    // LIKE THE FILTER PROCESSOR WITH A MODULATED CUTOFF
+    const float *const cutoffs = buffers.cutoff.getReadPointer(0);
+    const float *const resonances = buffers.resonance.getReadPointer(0);
+    auto process_modulated_low_2_pass = [&](DoubleAnalogFilter &filter_, const float *in_,
+                                            float *out_, int num_samples_,
+                                            int coefficient_rate_) {
+        filter_.update_filter_to(LPF_2_PASS);
+        for (int first_sid = 0; first_sid < num_samples_; first_sid += coefficient_rate_)
+        {
+            const int end_sid = juce::jmin(first_sid + coefficient_rate_, num_samples_);
+            filter_.glideLow2Pass(resonances[end_sid - 1], cutoffs[end_sid - 1],
+                                  end_sid - first_sid);
+            for (int sid = first_sid; sid != end_sid; ++sid)
+            {
+                filter_.step_coefficients();
+                out_[sid] = filter_.processLow2Pass(in_[sid]);
+            }
+        }
+    };
+    // THE THREE INPUTS OF FILTER 1 OR 2, ONE AFTER ANOTHER OR IN SIMD LANES
+    juce::OwnedArray<DoubleAnalogFilter> input_filters;
+    for (int input_id = 0; input_id != SUM_INPUTS_PER_FILTER; ++input_id)
+    {
+        input_filters.add(new DoubleAnalogFilter(notifyer));
+    }
+    const float *const filter_ins[SUM_INPUTS_PER_FILTER] = {sine, buffers.sine.getReadPointer(1),
+                                                            noise};
+    float *const filter_outs[SUM_INPUTS_PER_FILTER] = {out, out_2, buffers.out.getWritePointer(2)};
+#if JUCE_USE_SIMD
+    DoubleAnalogFilterLanes lanes;
+    // THE HALF BANDS AROUND THE THREE INPUTS OF ONE FILTER
+    FilterOversampler oversampler;
+    oversampler.set_mode(4, false);
+    juce::AudioSampleBuffer oversampled(SUM_INPUTS_PER_FILTER * 2,
+                                        max_block_size * MAX_FILTER_OVERSAMPLING);
+    float *const oversampled_ins[SUM_INPUTS_PER_FILTER] = {
+        oversampled.getWritePointer(0), oversampled.getWritePointer(1),
+        oversampled.getWritePointer(2)};
+    float *const oversampled_tmps[SUM_INPUTS_PER_FILTER] = {
+        oversampled.getWritePointer(3), oversampled.getWritePointer(4),
+        oversampled.getWritePointer(5)};
+#endif
+
+    // FX
+    mono_Chorus chorus(notifyer, synth_data);
+    mono_Delay delay(notifyer, synth_data);
+    CombFilter comb;
+    comb.setSize(int(sample_rate * 1116 / 44100));
+    AllPassFilter all_pass;
+    all_pass.setSize(int(sample_rate * 556 / 44100));
+    mono_Reverb reverb(notifyer, LEFT);
+    {
+        ReverbParameters &parameters = reverb.get_parameters();
+        parameters.roomSize = 0.7f;
+        parameters.dryLevel = 0.5f;
+        parameters.wetLevel = 0.5f;
+        parameters.width = 1;
+        reverb.update_parameters();
+    }
+    // THE SAME PARAMETERS FOR EVERY SAMPLE OF mono_Reverb::process_block
+    DataBuffer data_buffer(max_block_size);
+    mono_ArenaBuffer<SUM_REVERB_BUFFERS> &reverb_buffers = data_buffer.reverb_buffers;
+    {
+        juce::AudioSampleBuffer parameters(3, max_block_size);
+        for (int sid = 0; sid != max_block_size; ++sid)
+        {
+            parameters.setSample(0, sid, 0.7f); // ROOM
+            parameters.setSample(1, sid, 0.5f); // DRY WET MIX
+            parameters.setSample(2, sid, 1);    // WIDTH
+        }
+        mono_Reverb::calc_block_parameters(parameters.getReadPointer(0),
+                                           parameters.getReadPointer(1),
+                                           parameters.getReadPointer(2), reverb_buffers,
+                                           max_block_size);
+    }
+
+    //==========================================================================
+    const DspBenchmark benchmarks[] = {
+        {"sample_mix",
+         [&](int num_samples_) {
+             for (int sid = 0; sid != num_samples_; ++sid)
+             {
+                 out[sid] = sample_mix(noise[sid], noise_2[sid]);
+             }
+         }},
+        {"sample_mix_block x3",
+         [&](int num_samples_) {
+             const float *const inputs[] = {noise, noise_2, sine};
+             sample_mix_block(out, inputs, 3, num_samples_);
+         }},
+        {"pan_block moving",
+         [&](int num_samples_) { pan_block(sine, out, out_2, num_samples_); }},
+        {"pan_block settled",
+         [&](int num_samples_) {
+             pan_block(buffers.pan.getReadPointer(0), out, out_2, num_samples_);
+         }},
+        {"soft_clipping",
+         [&](int num_samples_) {
+             for (int sid = 0; sid != num_samples_; ++sid)
+             {
+                 out[sid] = soft_clipping(noise[sid]);
+             }
+         }},
+        {"soft_clipp_greater_1_2",
+         [&](int num_samples_) {
+             for (int sid = 0; sid != num_samples_; ++sid)
+             {
+                 out[sid] = soft_clipp_greater_1_2(noise[sid]);
+             }
+         }},
+        {"soft_clipp_greater_0_9",
+         [&](int num_samples_) {
+             for (int sid = 0; sid != num_samples_; ++sid)
+             {
+                 out[sid] = soft_clipp_greater_0_9(noise[sid]);
+             }
+         }},
+        {"soft_clipp_greater_1_2_block precise",
+         [&](int num_samples_) {
+             soft_clipp_greater_1_2_block(noise, out, num_samples_, ATAN_PRECISE);
+         }},
+        {"soft_clipp_greater_1_2_block fast",
+         [&](int num_samples_) {
+             soft_clipp_greater_1_2_block(noise, out, num_samples_, ATAN_FAST);
+         }},
+        {"soft_clipp_greater_0_9_block precise",
+         [&](int num_samples_) {
+             soft_clipp_greater_0_9_block(noise, out, num_samples_, ATAN_PRECISE);
+         }},
+        {"filter_distortion_block exact",
+         [&](int num_samples_) {
+             filter_distortion_block(noise, buffers.power.getReadPointer(0), out, num_samples_,
+                                     ATAN_EXACT);
+         }},
+        {"filter_distortion_block precise",
+         [&](int num_samples_) {
+             filter_distortion_block(noise, buffers.power.getReadPointer(0), out, num_samples_,
+                                     ATAN_PRECISE);
+         }},
+        {"mono_BlitSaw::tick",
+         [&](int num_samples_) {
+             for (int sid = 0; sid != num_samples_; ++sid)
+             {
+                 cycle_counter.tick();
+                 out[sid] = saw.tick(cycle_counter.get_last_phase());
+             }
+         }},
+        {"mono_BlitSquare::tick",
+         [&](int num_samples_) {
+             for (int sid = 0; sid != num_samples_; ++sid)
+             {
+                 cycle_counter.tick();
+                 out[sid] = square.tick(cycle_counter.get_last_angle());
+             }
+         }},
+        {"mono_PolyBlepSaw::tick",
+         [&](int num_samples_) {
+             for (int sid = 0; sid != num_samples_; ++sid)
+             {
+                 cycle_counter.tick();
+                 out[sid] = blep_saw.tick(cycle_counter.get_last_phase());
+             }
+         }},
+        {"mono_PolyBlepSquare::tick",
+         [&](int num_samples_) {
+             for (int sid = 0; sid != num_samples_; ++sid)
+             {
+                 cycle_counter.tick();
+                 out[sid] = blep_square.tick(cycle_counter.get_last_angle());
+             }
+         }},
+        {"mono_SineWaveAutonom::tick",
+         [&](int num_samples_) {
+             for (int sid = 0; sid != num_samples_; ++sid)
+             {
+                 out[sid] = sine_autonom.tick();
+             }
+         }},
+        {"glide midiNoteToFrequency",
+         [&](int num_samples_) {
+             const float delta = 12.0f / num_samples_;
+             for (int sid = 0; sid != num_samples_; ++sid)
+             {
+                 out[sid] = tuning->midiNoteToFrequency(60 - delta * sid);
+             }
+         }},
+        {"glide ExponentialGlide",
+         [&](int num_samples_) {
+             const float target = tuning->get_frequency(48);
+             glide.start(2, num_samples_);
+             for (int sid = 0; sid != num_samples_; ++sid)
+             {
+                 glide.tick();
+                 out[sid] = target * glide.get_factor();
+             }
+         }},
+        {"AnalogFilter::processLow",
+         [&](int num_samples_) {
+             if (analog_filter.update(resonance, cutoff))
+             {
+                 analog_filter.calc_coefficients(cutoff);
+             }
+             for (int sid = 0; sid != num_samples_; ++sid)
+             {
+                 out[sid] = analog_filter.processLow(sine[sid]);
+             }
+         }},
+        {"AnalogFilter::processLowResonance",
+         [&](int num_samples_) {
+             if (analog_filter.update(resonance, cutoff))
+             {
+                 analog_filter.calc_coefficients(cutoff);
+             }
+             for (int sid = 0; sid != num_samples_; ++sid)
+             {
+                 out[sid] = analog_filter.processLowResonance(sine[sid]);
+             }
+         }},
+        {"AnalogFilter decaying tail before, snapping and zero_counter",
+         [&](int num_samples_) {
+             process_decaying_tail(legacy_tail_filter, legacy_tail_sid, num_samples_);
+         }},
+        {"AnalogFilter decaying tail denormals",
+         [&](int num_samples_) {
+             if (tail_filter.update(resonance, cutoff))
+             {
+                 tail_filter.calc_coefficients(cutoff);
+             }
+             process_decaying_tail(tail_filter, tail_sid, num_samples_);
+         }},
+        {"AnalogFilter decaying tail flush to zero",
+         [&](int num_samples_) {
+             const juce::ScopedNoDenormals no_denormals;
+             if (ftz_tail_filter.update(resonance, cutoff))
+             {
+                 ftz_tail_filter.calc_coefficients(cutoff);
+             }
+             process_decaying_tail(ftz_tail_filter, ftz_tail_sid, num_samples_);
+         }},
+        {"DoubleAnalogFilter::processLow2Pass",
+         [&](int num_samples_) {
+             double_filter.update_filter_to(LPF);
+             double_filter.updateLow2Pass(resonance, cutoff);
+             for (int sid = 0; sid != num_samples_; ++sid)
+             {
+                 out[sid] = double_filter.processLow2Pass(sine[sid]);
+             }
+         }},
+        {"DoubleAnalogFilter modulated exact",
+         [&](int num_samples_) {
+             process_modulated_low_2_pass(double_filter, sine, out, num_samples_, 1);
+         }},
+        {"DoubleAnalogFilter modulated rate 8",
+         [&](int num_samples_) {
+             process_modulated_low_2_pass(double_filter, sine, out, num_samples_, 8);
+         }},
+        {"DoubleAnalogFilter 3 inputs rate 8",
+         [&](int num_samples_) {
+             for (int input_id = 0; input_id != SUM_INPUTS_PER_FILTER; ++input_id)
+             {
+                 process_modulated_low_2_pass(*input_filters.getUnchecked(input_id),
+                                              filter_ins[input_id], filter_outs[input_id],
+                                              num_samples_, 8);
+             }
+         }},
+#if JUCE_USE_SIMD
+        {"DoubleAnalogFilterLanes 3 inputs rate 8",
+         [&](int num_samples_) {
+             lanes.load(input_filters.getRawDataPointer(), SUM_INPUTS_PER_FILTER);
+             lanes.process<ATAN_PRECISE>(LPF_2_PASS, resonances, cutoffs, 8, filter_ins,
+                                         filter_outs, num_samples_);
+             lanes.store();
+         }},
+        {"FilterOversampler 3 inputs 4x up and down",
+         [&](int num_samples_) {
+             oversampler.upsample(filter_ins, oversampled_ins, oversampled_tmps,
+                                  SUM_INPUTS_PER_FILTER, num_samples_);
+             oversampler.downsample(oversampled_ins, filter_outs, oversampled_tmps,
+                                    SUM_INPUTS_PER_FILTER, num_samples_);
+         }},
+#endif
+        {"CombFilter::process",
+         [&](int num_samples_) {
+             for (int sid = 0; sid != num_samples_; ++sid)
+             {
+                 out[sid] = comb.process(sine[sid], 0.84f);
+             }
+         }},
+        {"AllPassFilter::process",
+         [&](int num_samples_) {
+             for (int sid = 0; sid != num_samples_; ++sid)
+             {
+                 out[sid] = all_pass.process(sine[sid]);
+             }
+         }},
+        {"mono_Reverb::processSingleSampleRaw",
+         [&](int num_samples_) {
+             for (int sid = 0; sid != num_samples_; ++sid)
+             {
+                 out[sid] = reverb.processSingleSampleRaw(sine[sid]);
+             }
+         }},
+        {"mono_Reverb::process_block",
+         [&](int num_samples_) {
+             reverb.process_block(sine, out, reverb_buffers, num_samples_);
+         }},
+        {"mono_Chorus::process",
+         [&](int num_samples_) {
+             chorus.process(buffers.sine.getWritePointer(0), buffers.sine.getWritePointer(1), out,
+                            out_2, num_samples_);
+         }},
+        {"mono_Delay::process",
+         [&](int num_samples_) {
+             // THE DELAY WORKS IN PLACE, SO IT GETS A FRESH COPY OF THE INPUT EVERY BLOCK
+             buffers.out.copyFrom(0, 0, buffers.sine, 0, 0, num_samples_);
+             buffers.out.copyFrom(1, 0, buffers.sine, 1, 0, num_samples_);
+             delay.set_reflexion_size(8, 0, 50, 120);
+             delay.process(out, out_2, buffers.power.getReadPointer(0),
+                           buffers.pan.getReadPointer(0), buffers.release.getReadPointer(0),
+                           false, num_samples_);
+         }},
+    };
+
+    std::cout << "monique-bench dsp: " << sample_rate << "Hz, " << min_seconds
+              << "s per measurement, " << (synth_data->is_stereo ? "stereo" : "mono") << std::endl;
+    std::cout << std::left << std::setw(40) << "BENCHMARK" << std::right << std::setw(8)
+              << "block" << std::setw(12) << "ns/sample" << std::setw(14) << "ns/block"
+              << std::setw(12) << "Msamples/s" << std::endl;
+
+    for (const DspBenchmark &benchmark : benchmarks)
+    {
+        if (filter.isNotEmpty() && !benchmark.name.containsIgnoreCase(filter))
+        {
+            continue;
+        }
+
+        for (const int block_size : block_sizes)
+        {
+            const double seconds = time_benchmark(benchmark, block_size, min_seconds);
+            dsp_bench_sink = out[block_size - 1];
+
+            std::cout << std::left << std::setw(40) << benchmark.name << std::right
+                      << std::setw(8) << block_size << std::fixed << std::setprecision(2)
+                      << std::setw(12) << seconds * 1.0e9 / block_size << std::setprecision(1)
+                      << std::setw(14) << seconds * 1.0e9 << std::setw(12)
+                      << block_size / seconds * 1.0e-6 << std::endl;
+        }
+    }
+}
@@ -0,0 +1,602 @@
+/*
+** Monique is Free and Open Source Software
+**
+** Monique is made available under the Gnu General Public License, v3.0
+** https://www.gnu.org/licenses/gpl-3.0.en.html; The authors of the code
+** reserve the right to re-license their contributions under the MIT license in the
+** future at the discretion of the project maintainers.
+**
+** Copyright 2016-2022 by various individuals as described by the git transaction log
+**
+** All source at: https://github.com/surge-synthesizer/monique-monosynth.git
+**
+** Monique was a commercial product from 2016-2021, with copyright and ownership
+** in that period held by Thomas Arndt at Monoplugs. Thomas made Monique
+** open source in December 2021.
+*/
+
+#include "monique_bench_Commands.h"
+#include "monique_bench_Host.h"
+
+#include "core/monique_core_Datastructures.h"
+#include "core/monique_core_Processor.h"
+#include "core/monique_core_Synth.h"
+
+#include <juce_dsp/juce_dsp.h>
+
+#include <cmath>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+// ONE PROGRAM PLAYED WITH ONE MIDI FIXTURE
+struct GoldenCase
+{
+    juce::String name;
+    bool is_factory_default;
+    MoniqueBenchHost::Program program;
+    MoniqueBenchMidiScript script;
+    void (*setup)(MoniqueSynthData &synth_data_); // OPTIONAL, CHANGES THE PROGRAM AFTER LOADING
+};
+
+// THE FACTORY DEFAULT WITH OSC 2 HARD SYNCED TO OSC 1 AND A FIFTH ABOVE IT, SO OSC 2 WAITS
+// FOR THE MASTER IN EVERY CYCLE
+static void setup_hard_sync(MoniqueSynthData &synth_data_) noexcept
+{
+    OSCData &osc_2 = *synth_data_.osc_datas[1];
+    osc_2.sync.set_value(true);
+    osc_2.tune.set_value(7);
+    osc_2.wave.set_value(2);
+    osc_2.is_lfo_modulated.set_value(false);
+    synth_data_.filter_datas[0]->input_sustains[1].set_value(1);
+}
+
+// THE RENDERS OF ONE CASE, ONE BUFFER PER COMPARED STAGE
+enum GOLDEN_STAGES
+{
+    GOLDEN_VOICE,
+    GOLDEN_OUTPUT,
+
+    SUM_GOLDEN_STAGES
+};
+static const char *const golden_stage_names[SUM_GOLDEN_STAGES] = {"VOICE", "OUTPUT"};
+static const char *const golden_stage_suffix[SUM_GOLDEN_STAGES] = {".voice.wav", ".wav"};
+
+struct GoldenDeviation
+{
+    float peak_db;
+    float spectral_db;
+    std::int64_t max_ulp;
+};
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+// THE GLOBAL SETTINGS WHICH CHANGE THE DSP COME FROM THE session.mcfg OF THE MACHINE. EACH CASE
+// PINS THEM TO THE BUILT IN DEFAULTS PLUS THE ENGINE OPTIONS OF THE COMMAND LINE AND RETURNS
+// THEM AS THE CONFIGURATION STORED WITH THE REFERENCE
+static juce::String pin_golden_settings(MoniqueAudioProcessor &processor_) noexcept
+{
+    MoniqueSynthData &synth_data = *processor_.synth_data;
+    struct GoldenSetting
+    {
+        const char *key;
+        Parameter *param;
+    };
+    const GoldenSetting settings[] = {
+        {"stereo", &synth_data.is_stereo},
+        {"osc_engine", &synth_data.osc_engine},
+        {"only_active_osc_waves", &synth_data.only_active_osc_waves},
+        {"atan", &synth_data.atan_accuracy},
+        {"filter_rate", &synth_data.filter_coefficient_rate},
+        {"control_rate", &synth_data.control_rate},
+        {"oversampling", &synth_data.filter_oversampling},
+        {"render_oversampling", &synth_data.render_filter_oversampling}};
+
+    for (const GoldenSetting &setting : settings)
+    {
+        setting.param->set_value(setting.param->get_info().init_value);
+    }
+    MoniqueBenchHost::engine_options.apply(synth_data);
+
+    juce::String config;
+    for (const GoldenSetting &setting : settings)
+    {
+        config << setting.key << "=" << juce::roundToInt(setting.param->get_value()) << " ";
+    }
+    config << "offline=" << int(processor_.isNonRealtime());
+    return config;
+}
+
+//==============================================================================
+// A FRESH PROCESSOR PER CASE, SO NO STATE LEAKS FROM THE CASES BEFORE
+static bool render_golden_case(const GoldenCase &case_, double seconds_, double sample_rate_,
+                               int block_size_, std::int64_t seed_,
+                               juce::AudioSampleBuffer (&renders_)[SUM_GOLDEN_STAGES],
+                               juce::String &config_) noexcept
+{
+    bool success = true;
+    set_noise_seed(seed_);
+    {
+        MoniqueBenchHost host(sample_rate_, block_size_);
+        if (case_.is_factory_default)
+        {
+            host.load_default();
+        }
+        else
+        {
+            success = host.load(case_.program);
+        }
+        if (success && case_.setup)
+        {
+            case_.setup(*host.get_processor().synth_data);
+        }
+        if (success)
+        {
+            config_ = pin_golden_settings(host.get_processor());
+            host.render(case_.name, seconds_, case_.script, &renders_[GOLDEN_OUTPUT],
+                        &renders_[GOLDEN_VOICE]);
+        }
+    }
+    set_noise_seed(0);
+
+    return success;
+}
+
+//==============================================================================
+// THE CONFIGURATION OF THE RENDER GOES INTO THE COMMENT OF THE RIFF INFO CHUNK
+static bool write_golden_file(const juce::File &file_, const juce::AudioSampleBuffer &buffer_,
+                              double sample_rate_, const juce::String &config_) noexcept
+{
+    file_.deleteFile();
+    std::unique_ptr<juce::FileOutputStream> stream(file_.createOutputStream());
+    if (!stream)
+    {
+        return false;
+    }
+
+    // 32 BIT WAV IS IEEE FLOAT, THE REFERENCE STAYS BIT EXACT
+    juce::StringPairArray metadata;
+    metadata.set(juce::WavAudioFormat::riffInfoComment, config_);
+    juce::WavAudioFormat wav;
+    std::unique_ptr<juce::AudioFormatWriter> writer(wav.createWriterFor(
+        stream.get(), sample_rate_, juce::uint32(buffer_.getNumChannels()), 32, metadata, 0));
+    if (!writer)
+    {
+        return false;
+    }
+    stream.release();
+
+    return writer->writeFromAudioSampleBuffer(buffer_, 0, buffer_.getNumSamples());
+}
+static bool read_golden_file(const juce::File &file_, juce::AudioSampleBuffer &buffer_,
+                             juce::String &config_) noexcept
+{
+    juce::WavAudioFormat wav;
+    std::unique_ptr<juce::AudioFormatReader> reader(
+        wav.createReaderFor(file_.createInputStream().release(), true));
+    if (!reader)
+    {
+        return false;
+    }
+
+    config_ = reader->metadataValues[juce::WavAudioFormat::riffInfoComment];
+    buffer_.setSize(int(reader->numChannels), int(reader->lengthInSamples));
+    return reader->read(&buffer_, 0, int(reader->lengthInSamples), 0, true, true);
+}
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+// ULP DISTANCE ON THE ORDERED INTEGER REPRESENTATION, +0 AND -0 ARE EQUAL
+static inline std::int64_t to_ordered(float value_) noexcept
+{
+    std::int32_t bits;
+    std::memcpy(&bits, &value_, sizeof(bits));
+    return bits < 0 ? -std::int64_t(bits & 0x7fffffff) : std::int64_t(bits);
+}
+
+// MEAN POWER SPECTRUM IN DB OVER ALL CHANNELS, HANN WINDOWED, NO OVERLAP
+static void get_power_spectrum_db(const juce::AudioSampleBuffer &buffer_,
+                                  juce::Array<float> &spectrum_db_) noexcept
+{
+    enum
+    {
+        FFT_ORDER = 11,
+        FFT_SIZE = 1 << FFT_ORDER
+    };
+
+    juce::dsp::FFT fft(FFT_ORDER);
+    juce::dsp::WindowingFunction<float> window(FFT_SIZE,
+                                               juce::dsp::WindowingFunction<float>::hann, false);
+    juce::HeapBlock<float> frame(FFT_SIZE * 2);
+    juce::Array<double> power;
+    power.insertMultiple(0, 0, FFT_SIZE / 2 + 1);
+
+    int num_frames = 0;
+    for (int channel = 0; channel != buffer_.getNumChannels(); ++channel)
+    {
+        for (int start = 0; start + FFT_SIZE <= buffer_.getNumSamples(); start += FFT_SIZE)
+        {
+            frame.clear(FFT_SIZE * 2);
+            std::memcpy(frame.get(), buffer_.getReadPointer(channel, start),
+                        sizeof(float) * FFT_SIZE);
+            window.multiplyWithWindowingTable(frame.get(), FFT_SIZE);
+            fft.performFrequencyOnlyForwardTransform(frame.get());
+
+            for (int bin = 0; bin != power.size(); ++bin)
+            {
+                power.getReference(bin) += double(frame[bin]) * frame[bin];
+            }
+            ++num_frames;
+        }
+    }
+
+    spectrum_db_.clearQuick();
+    for (int bin = 0; bin != power.size(); ++bin)
+    {
+        const double mean = num_frames > 0 ? power[bin] / num_frames : 0;
+        spectrum_db_.add(float(10 * std::log10(mean + 1.0e-30)));
+    }
+}
+
+static GoldenDeviation compare(const juce::AudioSampleBuffer &reference_,
+                               const juce::AudioSampleBuffer &render_) noexcept
+{
+    GoldenDeviation deviation{-std::numeric_limits<float>::infinity(), 0, 0};
+
+    float peak = 0;
+    for (int channel = 0; channel != reference_.getNumChannels(); ++channel)
+    {
+        const float *const reference = reference_.getReadPointer(channel);
+        const float *const render = render_.getReadPointer(channel);
+        for (int sid = 0; sid != reference_.getNumSamples(); ++sid)
+        {
+            const float difference = std::abs(reference[sid] - render[sid]);
+            peak = std::isnan(difference) ? std::numeric_limits<float>::infinity()
+                                          : juce::jmax(peak, difference);
+            deviation.max_ulp =
+                juce::jmax(deviation.max_ulp,
+                           std::abs(to_ordered(reference[sid]) - to_ordered(render[sid])));
+        }
+    }
+    if (peak > 0)
+    {
+        deviation.peak_db = juce::Decibels::gainToDecibels(peak, -1000.0f);
+    }
+
+    // ONLY BINS WITHIN 100 DB OF THE LOUDEST REFERENCE BIN, BELOW IS NUMERIC NOISE
+    juce::Array<float> reference_db, render_db;
+    get_power_spectrum_db(reference_, reference_db);
+    get_power_spectrum_db(render_, render_db);
+    float floor_db = -1000;
+    for (const float db : reference_db)
+    {
+        floor_db = juce::jmax(floor_db, db - 100);
+    }
+    for (int bin = 0; bin != reference_db.size(); ++bin)
+    {
+        if (reference_db[bin] > floor_db || render_db[bin] > floor_db)
+        {
+            deviation.spectral_db =
+                juce::jmax(deviation.spectral_db, std::abs(reference_db[bin] - render_db[bin]));
+        }
+    }
+
+    return deviation;
+}
+
+//==============================================================================
+// THE OSCILLATOR ENGINES ARE NOT SAMPLE EXACT AGAINST EACH OTHER, SO --engines COMPARES THE LEVEL
+// AND THE POWER PER OCTAVE OF THE POLYBLEP RENDER AGAINST THE BLIT RENDER
+struct EngineDeviation
+{
+    float level_db;
+    float band_db;
+};
+
+static float get_rms_db(const juce::AudioSampleBuffer &buffer_) noexcept
+{
+    double sum = 0;
+    for (int channel = 0; channel != buffer_.getNumChannels(); ++channel)
+    {
+        const float *const samples = buffer_.getReadPointer(channel);
+        for (int sid = 0; sid != buffer_.getNumSamples(); ++sid)
+        {
+            sum += double(samples[sid]) * samples[sid];
+        }
+    }
+    const double mean = sum / juce::jmax(1, buffer_.getNumChannels() * buffer_.getNumSamples());
+    return float(10 * std::log10(mean + 1.0e-30));
+}
+
+// OCTAVES FROM 20HZ UP TO 16KHZ OR 0.4 OF THE SAMPLE RATE, ABOVE THE ENGINES ALIAS DIFFERENTLY
+static void get_octave_bands_db(const juce::AudioSampleBuffer &buffer_, double sample_rate_,
+                                juce::Array<float> &bands_db_) noexcept
+{
+    juce::Array<float> spectrum_db;
+    get_power_spectrum_db(buffer_, spectrum_db);
+    const double bin_hz = sample_rate_ / ((spectrum_db.size() - 1) * 2);
+    const double max_hz = juce::jmin(16000.0, sample_rate_ * 0.4);
+
+    bands_db_.clearQuick();
+    for (double low_hz = 20; low_hz * 2 <= max_hz; low_hz *= 2)
+    {
+        double power = 0;
+        for (int bin = int(std::ceil(low_hz / bin_hz)); bin < low_hz * 2 / bin_hz; ++bin)
+        {
+            power += std::pow(10.0, spectrum_db[bin] / 10.0);
+        }
+        bands_db_.add(float(10 * std::log10(power + 1.0e-30)));
+    }
+}
+
+static EngineDeviation compare_engines(const juce::AudioSampleBuffer &blit_,
+                                       const juce::AudioSampleBuffer &polyblep_,
+                                       double sample_rate_) noexcept
+{
+    EngineDeviation deviation{get_rms_db(polyblep_) - get_rms_db(blit_), 0};
+
+    // ONLY BANDS WITHIN 60 DB OF THE LOUDEST BLIT BAND
+    juce::Array<float> blit_db, polyblep_db;
+    get_octave_bands_db(blit_, sample_rate_, blit_db);
+    get_octave_bands_db(polyblep_, sample_rate_, polyblep_db);
+    float floor_db = -1000;
+    for (const float db : blit_db)
+    {
+        floor_db = juce::jmax(floor_db, db - 60);
+    }
+    for (int band = 0; band != blit_db.size(); ++band)
+    {
+        if (blit_db[band] > floor_db || polyblep_db[band] > floor_db)
+        {
+            deviation.band_db =
+                juce::jmax(deviation.band_db, std::abs(blit_db[band] - polyblep_db[band]));
+        }
+    }
+
+    return deviation;
+}
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+static void print_golden_header() noexcept
+{
+    std::cout << std::left << std::setw(48) << "CASE" << std::setw(8) << "STAGE" << std::right
+              << std::setw(12) << "peak dB" << std::setw(12) << "max ULP" << std::setw(14)
+              << "spectral dB" << std::setw(8) << "" << std::endl;
+}
+static void print_golden_row(const juce::String &case_, const char *stage_,
+                             const GoldenDeviation &deviation_, const char *result_) noexcept
+{
+    std::cout << std::left << std::setw(48) << case_.substring(0, 47) << std::setw(8) << stage_
+              << std::right << std::fixed << std::setprecision(1) << std::setw(12)
+              << deviation_.peak_db << std::setw(12) << deviation_.max_ulp << std::setprecision(3)
+              << std::setw(14) << deviation_.spectral_db << std::setw(8) << result_ << std::endl;
+}
+static void print_engines_header() noexcept
+{
+    std::cout << std::left << std::setw(48) << "CASE" << std::setw(8) << "STAGE" << std::right
+              << std::setw(12) << "level dB" << std::setw(12) << "band dB" << std::setw(8) << ""
+              << std::endl;
+}
+static void print_engines_row(const juce::String &case_, const char *stage_,
+                              const EngineDeviation &deviation_, const char *result_) noexcept
+{
+    std::cout << std::left << std::setw(48) << case_.substring(0, 47) << std::setw(8) << stage_
+              << std::right << std::fixed << std::setprecision(2) << std::setw(12)
+              << deviation_.level_db << std::setw(12) << deviation_.band_db << std::setw(8)
+              << result_ << std::endl;
+}
+
+//==============================================================================
+// RENDERS EVERY CASE WITH BOTH OSCILLATOR ENGINES AND RETURNS THE NUMBER OF FAILED STAGES
+static int compare_golden_engines(const juce::OwnedArray<GoldenCase> &cases_, double seconds_,
+                                  double sample_rate_, int block_size_, std::int64_t seed_,
+                                  float tolerance_level_db_, float tolerance_band_db_) noexcept
+{
+    std::cout << "pass if |level dB| <= " << tolerance_level_db_ << " and band dB <= "
+              << tolerance_band_db_ << std::endl;
+    print_engines_header();
+
+    const int options_engine = MoniqueBenchHost::engine_options.osc_engine;
+    int failed = 0;
+    for (const GoldenCase *golden_case : cases_)
+    {
+        juce::AudioSampleBuffer renders[SUM_OSC_ENGINES][SUM_GOLDEN_STAGES];
+        bool success = true;
+        for (int engine = 0; engine != SUM_OSC_ENGINES && success; ++engine)
+        {
+            juce::String config;
+            MoniqueBenchHost::engine_options.osc_engine = engine;
+            success = render_golden_case(*golden_case, seconds_, sample_rate_, block_size_, seed_,
+                                         renders[engine], config);
+        }
+        if (!success)
+        {
+            std::cout << "failed to load " << golden_case->name << std::endl;
+            ++failed;
+            continue;
+        }
+
+        for (int stage = 0; stage != SUM_GOLDEN_STAGES; ++stage)
+        {
+            const EngineDeviation deviation =
+                compare_engines(renders[OSC_ENGINE_BLIT][stage],
+                                renders[OSC_ENGINE_POLYBLEP][stage], sample_rate_);
+            const bool pass = std::abs(deviation.level_db) <= tolerance_level_db_ &&
+                              deviation.band_db <= tolerance_band_db_;
+            print_engines_row(golden_case->name, golden_stage_names[stage], deviation,
+                              pass ? "ok" : "FAIL");
+            if (!pass)
+            {
+                ++failed;
+            }
+        }
+    }
+    MoniqueBenchHost::engine_options.osc_engine = options_engine;
+
+    return failed;
+}
+
+//==============================================================================
+void run_bench_golden(const juce::ArgumentList &args_)
+{
+    const juce::File folder = juce::File::getCurrentWorkingDirectory().getChildFile(
+        get_bench_option(args_, "--dir", juce::String("golden")));
+    const bool record = args_.containsOption("--record");
+    const double seconds = get_bench_option(args_, "--seconds", 4.0);
+    const double sample_rate = get_bench_option(args_, "--rate", 48000.0);
+    const int block_size = int(get_bench_option(args_, "--block", 256.0));
+    const juce::String filter = get_bench_option(args_, "--programs", juce::String());
+    const std::int64_t seed = std::int64_t(get_bench_option(args_, "--seed", 1.0));
+    const float tolerance_db = float(get_bench_option(args_, "--tolerance-db", -90.0));
+    const std::int64_t tolerance_ulp = std::int64_t(get_bench_option(args_, "--ulp", 0.0));
+    const bool engines = args_.containsOption("--engines");
+    const float tolerance_level_db = float(get_bench_option(args_, "--level-db", 1.0));
+    const float tolerance_band_db = float(get_bench_option(args_, "--band-db", 3.0));
+
+    if (seed == 0)
+    {
+        juce::ConsoleApplication::fail("--seed=0 would seed the noise randomly");
+    }
+    if (record && engines)
+    {
+        juce::ConsoleApplication::fail("--engines compares two renders and records nothing");
+    }
+    if (record && !folder.createDirectory())
+    {
+        juce::ConsoleApplication::fail("can not create " + folder.getFullPathName());
+    }
+
+    // CASES: EVERY PROGRAM WITH EVERY FIXTURE
+    const MoniqueBenchMidiScript fixtures[] = {MoniqueBenchMidiScript::create_default(),
+                                               MoniqueBenchMidiScript::create_legato()};
+    const char *const fixture_names[] = {"pattern", "legato"};
+
+    juce::Array<MoniqueBenchHost::Program> programs;
+    {
+        MoniqueBenchHost host(sample_rate, block_size);
+        programs = host.collect_programs(filter);
+    }
+
+    juce::OwnedArray<GoldenCase> cases;
+    for (int fixture_id = 0; fixture_id != juce::numElementsInArray(fixtures); ++fixture_id)
+    {
+        if (filter.isEmpty())
+        {
+            cases.add(new GoldenCase{juce::String("FACTORY DEFAULT@") + fixture_names[fixture_id],
+                                     true, MoniqueBenchHost::Program(), fixtures[fixture_id],
+                                     nullptr});
+            cases.add(new GoldenCase{juce::String("HARD SYNC@") + fixture_names[fixture_id], true,
+                                     MoniqueBenchHost::Program(), fixtures[fixture_id],
+                                     setup_hard_sync});
+        }
+        for (const MoniqueBenchHost::Program &program : programs)
+        {
+            cases.add(new GoldenCase{program.get_full_name() + "@" + fixture_names[fixture_id],
+                                     false, program, fixtures[fixture_id], nullptr});
+        }
+    }
+
+    if (engines)
+    {
+        std::cout << "monique-bench golden: PolyBLEP against BLIT, " << cases.size() << " cases, "
+                  << seconds << "s @ " << sample_rate << "Hz, block " << block_size << ", seed "
+                  << seed << std::endl;
+        const int failed = compare_golden_engines(cases, seconds, sample_rate, block_size, seed,
+                                                  tolerance_level_db, tolerance_band_db);
+        if (failed > 0)
+        {
+            juce::ConsoleApplication::fail(juce::String(failed) +
+                                           " stage renders differ between the engines");
+        }
+        std::cout << "passed " << cases.size() << " cases" << std::endl;
+        return;
+    }
+
+    std::cout << "monique-bench golden: " << (record ? "record " : "compare ") << cases.size()
+              << " cases, " << seconds << "s @ " << sample_rate << "Hz, block " << block_size
+              << ", seed " << seed << ", " << folder.getFullPathName() << std::endl;
+    if (!record)
+    {
+        std::cout << "pass if peak dB <= " << tolerance_db;
+        if (tolerance_ulp > 0)
+        {
+            std::cout << " or max ULP <= " << tolerance_ulp;
+        }
+        std::cout << std::endl;
+        print_golden_header();
+    }
+
+    int failed = 0;
+    for (const GoldenCase *golden_case : cases)
+    {
+        juce::AudioSampleBuffer renders[SUM_GOLDEN_STAGES];
+        juce::String config;
+        if (!render_golden_case(*golden_case, seconds, sample_rate, block_size, seed, renders,
+                                config))
+        {
+            std::cout << "failed to load " << golden_case->name << std::endl;
+            ++failed;
+            continue;
+        }
+
+        const juce::String file_name = juce::File::createLegalFileName(golden_case->name);
+        for (int stage = 0; stage != SUM_GOLDEN_STAGES; ++stage)
+        {
+            const juce::File file = folder.getChildFile(file_name + golden_stage_suffix[stage]);
+            if (record)
+            {
+                if (!write_golden_file(file, renders[stage], sample_rate, config))
+                {
+                    juce::ConsoleApplication::fail("can not write " + file.getFullPathName());
+                }
+                continue;
+            }
+
+            juce::AudioSampleBuffer reference;
+            juce::String reference_config;
+            if (!read_golden_file(file, reference, reference_config) ||
+                reference.getNumChannels() != renders[stage].getNumChannels() ||
+                reference.getNumSamples() != renders[stage].getNumSamples())
+            {
+                std::cout << std::left << std::setw(48) << golden_case->name.substring(0, 47)
+                          << std::setw(8) << golden_stage_names[stage]
+                          << "missing or different length reference" << std::endl;
+                ++failed;
+                continue;
+            }
+            if (reference_config != config)
+            {
+                std::cout << std::left << std::setw(48) << golden_case->name.substring(0, 47)
+                          << std::setw(8) << golden_stage_names[stage]
+                          << "configuration differs, reference: " << reference_config
+                          << ", render: " << config << std::endl;
+                ++failed;
+                continue;
+            }
+
+            const GoldenDeviation deviation = compare(reference, renders[stage]);
+            const bool pass = deviation.peak_db <= tolerance_db ||
+                              (tolerance_ulp > 0 && deviation.max_ulp <= tolerance_ulp);
+            print_golden_row(golden_case->name, golden_stage_names[stage], deviation,
+                             pass ? "ok" : "FAIL");
+            if (!pass)
+            {
+                ++failed;
+            }
+        }
+    }
+
+    if (failed > 0)
+    {
+        juce::ConsoleApplication::fail(juce::String(failed) + " stage renders out of tolerance");
+    }
+    std::cout << (record ? "recorded " : "passed ") << cases.size() << " cases" << std::endl;
+}
@@ -0,0 +1,506 @@
+/*
+** Monique is Free and Open Source Software
+**
+** Monique is made available under the Gnu General Public License, v3.0
+** https://www.gnu.org/licenses/gpl-3.0.en.html; The authors of the code
+** reserve the right to re-license their contributions under the MIT license in the
+** future at the discretion of the project maintainers.
+**
+** Copyright 2016-2022 by various individuals as described by the git transaction log
+**
+** All source at: https://github.com/surge-synthesizer/monique-monosynth.git
+**
+** Monique was a commercial product from 2016-2021, with copyright and ownership
+** in that period held by Thomas Arndt at Monoplugs. Thomas made Monique
+** open source in December 2021.
+*/
+
+#include "monique_bench_Host.h"
+
+#include "core/monique_core_Datastructures.h"
+#include "core/monique_core_Processor.h"
+
+juce::AudioProcessor *JUCE_CALLTYPE createPluginFilter();
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+COLD MoniqueBenchMidiScript::MoniqueBenchMidiScript() noexcept : length_in_beats(4) {}
+COLD MoniqueBenchMidiScript::~MoniqueBenchMidiScript() noexcept {}
+
+//==============================================================================
+void MoniqueBenchMidiScript::add(double start_in_beats_, double length_in_beats_,
+                                 int note_number_, float velocity_) noexcept
+{
+    notes.add(Note{start_in_beats_, length_in_beats_, note_number_, velocity_});
+}
+void MoniqueBenchMidiScript::set_length_in_beats(double length_in_beats_) noexcept
+{
+    length_in_beats = juce::jmax(1.0, length_in_beats_);
+}
+void MoniqueBenchMidiScript::fill_block(juce::MidiBuffer &midi_, std::int64_t start_sample_,
+                                        int num_samples_, double samples_per_beat_) const noexcept
+{
+    const double samples_per_loop = length_in_beats * samples_per_beat_;
+    const std::int64_t end_sample = start_sample_ + num_samples_;
+
+    // ONE LOOP BACK TO CATCH NOTE OFFS OF LONG NOTES
+    const int first_loop = juce::jmax(0, int(start_sample_ / samples_per_loop) - 1);
+    const int last_loop = int(end_sample / samples_per_loop);
+
+    // NOTE OFFS FIRST, THE MIDI BUFFER KEEPS THE ORDER OF EVENTS AT THE SAME POSITION
+    for (int loop = first_loop; loop <= last_loop; ++loop)
+    {
+        for (const Note &note : notes)
+        {
+            const std::int64_t off = std::int64_t(
+                (loop * length_in_beats + note.start_in_beats + note.length_in_beats) *
+                samples_per_beat_);
+            if (off >= start_sample_ && off < end_sample)
+            {
+                midi_.addEvent(juce::MidiMessage::noteOff(1, note.note_number),
+                               int(off - start_sample_));
+            }
+        }
+    }
+    for (int loop = first_loop; loop <= last_loop; ++loop)
+    {
+        for (const Note &note : notes)
+        {
+            const std::int64_t on =
+                std::int64_t((loop * length_in_beats + note.start_in_beats) * samples_per_beat_);
+            if (on >= start_sample_ && on < end_sample)
+            {
+                midi_.addEvent(juce::MidiMessage::noteOn(1, note.note_number, note.velocity),
+                               int(on - start_sample_));
+            }
+        }
+    }
+}
+MoniqueBenchMidiScript MoniqueBenchMidiScript::create_default() noexcept
+{
+    // TWO BARS: STACCATO, LEGATO OVERLAPS AND A LONG NOTE TO KEEP THE RELEASE STAGES BUSY
+    MoniqueBenchMidiScript script;
+    script.set_length_in_beats(8);
+    script.add(0.0, 0.25, 36, 1.0f);
+    script.add(0.5, 0.25, 48, 0.6f);
+    script.add(1.0, 0.75, 43, 0.8f);
+    script.add(1.5, 0.75, 55, 0.7f);
+    script.add(2.5, 0.5, 39, 0.9f);
+    script.add(3.0, 0.5, 51, 0.5f);
+    script.add(4.0, 3.0, 60, 1.0f);
+    script.add(6.0, 0.5, 67, 0.4f);
+    return script;
+}
+MoniqueBenchMidiScript MoniqueBenchMidiScript::create_legato() noexcept
+{
+    // OVERLAPPING LONG NOTES FOR GLIDE, SUSTAIN AND THE DELAY/REVERB TAILS
+    MoniqueBenchMidiScript script;
+    script.set_length_in_beats(8);
+    script.add(0.0, 2.25, 48, 0.9f);
+    script.add(2.0, 2.25, 55, 0.7f);
+    script.add(4.0, 1.25, 43, 1.0f);
+    script.add(5.0, 2.0, 60, 0.5f);
+    return script;
+}
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+double MoniqueBenchHost::RenderStats::get_realtime_factor() const noexcept
+{
+    const double audio_seconds = rendered_samples / sample_rate;
+    return audio_seconds > 0 ? cpu_seconds / audio_seconds : 0;
+}
+double MoniqueBenchHost::RenderStats::get_ns_per_sample() const noexcept
+{
+    return rendered_samples > 0 ? cpu_seconds * 1.0e9 / rendered_samples : 0;
+}
+double MoniqueBenchHost::RenderStats::get_mean_block_us() const noexcept
+{
+    return rendered_blocks > 0 ? cpu_seconds * 1.0e6 / rendered_blocks : 0;
+}
+double MoniqueBenchHost::RenderStats::get_peak_block_us() const noexcept
+{
+    return peak_block_seconds * 1.0e6;
+}
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+// WITHOUT A PLAY HEAD THE PROCESSOR DOES NOT RENDER IN PLUGIN MODE
+class MoniqueBenchHost::PlayHead : public juce::AudioPlayHead
+{
+  public:
+    std::int64_t time_in_samples = 0;
+    double sample_rate = 44100;
+    double bpm = 120;
+
+    inline double get_samples_per_beat() const noexcept { return sample_rate * 60.0 / bpm; }
+
+#if JUCE_MAJOR_VERSION >= 7
+    juce::Optional<PositionInfo> getPosition() const override
+    {
+        const double ppq = time_in_samples / get_samples_per_beat();
+
+        PositionInfo info;
+        info.setTimeInSamples(time_in_samples);
+        info.setTimeInSeconds(time_in_samples / sample_rate);
+        info.setBpm(bpm);
+        info.setTimeSignature(TimeSignature{4, 4});
+        info.setPpqPosition(ppq);
+        info.setPpqPositionOfLastBarStart(std::floor(ppq / 4) * 4);
+        info.setIsPlaying(true);
+        return info;
+    }
+#else
+    bool getCurrentPosition(CurrentPositionInfo &result_) override
+    {
+        const double ppq = time_in_samples / get_samples_per_beat();
+
+        result_.resetToDefault();
+        result_.timeInSamples = time_in_samples;
+        result_.timeInSeconds = time_in_samples / sample_rate;
+        result_.bpm = bpm;
+        result_.timeSigNumerator = 4;
+        result_.timeSigDenominator = 4;
+        result_.ppqPosition = ppq;
+        result_.ppqPositionOfLastBarStart = std::floor(ppq / 4) * 4;
+        result_.isPlaying = true;
+        return true;
+    }
+#endif
+};
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+void MoniqueBenchEngineOptions::apply(MoniqueSynthData &synth_data_) const noexcept
+{
+    if (osc_engine >= 0)
+    {
+        synth_data_.osc_engine = osc_engine;
+    }
+    if (only_active_osc_waves >= 0)
+    {
+        synth_data_.only_active_osc_waves = bool(only_active_osc_waves);
+    }
+    if (atan_accuracy >= 0)
+    {
+        synth_data_.atan_accuracy = atan_accuracy;
+    }
+    if (filter_coefficient_rate >= 0)
+    {
+        synth_data_.filter_coefficient_rate = filter_coefficient_rate;
+    }
+    if (control_rate >= 0)
+    {
+        synth_data_.control_rate = control_rate;
+    }
+    if (filter_oversampling >= 0)
+    {
+        synth_data_.filter_oversampling = filter_oversampling;
+        synth_data_.render_filter_oversampling = filter_oversampling;
+    }
+}
+MoniqueBenchEngineOptions MoniqueBenchEngineOptions::parse(const juce::ArgumentList &args_)
+{
+    MoniqueBenchEngineOptions options;
+    if (args_.containsOption("--osc-engine"))
+    {
+        const juce::String engine = args_.getValueForOption("--osc-engine");
+        if (engine == "blit")
+        {
+            options.osc_engine = OSC_ENGINE_BLIT;
+        }
+        else if (engine == "polyblep")
+        {
+            options.osc_engine = OSC_ENGINE_POLYBLEP;
+        }
+        else
+        {
+            juce::ConsoleApplication::fail("unknown --osc-engine " + engine +
+                                           ", use blit or polyblep");
+        }
+    }
+    if (args_.containsOption("--all-osc-waves"))
+    {
+        options.only_active_osc_waves = false;
+    }
+    if (args_.containsOption("--atan"))
+    {
+        const juce::String accuracy = args_.getValueForOption("--atan");
+        if (accuracy == "exact")
+        {
+            options.atan_accuracy = ATAN_EXACT;
+        }
+        else if (accuracy == "precise")
+        {
+            options.atan_accuracy = ATAN_PRECISE;
+        }
+        else if (accuracy == "fast")
+        {
+            options.atan_accuracy = ATAN_FAST;
+        }
+        else
+        {
+            juce::ConsoleApplication::fail("unknown --atan " + accuracy +
+                                           ", use exact, precise or fast");
+        }
+    }
+    if (args_.containsOption("--filter-rate"))
+    {
+        const int rate = args_.getValueForOption("--filter-rate").getIntValue();
+        if (rate < 1 || rate > 16)
+        {
+            juce::ConsoleApplication::fail("--filter-rate needs 1 to 16 samples");
+        }
+        options.filter_coefficient_rate = rate;
+    }
+    if (args_.containsOption("--control-rate"))
+    {
+        const juce::String rate = args_.getValueForOption("--control-rate");
+        if (rate == "1")
+        {
+            options.control_rate = CONTROL_RATE_1;
+        }
+        else if (rate == "8")
+        {
+            options.control_rate = CONTROL_RATE_8;
+        }
+        else if (rate == "16")
+        {
+            options.control_rate = CONTROL_RATE_16;
+        }
+        else if (rate == "32")
+        {
+            options.control_rate = CONTROL_RATE_32;
+        }
+        else
+        {
+            juce::ConsoleApplication::fail("unknown --control-rate " + rate +
+                                           ", use 1, 8, 16 or 32");
+        }
+    }
+    if (args_.containsOption("--oversampling"))
+    {
+        const juce::String factor = args_.getValueForOption("--oversampling");
+        if (factor == "1")
+        {
+            options.filter_oversampling = FILTER_OVERSAMPLING_OFF;
+        }
+        else if (factor == "2")
+        {
+            options.filter_oversampling = FILTER_OVERSAMPLING_2X;
+        }
+        else if (factor == "4")
+        {
+            options.filter_oversampling = FILTER_OVERSAMPLING_4X;
+        }
+        else
+        {
+            juce::ConsoleApplication::fail("unknown --oversampling " + factor + ", use 1, 2 or 4");
+        }
+    }
+    if (args_.containsOption("--offline"))
+    {
+        options.non_realtime = 1;
+    }
+    return options;
+}
+
+//==============================================================================
+MoniqueBenchEngineOptions MoniqueBenchHost::engine_options;
+
+COLD MoniqueBenchHost::MoniqueBenchHost(double sample_rate_, int block_size_) noexcept
+    : play_head(std::make_unique<PlayHead>()), processor(createPluginFilter()),
+      block_listener(nullptr), sample_rate(sample_rate_), block_size(block_size_)
+{
+    // THE ENGINE OPTIONS AND TRAINED MIDI OF A BENCH RUN MUST NOT END UP IN THE USER SETTINGS
+    get_processor().save_settings_on_shutdown = false;
+    engine_options.apply(*get_processor().synth_data);
+    processor->setNonRealtime(engine_options.non_realtime > 0);
+    processor->setPlayHead(play_head.get());
+    prepare(sample_rate_, block_size_);
+}
+COLD MoniqueBenchHost::~MoniqueBenchHost() noexcept
+{
+    processor->releaseResources();
+    processor->setPlayHead(nullptr);
+    processor = nullptr;
+}
+
+//==============================================================================
+MoniqueAudioProcessor &MoniqueBenchHost::get_processor() noexcept
+{
+    return *static_cast<MoniqueAudioProcessor *>(processor.get());
+}
+void MoniqueBenchHost::prepare(double sample_rate_, int block_size_) noexcept
+{
+    sample_rate = sample_rate_;
+    block_size = block_size_;
+    play_head->sample_rate = sample_rate_;
+    play_head->time_in_samples = 0;
+
+    processor->setPlayConfigDetails(0, 2, sample_rate_, block_size_);
+    processor->prepareToPlay(sample_rate_, block_size_);
+}
+
+//==============================================================================
+juce::Array<MoniqueBenchHost::Program>
+MoniqueBenchHost::collect_programs(const juce::String &filter_) noexcept
+{
+    MoniqueSynthData *const synth_data = get_processor().synth_data;
+
+    juce::Array<Program> programs;
+    const juce::StringArray &banks = synth_data->get_banks();
+    for (int bank_id = 0; bank_id != banks.size(); ++bank_id)
+    {
+        const juce::StringArray &names = synth_data->get_programms(bank_id);
+        for (int program_id = 0; program_id != names.size(); ++program_id)
+        {
+            Program program{bank_id, program_id, banks[bank_id], names[program_id]};
+            if (filter_.isEmpty() || program.get_full_name().containsIgnoreCase(filter_))
+            {
+                programs.add(program);
+            }
+        }
+    }
+
+    return programs;
+}
+bool MoniqueBenchHost::load(const Program &program_) noexcept
+{
+    MoniqueSynthData *const synth_data = get_processor().synth_data;
+
+    synth_data->set_current_bank(program_.bank_id);
+    synth_data->set_current_program(program_.program_id);
+    if (synth_data->get_current_program() != program_.program_id)
+    {
+        return false;
+    }
+
+    return synth_data->load(true, true);
+}
+void MoniqueBenchHost::load_default() noexcept { get_processor().synth_data->load_default(); }
+
+//==============================================================================
+MoniqueBenchHost::RenderStats
+MoniqueBenchHost::render(const juce::String &name_, double seconds_,
+                         const MoniqueBenchMidiScript &script_, juce::AudioSampleBuffer *capture_,
+                         juce::AudioSampleBuffer *pre_fx_capture_) noexcept
+{
+    RenderStats stats;
+    stats.name = name_;
+    stats.sample_rate = sample_rate;
+
+    const std::int64_t samples_to_render = std::int64_t(seconds_ * sample_rate);
+    if (capture_)
+    {
+        capture_->setSize(2, int(samples_to_render), false, true, false);
+    }
+
+    // THE VOICE WRITES INTO THE TAP ONLY WHILE IT IS NOT BYPASSED
+    juce::AudioSampleBuffer pre_fx_tap(2, block_size);
+    RuntimeInfo *const info = get_processor().info.get();
+    if (pre_fx_capture_)
+    {
+        pre_fx_capture_->setSize(2, int(samples_to_render), false, true, false);
+        info->pre_fx_capture = &pre_fx_tap;
+    }
+
+    juce::AudioSampleBuffer buffer(2, block_size);
+    juce::MidiBuffer midi;
+
+    play_head->time_in_samples = 0;
+    const double ticks_to_seconds =
+        1.0 / double(juce::Time::getHighResolutionTicksPerSecond());
+    std::int64_t position = 0;
+    while (position < samples_to_render)
+    {
+        const int num_samples = int(juce::jmin(std::int64_t(block_size),
+                                               samples_to_render - position));
+        if (block_listener)
+        {
+            block_listener->block_started(stats.rendered_blocks);
+        }
+
+        // ONE SLICE PER BLOCK, UNLESS THE LISTENER SPLITS IT
+        double block_seconds = 0;
+        for (int offset = 0; offset != num_samples;)
+        {
+            const std::int64_t slice_position = position + offset;
+            int slice_samples = num_samples - offset;
+            if (block_listener)
+            {
+                slice_samples = juce::jlimit(
+                    1, slice_samples, block_listener->get_slice_size(slice_position, slice_samples));
+                block_listener->slice_started(slice_position);
+            }
+
+            buffer.setSize(2, slice_samples, false, false, true);
+            pre_fx_tap.setSize(2, slice_samples, false, false, true);
+            pre_fx_tap.clear();
+            midi.clear();
+            script_.fill_block(midi, slice_position, slice_samples,
+                               play_head->get_samples_per_beat());
+
+            play_head->time_in_samples = slice_position;
+            const std::int64_t start_ticks = juce::Time::getHighResolutionTicks();
+            processor->processBlock(buffer, midi);
+            block_seconds += (juce::Time::getHighResolutionTicks() - start_ticks) * ticks_to_seconds;
+
+            if (capture_)
+            {
+                for (int channel = 0; channel != 2; ++channel)
+                {
+                    capture_->copyFrom(channel, int(slice_position), buffer, channel, 0,
+                                       slice_samples);
+                }
+            }
+            if (pre_fx_capture_)
+            {
+                for (int channel = 0; channel != 2; ++channel)
+                {
+                    pre_fx_capture_->copyFrom(channel, int(slice_position), pre_fx_tap, channel,
+                                              0, slice_samples);
+                }
+            }
+
+            offset += slice_samples;
+        }
+
+        if (block_listener)
+        {
+            block_listener->block_finished(stats.rendered_blocks);
+        }
+
+        stats.cpu_seconds += block_seconds;
+        stats.peak_block_seconds = juce::jmax(stats.peak_block_seconds, block_seconds);
+        ++stats.rendered_blocks;
+
+        position += num_samples;
+        play_head->time_in_samples = position;
+    }
+    stats.rendered_samples = position;
+    info->pre_fx_capture = nullptr;
+
+    return stats;
+}
+void MoniqueBenchHost::flush(double seconds_) noexcept
+{
+    juce::AudioSampleBuffer buffer(2, block_size);
+    juce::MidiBuffer midi;
+    midi.addEvent(juce::MidiMessage::allNotesOff(1), 0);
+
+    const std::int64_t samples_to_render = std::int64_t(seconds_ * sample_rate);
+    for (std::int64_t position = 0; position < samples_to_render; position += block_size)
+    {
+        play_head->time_in_samples = position;
+        processor->processBlock(buffer, midi);
+        midi.clear();
+    }
+    play_head->time_in_samples = 0;
+
+    get_processor().reset_pending_notes();
+}
@@ -0,0 +1,183 @@
+/*
+** Monique is Free and Open Source Software
+**
+** Monique is made available under the Gnu General Public License, v3.0
+** https://www.gnu.org/licenses/gpl-3.0.en.html; The authors of the code
+** reserve the right to re-license their contributions under the MIT license in the
+** future at the discretion of the project maintainers.
+**
+** Copyright 2016-2022 by various individuals as described by the git transaction log
+**
+** All source at: https://github.com/surge-synthesizer/monique-monosynth.git
+**
+** Monique was a commercial product from 2016-2021, with copyright and ownership
+** in that period held by Thomas Arndt at Monoplugs. Thomas made Monique
+** open source in December 2021.
+*/
+
+#ifndef MONIQUE_BENCH_HOST_H_INCLUDED
+#define MONIQUE_BENCH_HOST_H_INCLUDED
+
+#include "App.h"
+
+class MoniqueAudioProcessor;
+struct MoniqueSynthData;
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+// ENGINE SETTINGS FOR EVERY HOST, SHARED BY ALL MODES
+// -1 KEEPS WHAT THE PROCESSOR LOADED FROM session.mcfg
+struct MoniqueBenchEngineOptions
+{
+    int osc_engine = -1;
+    int only_active_osc_waves = -1;
+    int atan_accuracy = -1;
+    int filter_coefficient_rate = -1;
+    int control_rate = -1;
+    int filter_oversampling = -1; // LIVE AND RENDER
+    int non_realtime = -1;
+
+    void apply(MoniqueSynthData &synth_data_) const noexcept;
+
+    // --osc-engine=blit|polyblep --all-osc-waves --atan=exact|precise|fast --filter-rate=1..16
+    // --control-rate=1|8|16|32 --oversampling=1|2|4 --offline
+    static MoniqueBenchEngineOptions parse(const juce::ArgumentList &args_);
+};
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+// A LOOPED NOTE PATTERN IN BEATS, RENDERED INTO EACH PROCESS BLOCK
+class MoniqueBenchMidiScript
+{
+  public:
+    struct Note
+    {
+        double start_in_beats;
+        double length_in_beats;
+        int note_number;
+        float velocity;
+    };
+
+  private:
+    juce::Array<Note> notes;
+    double length_in_beats;
+
+  public:
+    //==========================================================================
+    void add(double start_in_beats_, double length_in_beats_, int note_number_,
+             float velocity_) noexcept;
+    void set_length_in_beats(double length_in_beats_) noexcept;
+
+    // ADDS ALL EVENTS OF THE SAMPLE RANGE [start_sample_, start_sample_ + num_samples_)
+    void fill_block(juce::MidiBuffer &midi_, std::int64_t start_sample_, int num_samples_,
+                    double samples_per_beat_) const noexcept;
+
+    static MoniqueBenchMidiScript create_default() noexcept;
+    static MoniqueBenchMidiScript create_legato() noexcept;
+
+  public:
+    //==========================================================================
+    MoniqueBenchMidiScript() noexcept;
+    ~MoniqueBenchMidiScript() noexcept;
+};
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+// RUNS THE PROCESSOR WITHOUT AN EDITOR OR AUDIO DEVICE
+class MoniqueBenchHost
+{
+  public:
+    //==========================================================================
+    struct Program
+    {
+        int bank_id;
+        int program_id;
+        juce::String bank_name;
+        juce::String program_name;
+
+        juce::String get_full_name() const noexcept { return bank_name + ":" + program_name; }
+    };
+
+    struct RenderStats
+    {
+        juce::String name;
+        std::int64_t rendered_samples = 0;
+        int rendered_blocks = 0;
+        double sample_rate = 0;
+        double cpu_seconds = 0;
+        double peak_block_seconds = 0;
+
+        double get_realtime_factor() const noexcept;
+        double get_ns_per_sample() const noexcept;
+        double get_mean_block_us() const noexcept;
+        double get_peak_block_us() const noexcept;
+    };
+
+    // CALLED AROUND EVERY BLOCK OF render(), OUTSIDE THE TIMED RANGE
+    class BlockListener
+    {
+      public:
+        virtual void block_started(int block_id_) noexcept = 0;
+        virtual void block_finished(int block_id_) noexcept = 0;
+
+        // SAMPLE ACCURATE AUTOMATION: THE HOST SPLITS EACH BLOCK INTO SLICES OF THE RETURNED
+        // SIZE, 1 TO max_samples_, AND CALLS processBlock ONCE PER SLICE, LIKE A HOST THAT SPLITS
+        // AT ITS AUTOMATION POINTS. slice_started IS CALLED BEFORE EACH SLICE
+        virtual int get_slice_size(std::int64_t, int max_samples_) noexcept
+        {
+            return max_samples_;
+        }
+        virtual void slice_started(std::int64_t) noexcept {}
+
+        virtual ~BlockListener() noexcept {}
+    };
+
+  private:
+    class PlayHead;
+    std::unique_ptr<PlayHead> play_head;
+    std::unique_ptr<juce::AudioProcessor> processor;
+    BlockListener *block_listener;
+
+    double sample_rate;
+    int block_size;
+
+  public:
+    //==========================================================================
+    static MoniqueBenchEngineOptions engine_options; // APPLIED TO EACH NEW HOST
+
+    MoniqueAudioProcessor &get_processor() noexcept;
+    // THE HOST SIDE INTERFACE, THE AUTOMATION CALLS ARE PRIVATE IN THE PROCESSOR
+    juce::AudioProcessor &get_audio_processor() noexcept { return *processor; }
+    double get_sample_rate() const noexcept { return sample_rate; }
+    int get_block_size() const noexcept { return block_size; }
+
+    void prepare(double sample_rate_, int block_size_) noexcept;
+    void set_block_listener(BlockListener *listener_) noexcept { block_listener = listener_; }
+
+    //==========================================================================
+    juce::Array<Program> collect_programs(const juce::String &filter_) noexcept;
+    bool load(const Program &program_) noexcept;
+    void load_default() noexcept;
+
+    //==========================================================================
+    // CAPTURES ARE OPTIONAL AND WILL BE RESIZED TO THE RENDERED LENGTH
+    RenderStats render(const juce::String &name_, double seconds_,
+                       const MoniqueBenchMidiScript &script_,
+                       juce::AudioSampleBuffer *capture_ = nullptr,
+                       juce::AudioSampleBuffer *pre_fx_capture_ = nullptr) noexcept;
+
+    // RENDERS AND DROPS THE OUTPUT TO GET RID OF RELEASE TAILS
+    void flush(double seconds_) noexcept;
+
+  public:
+    //==========================================================================
+    MoniqueBenchHost(double sample_rate_, int block_size_) noexcept;
+    ~MoniqueBenchHost() noexcept;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(MoniqueBenchHost)
+};
+
+#endif // MONIQUE_BENCH_HOST_H_INCLUDED
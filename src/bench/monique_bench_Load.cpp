@@ -0,0 +1,161 @@
+/*
+** Monique is Free and Open Source Software
+**
+** Monique is made available under the Gnu General Public License, v3.0
+** https://www.gnu.org/licenses/gpl-3.0.en.html; The authors of the code
+** reserve the right to re-license their contributions under the MIT license in the
+** future at the discretion of the project maintainers.
+**
+** Copyright 2016-2022 by various individuals as described by the git transaction log
+**
+** All source at: https://github.com/surge-synthesizer/monique-monosynth.git
+**
+** Monique was a commercial product from 2016-2021, with copyright and ownership
+** in that period held by Thomas Arndt at Monoplugs. Thomas made Monique
+** open source in December 2021.
+*/
+
+#include "monique_bench_Commands.h"
+#include "monique_bench_Host.h"
+
+#include "core/monique_core_Datastructures.h"
+#include "core/monique_core_Processor.h"
+
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+struct ProgramLoadStats
+{
+    juce::String name;
+    double stage_seconds[SUM_LOAD_TIMING_STAGES] = {};
+    double load_seconds = 0;
+    double state_seconds = 0;
+    std::size_t state_bytes = 0;
+};
+
+static double seconds_since(std::int64_t start_ticks_) noexcept
+{
+    return juce::Time::highResolutionTicksToSeconds(juce::Time::getHighResolutionTicks() -
+                                                    start_ticks_);
+}
+
+static void print_load_header() noexcept
+{
+    std::cout << std::left << std::setw(36) << "PROGRAM" << std::right;
+    for (int stage = 0; stage != SUM_LOAD_TIMING_STAGES; ++stage)
+    {
+        std::cout << std::setw(15) << LoadTimings::get_stage_name(stage);
+    }
+    std::cout << std::setw(11) << "load ms" << std::setw(11) << "state ms" << std::setw(10)
+              << "state KB" << std::endl;
+}
+static void print_load_stats(const ProgramLoadStats &stats_) noexcept
+{
+    std::cout << std::left << std::setw(36) << stats_.name.substring(0, 35) << std::right
+              << std::fixed << std::setprecision(3);
+    for (int stage = 0; stage != SUM_LOAD_TIMING_STAGES; ++stage)
+    {
+        std::cout << std::setw(15) << stats_.stage_seconds[stage] * 1e3;
+    }
+    std::cout << std::setw(11) << stats_.load_seconds * 1e3 << std::setw(11)
+              << stats_.state_seconds * 1e3 << std::setprecision(1) << std::setw(10)
+              << stats_.state_bytes / 1024.0 << std::endl;
+}
+
+//==============================================================================
+void run_bench_load(const juce::ArgumentList &args_)
+{
+    const juce::String filter = get_bench_option(args_, "--programs", juce::String());
+    const int repeats = juce::jmax(1, int(get_bench_option(args_, "--repeat", 3.0)));
+
+    MoniqueBenchHost host(48000, 256);
+    MoniqueSynthData *const synth_data = host.get_processor().synth_data;
+    juce::AudioProcessor &processor = host.get_audio_processor();
+    const juce::Array<MoniqueBenchHost::Program> programs = host.collect_programs(filter);
+    if (programs.isEmpty())
+    {
+        juce::ConsoleApplication::fail("no program matches " + filter);
+    }
+
+    std::cout << "monique-bench load: " << programs.size() << " programs, mean of " << repeats
+              << " loads each" << std::endl;
+
+    std::vector<ProgramLoadStats> all_stats;
+    LoadTimings timings;
+    for (const MoniqueBenchHost::Program &program : programs)
+    {
+        ProgramLoadStats stats;
+        stats.name = program.get_full_name();
+
+        // FROM FILE, LIKE A PROGRAM CHANGE
+        bool loaded = true;
+        timings.reset();
+        synth_data->load_timings = &timings;
+        for (int repeat = 0; repeat != repeats && loaded; ++repeat)
+        {
+            const std::int64_t start_ticks = juce::Time::getHighResolutionTicks();
+            loaded = host.load(program);
+            stats.load_seconds += seconds_since(start_ticks);
+        }
+        synth_data->load_timings = nullptr;
+        if (!loaded)
+        {
+            std::cout << "failed to load " << stats.name << std::endl;
+            continue;
+        }
+        for (int stage = 0; stage != SUM_LOAD_TIMING_STAGES; ++stage)
+        {
+            stats.stage_seconds[stage] = timings.sum_seconds[stage] / repeats;
+        }
+        stats.load_seconds /= repeats;
+
+        // FROM THE HOST, LIKE A SESSION RESTORE
+        juce::MemoryBlock state;
+        processor.getStateInformation(state);
+        stats.state_bytes = state.getSize();
+        for (int repeat = 0; repeat != repeats; ++repeat)
+        {
+            const std::int64_t start_ticks = juce::Time::getHighResolutionTicks();
+            processor.setStateInformation(state.getData(), int(state.getSize()));
+            stats.state_seconds += seconds_since(start_ticks);
+        }
+        stats.state_seconds /= repeats;
+
+        all_stats.push_back(stats);
+    }
+
+    //==========================================================================
+    std::sort(all_stats.begin(), all_stats.end(),
+              [](const ProgramLoadStats &a_, const ProgramLoadStats &b_) {
+                  return a_.load_seconds > b_.load_seconds;
+              });
+
+    ProgramLoadStats sum;
+    sum.name = "MEAN";
+    print_load_header();
+    for (const ProgramLoadStats &stats : all_stats)
+    {
+        print_load_stats(stats);
+
+        for (int stage = 0; stage != SUM_LOAD_TIMING_STAGES; ++stage)
+        {
+            sum.stage_seconds[stage] += stats.stage_seconds[stage] / all_stats.size();
+        }
+        sum.load_seconds += stats.load_seconds / all_stats.size();
+        sum.state_seconds += stats.state_seconds / all_stats.size();
+        sum.state_bytes += stats.state_bytes / all_stats.size();
+    }
+    std::cout << std::endl;
+    print_load_stats(sum);
+    if (!all_stats.empty())
+    {
+        std::cout << "MEDIAN load " << std::setprecision(3)
+                  << all_stats[all_stats.size() / 2].load_seconds * 1e3 << " ms, MAX load "
+                  << all_stats.front().load_seconds * 1e3 << " ms" << std::endl;
+    }
+}
@@ -0,0 +1,126 @@
+/*
+** Monique is Free and Open Source Software
+**
+** Monique is made available under the Gnu General Public License, v3.0
+** https://www.gnu.org/licenses/gpl-3.0.en.html; The authors of the code
+** reserve the right to re-license their contributions under the MIT license in the
+** future at the discretion of the project maintainers.
+**
+** Copyright 2016-2022 by various individuals as described by the git transaction log
+**
+** All source at: https://github.com/surge-synthesizer/monique-monosynth.git
+**
+** Monique was a commercial product from 2016-2021, with copyright and ownership
+** in that period held by Thomas Arndt at Monoplugs. Thomas made Monique
+** open source in December 2021.
+*/
+
+#include "monique_bench_Commands.h"
+#include "monique_bench_Host.h"
+
+//==============================================================================
+int main(int argc, char *argv[])
+{
+    // THE PROCESSOR OWNS A LOOK AND FEEL, SO WE NEED THE GUI BITS UP EVEN WITHOUT AN EDITOR
+    juce::ScopedJuceInitialiser_GUI juce_initialiser;
+
+    juce::ConsoleApplication app;
+    app.addHelpCommand("--help|-h",
+                       "Usage: monique-bench <mode> [options] [--osc-engine=blit|polyblep] "
+                       "[--all-osc-waves] [--atan=exact|precise|fast] [--filter-rate=1] "
+                       "[--control-rate=1|8|16|32] [--oversampling=1|2|4] [--offline]",
+                       true);
+
+    app.addCommand({"render", "render [--seconds=10] [--rate=48000] [--block=256] [--programs=X]",
+                    "Renders every program with a scripted MIDI loop",
+                    "Loads the factory default and every program whose BANK:NAME contains X, "
+                    "renders N seconds through processBlock and prints the real-time factor, "
+                    "ns per sample and the mean and peak block time.",
+                    run_bench_render});
+    app.addCommand({"golden",
+                    "golden [--record] [--dir=golden] [--seconds=4] [--rate=48000] [--block=256] "
+                    "[--programs=X] [--seed=1] [--tolerance-db=-90] [--ulp=N] [--engines] "
+                    "[--level-db=1] [--band-db=3]",
+                    "Records or compares reference renders with seeded noise",
+                    "Renders every program whose BANK:NAME contains X with each MIDI fixture on a "
+                    "fresh processor and the noise seeded from --seed. Without X the factory "
+                    "default also runs with OSC 2 hard synced to OSC 1. With --record the voice "
+                    "(before the FX) and the final output are stored as float WAVs in --dir, "
+                    "otherwise they are compared against the stored files. A stage passes if its "
+                    "peak deviation is below --tolerance-db or, with --ulp, every sample is within "
+                    "N ULP. Prints the peak, ULP and spectral deviation per stage and fails on any "
+                    "out of tolerance stage. With --engines nothing is stored, every case renders "
+                    "with the BLIT and the PolyBLEP oscillators instead and passes if their RMS "
+                    "levels are within --level-db and their octave bands within --band-db.",
+                    run_bench_golden});
+    app.addCommand({"dsp",
+                    "dsp [--blocks=64,256,1024] [--rate=48000] [--min-time=0.2] [--filter=X]",
+                    "Microbenchmarks of the oscillator, filter and FX primitives",
+                    "Times every DSP primitive whose name contains X in isolation for each block "
+                    "size and prints ns per sample, ns per block and Msamples/s.",
+                    run_bench_dsp});
+    app.addCommand({"rtcheck",
+                    "rtcheck [--seconds=2] [--rate=48000] [--block=64] [--programs=X] "
+                    "[--max-blocks=20] [--max-stacks=20] [--depth=12]",
+                    "Reports allocations and mutex locks inside the audio callback",
+                    "Renders every program whose name contains X and records each malloc, free "
+                    "and mutex lock made while the processor renders a block. Prints the counts "
+                    "per program, the first offending blocks and the distinct call stacks, and "
+                    "fails if anything was found. Linux only, and only in monique-bench-rtcheck, "
+                    "the build that interposes malloc and pthread.",
+                    run_bench_rtcheck});
+    app.addCommand({"sweep",
+                    "sweep [--seconds=2] [--blocks=1,2,...,4096] [--rates=44100,...,192000] "
+                    "[--programs=X] [--csv=file]",
+                    "Renders over a grid of block sizes and sample rates",
+                    "Renders the factory default, or every program whose name contains X, for "
+                    "each block size and sample rate. Fits cpu = fixed per block + cost per "
+                    "sample for each sample rate and prints both parts and the share of the "
+                    "fixed part per block size. --csv stores the raw points with the build "
+                    "version, to compare releases.",
+                    run_bench_sweep});
+    app.addCommand({"automation",
+                    "automation [--seconds=5] [--rate=48000] [--block=256] [--programs=X] "
+                    "[--rate-hz=1000] [--mode=both|between|within] [--feedback]",
+                    "Renders while every automatable parameter is driven by setParameter",
+                    "Renders each program once plain and once with a sine lane on every "
+                    "automatable parameter, updated at --rate-hz. 'between' sets the lanes on the "
+                    "audio thread before each block, 'within' splits the blocks at every "
+                    "automation point and sets each point before its slice, like a host with "
+                    "sample accurate automation. --feedback trains a CC on every parameter to "
+                    "include the MIDI feedback and restores the MIDI learn afterwards. Fails "
+                    "when a program does not load. Prints the real-time factor and peak block "
+                    "time of both renders, the peak block time including the automation and the "
+                    "mean and peak cost of one setParameter call.",
+                    run_bench_automation});
+    app.addCommand({"load", "load [--programs=X] [--repeat=3]",
+                    "Times loading every program from file and from the host state",
+                    "Loads every program whose name contains X --repeat times from its file and "
+                    "through setStateInformation. Prints the mean time of the XML parsing, the "
+                    "parameter reads, the morph source reads, the morphing, the internal backup "
+                    "and the MIDI feedback, the total of both load paths and the state size, "
+                    "sorted by the slowest program.",
+                    run_bench_load});
+    app.addCommand({"memory", "memory [--instances=4] [--rate=48000] [--block=512] [--editor]",
+                    "Reports the heap of one processor instance by category",
+                    "Creates --instances processors and measures the heap each one adds through "
+                    "the allocator. Prints the bytes of the synth data, the morph sources, the "
+                    "smoother and data buffers, the delay, chorus and reverb buffers and the "
+                    "lookup tables as reported by the processor, and the unaccounted rest. "
+                    "--editor also measures the heap of opening the editor. The measured totals "
+                    "need glibc.",
+                    run_bench_memory});
+
+    // THE ENGINE OPTIONS WORK WITH EVERY MODE
+    const int result = juce::ConsoleApplication::invokeCatchingFailures([&] {
+        MoniqueBenchHost::engine_options =
+            MoniqueBenchEngineOptions::parse(juce::ArgumentList(argc, argv));
+        return 0;
+    });
+    if (result != 0)
+    {
+        return result;
+    }
+
+    return app.findAndRunCommand(argc, argv);
+}
@@ -0,0 +1,129 @@
+/*
+** Monique is Free and Open Source Software
+**
+** Monique is made available under the Gnu General Public License, v3.0
+** https://www.gnu.org/licenses/gpl-3.0.en.html; The authors of the code
+** reserve the right to re-license their contributions under the MIT license in the
+** future at the discretion of the project maintainers.
+**
+** Copyright 2016-2022 by various individuals as described by the git transaction log
+**
+** All source at: https://github.com/surge-synthesizer/monique-monosynth.git
+**
+** Monique was a commercial product from 2016-2021, with copyright and ownership
+** in that period held by Thomas Arndt at Monoplugs. Thomas made Monique
+** open source in December 2021.
+*/
+
+#include "monique_bench_Commands.h"
+#include "monique_bench_Host.h"
+
+#include "core/monique_core_Datastructures.h"
+#include "core/monique_core_Processor.h"
+
+#include <iomanip>
+#include <iostream>
+
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+// BYTES IN USE ON THE HEAP, -1 IF THE ALLOCATOR CAN NOT TELL US
+static std::int64_t get_heap_in_use() noexcept
+{
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+    const struct mallinfo2 info = mallinfo2();
+    return std::int64_t(info.uordblks + info.hblkhd);
+#else
+    return -1;
+#endif
+}
+
+static void print_bytes_row(const juce::String &name_, std::int64_t bytes_,
+                            std::int64_t total_) noexcept
+{
+    std::cout << std::left << std::setw(24) << name_ << std::right << std::fixed
+              << std::setprecision(1) << std::setw(12) << bytes_ / 1024.0 << std::setw(9)
+              << (total_ > 0 ? 100.0 * bytes_ / total_ : 0.0) << "%" << std::endl;
+}
+
+//==============================================================================
+void run_bench_memory(const juce::ArgumentList &args_)
+{
+    const double sample_rate = get_bench_option(args_, "--rate", 48000.0);
+    const int block_size = int(get_bench_option(args_, "--block", 512.0));
+    const int num_instances = juce::jlimit(1, 64, int(get_bench_option(args_, "--instances", 4.0)));
+    const bool with_editor = args_.containsOption("--editor");
+
+    const bool heap_is_measurable = get_heap_in_use() >= 0;
+    std::cout << "monique-bench memory: " << sample_rate << "Hz, block " << block_size << ", "
+              << num_instances << " instances" << std::endl;
+    if (!heap_is_measurable)
+    {
+        std::cout << "the heap in use is not measurable with this allocator, only the accounted "
+                     "bytes are printed"
+                  << std::endl;
+    }
+
+    // THE FIRST INSTANCE ALSO PAYS FOR THE SHARED SINGLETONS, SO MEASURE MORE THAN ONE
+    juce::OwnedArray<MoniqueBenchHost> hosts;
+    const std::int64_t heap_at_start = get_heap_in_use();
+    hosts.add(new MoniqueBenchHost(sample_rate, block_size));
+    const std::int64_t heap_after_first = get_heap_in_use();
+    for (int i = 1; i < num_instances; ++i)
+    {
+        hosts.add(new MoniqueBenchHost(sample_rate, block_size));
+    }
+    const std::int64_t heap_after_all = get_heap_in_use();
+
+    const std::int64_t first_instance = heap_after_first - heap_at_start;
+    const std::int64_t per_instance =
+        num_instances > 1 ? (heap_after_all - heap_after_first) / (num_instances - 1)
+                          : first_instance;
+
+    MemoryFootprint footprint;
+    MoniqueAudioProcessor &processor = hosts.getFirst()->get_processor();
+    if (with_editor)
+    {
+        const std::int64_t heap_before_editor = get_heap_in_use();
+        std::unique_ptr<juce::AudioProcessorEditor> editor(processor.createEditorIfNeeded());
+        footprint.add(MEMORY_EDITOR, std::size_t(juce::jmax<std::int64_t>(
+                                         0, get_heap_in_use() - heap_before_editor)));
+        editor = nullptr;
+    }
+    processor.collect_memory_footprint(footprint);
+
+    //==========================================================================
+    const std::int64_t accounted = std::int64_t(footprint.get_total());
+    const std::int64_t editor = std::int64_t(footprint.bytes[MEMORY_EDITOR]);
+    const std::int64_t measured = heap_is_measurable ? per_instance + editor : accounted;
+
+    std::cout << std::endl
+              << std::left << std::setw(24) << "CATEGORY" << std::right << std::setw(12) << "KiB"
+              << std::setw(10) << "share" << std::endl;
+    for (int i = 0; i != SUM_MEMORY_CATEGORIES; ++i)
+    {
+        if (i == MEMORY_EDITOR && !with_editor)
+        {
+            continue;
+        }
+        print_bytes_row(MemoryFootprint::get_category_name(i), std::int64_t(footprint.bytes[i]),
+                        measured);
+    }
+    if (heap_is_measurable)
+    {
+        print_bytes_row("UNACCOUNTED", measured - accounted, measured);
+    }
+    print_bytes_row("TOTAL", measured, measured);
+
+    if (heap_is_measurable)
+    {
+        std::cout << std::endl
+                  << "first instance " << std::setprecision(1) << first_instance / 1024.0
+                  << " KiB (with the shared singletons), each further instance "
+                  << per_instance / 1024.0 << " KiB" << std::endl;
+    }
+}
@@ -0,0 +1,123 @@
+/*
+** Monique is Free and Open Source Software
+**
+** Monique is made available under the Gnu General Public License, v3.0
+** https://www.gnu.org/licenses/gpl-3.0.en.html; The authors of the code
+** reserve the right to re-license their contributions under the MIT license in the
+** future at the discretion of the project maintainers.
+**
+** Copyright 2016-2022 by various individuals as described by the git transaction log
+**
+** All source at: https://github.com/surge-synthesizer/monique-monosynth.git
+**
+** Monique was a commercial product from 2016-2021, with copyright and ownership
+** in that period held by Thomas Arndt at Monoplugs. Thomas made Monique
+** open source in December 2021.
+*/
+
+#include "monique_bench_Commands.h"
+#include "monique_bench_Host.h"
+
+#include "core/monique_core_Datastructures.h"
+#include "core/monique_core_Processor.h"
+
+#include <iomanip>
+#include <iostream>
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+static void print_render_header() noexcept
+{
+    std::cout << std::left << std::setw(40) << "PROGRAM" << std::right << std::setw(10) << "RTF"
+              << std::setw(12) << "ns/sample" << std::setw(14) << "mean blk us" << std::setw(14)
+              << "peak blk us" << std::endl;
+}
+static void print_render_stats(const MoniqueBenchHost::RenderStats &stats_) noexcept
+{
+    std::cout << std::left << std::setw(40) << stats_.name.substring(0, 39) << std::right
+              << std::fixed << std::setprecision(4) << std::setw(10)
+              << stats_.get_realtime_factor() << std::setprecision(1) << std::setw(12)
+              << stats_.get_ns_per_sample() << std::setw(14) << stats_.get_mean_block_us()
+              << std::setw(14) << stats_.get_peak_block_us() << std::endl;
+}
+#if MONIQUE_STAGE_TIMING
+// ABSOLUTE TIMES OF THE RENDER, THE STAGES DO NOT OVERLAP AND THE REST OF processBlock IS OTHER
+static void print_stage_timings(const StageTimings &timings_, double cpu_seconds_) noexcept
+{
+    const std::int64_t blocks = timings_.get_sum_blocks();
+    auto print = [&](const char *name_, double seconds_) {
+        std::cout << "    " << std::left << std::setw(14) << name_ << std::right << std::fixed
+                  << std::setprecision(1) << std::setw(10) << seconds_ * 1e3 << " ms"
+                  << std::setprecision(2) << std::setw(10)
+                  << (blocks > 0 ? seconds_ * 1e6 / blocks : 0) << " us/block" << std::endl;
+    };
+
+    double sum_seconds = 0;
+    for (int i = 0; i != SUM_TIMING_STAGES; ++i)
+    {
+        const double seconds = timings_.get_sum_seconds(i);
+        sum_seconds += seconds;
+        print(StageTimings::get_stage_name(i), seconds);
+    }
+    print("OTHER", juce::jmax(0.0, cpu_seconds_ - sum_seconds));
+}
+#endif
+
+//==============================================================================
+void run_bench_render(const juce::ArgumentList &args_)
+{
+    const double seconds = get_bench_option(args_, "--seconds", 10.0);
+    const double sample_rate = get_bench_option(args_, "--rate", 48000.0);
+    const int block_size = int(get_bench_option(args_, "--block", 256.0));
+    const juce::String filter = get_bench_option(args_, "--programs", juce::String());
+
+    MoniqueBenchHost host(sample_rate, block_size);
+    const MoniqueBenchMidiScript script = MoniqueBenchMidiScript::create_default();
+
+    std::cout << "monique-bench render: " << seconds << "s @ " << sample_rate << "Hz, block "
+              << block_size << std::endl;
+    print_render_header();
+
+    MoniqueBenchHost::RenderStats total;
+    total.name = "TOTAL";
+    total.sample_rate = sample_rate;
+
+    auto render_and_print = [&](const juce::String &name_) {
+#if MONIQUE_STAGE_TIMING
+        StageTimings &stage_timings = host.get_processor().info->stage_timings;
+        stage_timings.reset();
+#endif
+        const MoniqueBenchHost::RenderStats stats = host.render(name_, seconds, script);
+        print_render_stats(stats);
+#if MONIQUE_STAGE_TIMING
+        print_stage_timings(stage_timings, stats.cpu_seconds);
+#endif
+
+        total.rendered_samples += stats.rendered_samples;
+        total.rendered_blocks += stats.rendered_blocks;
+        total.cpu_seconds += stats.cpu_seconds;
+        total.peak_block_seconds = juce::jmax(total.peak_block_seconds, stats.peak_block_seconds);
+
+        host.flush(1);
+    };
+
+    if (filter.isEmpty())
+    {
+        host.load_default();
+        render_and_print("FACTORY DEFAULT");
+    }
+
+    const juce::Array<MoniqueBenchHost::Program> programs = host.collect_programs(filter);
+    for (const MoniqueBenchHost::Program &program : programs)
+    {
+        if (!host.load(program))
+        {
+            std::cout << "failed to load " << program.get_full_name() << std::endl;
+            continue;
+        }
+        render_and_print(program.get_full_name());
+    }
+
+    print_render_stats(total);
+}
@@ -0,0 +1,393 @@
+/*
+** Monique is Free and Open Source Software
+**
+** Monique is made available under the Gnu General Public License, v3.0
+** https://www.gnu.org/licenses/gpl-3.0.en.html; The authors of the code
+** reserve the right to re-license their contributions under the MIT license in the
+** future at the discretion of the project maintainers.
+**
+** Copyright 2016-2022 by various individuals as described by the git transaction log
+**
+** All source at: https://github.com/surge-synthesizer/monique-monosynth.git
+**
+** Monique was a commercial product from 2016-2021, with copyright and ownership
+** in that period held by Thomas Arndt at Monoplugs. Thomas made Monique
+** open source in December 2021.
+*/
+
+#include "monique_bench_Commands.h"
+#include "monique_bench_Host.h"
+
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <vector>
+
+// THE CHECKER REPLACES malloc AND pthread_mutex_lock OF THE WHOLE BENCH EXECUTABLE, WHICH WE CAN
+// ONLY DO CLEANLY ON GLIBC. ONLY monique-bench-rtcheck DEFINES MONIQUE_BENCH_RT_CHECK, SO THE
+// TIMING MODES OF monique-bench MEASURE THE PLAIN ALLOCATOR
+#if JUCE_LINUX && MONIQUE_BENCH_RT_CHECK
+#define MONIQUE_RT_CHECK_SUPPORTED 1
+#include <cxxabi.h>
+#include <dlfcn.h>
+#include <execinfo.h>
+#include <pthread.h>
+#else
+#define MONIQUE_RT_CHECK_SUPPORTED 0
+#endif
+
+#if MONIQUE_RT_CHECK_SUPPORTED
+//==============================================================================
+//==============================================================================
+//==============================================================================
+enum RT_VIOLATIONS
+{
+    RT_MALLOC,
+    RT_CALLOC,
+    RT_REALLOC,
+    RT_FREE,
+    RT_MUTEX_LOCK,
+    RT_MUTEX_TRYLOCK,
+
+    SUM_RT_VIOLATIONS
+};
+static const char *const rt_violation_names[SUM_RT_VIOLATIONS] = {
+    "malloc", "calloc", "realloc", "free", "mutex lock", "mutex trylock"};
+
+struct RtViolation
+{
+    enum
+    {
+        MAX_FRAMES = 32,
+        // rt_check_record AND THE HOOK ITSELF
+        SKIPPED_FRAMES = 2
+    };
+
+    int kind;
+    int block_id;
+    std::size_t size;
+    int num_frames;
+    void *frames[MAX_FRAMES];
+};
+
+// THE HOOKS RUN INSIDE malloc, SO THEY ONLY WRITE INTO STORAGE ALLOCATED BEFORE THE CHECK STARTS
+static RtViolation *rt_violations = nullptr;
+static int rt_violations_capacity = 0;
+static std::atomic<int> rt_violations_count(0);
+
+static thread_local bool rt_check_active = false;
+static thread_local bool rt_check_in_hook = false;
+static thread_local int rt_check_block_id = 0;
+
+static void rt_check_record(int kind_, std::size_t size_) noexcept
+{
+    if (!rt_check_active || rt_check_in_hook)
+    {
+        return;
+    }
+
+    rt_check_in_hook = true;
+    const int index = rt_violations_count.fetch_add(1);
+    if (index < rt_violations_capacity)
+    {
+        RtViolation &violation = rt_violations[index];
+        violation.kind = kind_;
+        violation.block_id = rt_check_block_id;
+        violation.size = size_;
+        violation.num_frames = backtrace(violation.frames, RtViolation::MAX_FRAMES);
+    }
+    rt_check_in_hook = false;
+}
+
+//==============================================================================
+// INTERPOSED ALLOCATOR, FORWARDS TO GLIBC. ALIGNED ALLOCATIONS ARE NOT COVERED.
+extern "C"
+{
+    void *__libc_malloc(std::size_t size_);
+    void *__libc_calloc(std::size_t num_, std::size_t size_);
+    void *__libc_realloc(void *ptr_, std::size_t size_);
+    void __libc_free(void *ptr_);
+
+    void *malloc(std::size_t size_) noexcept
+    {
+        rt_check_record(RT_MALLOC, size_);
+        return __libc_malloc(size_);
+    }
+    void *calloc(std::size_t num_, std::size_t size_) noexcept
+    {
+        rt_check_record(RT_CALLOC, num_ * size_);
+        return __libc_calloc(num_, size_);
+    }
+    void *realloc(void *ptr_, std::size_t size_) noexcept
+    {
+        rt_check_record(RT_REALLOC, size_);
+        return __libc_realloc(ptr_, size_);
+    }
+    void free(void *ptr_) noexcept
+    {
+        if (ptr_)
+        {
+            rt_check_record(RT_FREE, 0);
+        }
+        __libc_free(ptr_);
+    }
+}
+
+//==============================================================================
+// INTERPOSED MUTEX, juce::CriticalSection, std::mutex AND THE TIMER THREAD END UP HERE
+using pthread_mutex_function = int (*)(pthread_mutex_t *);
+static pthread_mutex_function real_pthread_mutex_lock = nullptr;
+static pthread_mutex_function real_pthread_mutex_trylock = nullptr;
+
+extern "C"
+{
+    int pthread_mutex_lock(pthread_mutex_t *mutex_) noexcept
+    {
+        if (!real_pthread_mutex_lock)
+        {
+            real_pthread_mutex_lock =
+                reinterpret_cast<pthread_mutex_function>(dlsym(RTLD_NEXT, "pthread_mutex_lock"));
+        }
+        rt_check_record(RT_MUTEX_LOCK, 0);
+        return real_pthread_mutex_lock(mutex_);
+    }
+    int pthread_mutex_trylock(pthread_mutex_t *mutex_) noexcept
+    {
+        if (!real_pthread_mutex_trylock)
+        {
+            real_pthread_mutex_trylock = reinterpret_cast<pthread_mutex_function>(
+                dlsym(RTLD_NEXT, "pthread_mutex_trylock"));
+        }
+        rt_check_record(RT_MUTEX_TRYLOCK, 0);
+        return real_pthread_mutex_trylock(mutex_);
+    }
+}
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+// ARMS THE HOOKS FOR THE AUDIO THREAD WHILE THE PROCESSOR RENDERS A BLOCK
+class RtCheckBlockListener : public MoniqueBenchHost::BlockListener
+{
+  public:
+    void block_started(int block_id_) noexcept override
+    {
+        rt_check_block_id = block_id_;
+        rt_check_active = true;
+    }
+    void block_finished(int) noexcept override { rt_check_active = false; }
+};
+
+// ONE ENTRY PER DISTINCT CALL STACK
+struct RtCallSite
+{
+    int kind;
+    int count;
+    juce::String first_seen_in;
+    int first_block_id;
+};
+
+static juce::String demangle_frame(const char *symbol_) noexcept
+{
+    // FORMAT: path(mangled+0x12) [0x1234]
+    const juce::String symbol(symbol_);
+    const juce::String mangled =
+        symbol.fromFirstOccurrenceOf("(", false, false).upToFirstOccurrenceOf("+", false, false);
+    if (mangled.isEmpty())
+    {
+        return symbol;
+    }
+
+    int status = 0;
+    char *const demangled = abi::__cxa_demangle(mangled.toRawUTF8(), nullptr, nullptr, &status);
+    if (status != 0 || !demangled)
+    {
+        return symbol;
+    }
+    const juce::String result(demangled);
+    std::free(demangled);
+    return result;
+}
+
+//==============================================================================
+void run_bench_rtcheck(const juce::ArgumentList &args_)
+{
+    const double seconds = get_bench_option(args_, "--seconds", 2.0);
+    const double sample_rate = get_bench_option(args_, "--rate", 48000.0);
+    const int block_size = int(get_bench_option(args_, "--block", 64.0));
+    const juce::String filter = get_bench_option(args_, "--programs", juce::String());
+    const int max_blocks = int(get_bench_option(args_, "--max-blocks", 20.0));
+    const int max_stacks = int(get_bench_option(args_, "--max-stacks", 20.0));
+    const int depth = int(get_bench_option(args_, "--depth", 12.0));
+
+    std::vector<RtViolation> storage(1 << 16);
+    rt_violations = storage.data();
+    rt_violations_capacity = int(storage.size());
+
+    // THE FIRST backtrace LOADS THE UNWINDER, WHICH ALLOCATES
+    {
+        void *frames[2];
+        backtrace(frames, 2);
+    }
+
+    MoniqueBenchHost host(sample_rate, block_size);
+    RtCheckBlockListener listener;
+    host.set_block_listener(&listener);
+    const MoniqueBenchMidiScript script = MoniqueBenchMidiScript::create_default();
+
+    std::cout << "monique-bench rtcheck: " << seconds << "s @ " << sample_rate << "Hz, block "
+              << block_size << std::endl;
+    std::cout << std::left << std::setw(40) << "PROGRAM" << std::right << std::setw(8)
+              << "blocks" << std::setw(8) << "bad";
+    for (int kind = 0; kind != SUM_RT_VIOLATIONS; ++kind)
+    {
+        std::cout << std::setw(15) << rt_violation_names[kind];
+    }
+    std::cout << std::endl;
+
+    std::map<std::vector<void *>, RtCallSite> call_sites;
+    juce::StringArray bad_blocks;
+    int sum_violations = 0;
+
+    auto check = [&](const juce::String &name_) {
+        rt_violations_count = 0;
+        const MoniqueBenchHost::RenderStats stats = host.render(name_, seconds, script);
+        const int dropped = juce::jmax(0, rt_violations_count.load() - rt_violations_capacity);
+        const int num_violations = rt_violations_count.load() - dropped;
+        sum_violations += num_violations;
+
+        // COUNT PER KIND AND PER BLOCK, COLLECT THE DISTINCT STACKS
+        int per_kind[SUM_RT_VIOLATIONS] = {};
+        std::map<int, juce::Array<int>> per_block;
+        for (int i = 0; i != num_violations; ++i)
+        {
+            const RtViolation &violation = rt_violations[i];
+            ++per_kind[violation.kind];
+            per_block[violation.block_id].add(violation.kind);
+
+            std::vector<void *> key;
+            for (int frame = RtViolation::SKIPPED_FRAMES; frame < violation.num_frames; ++frame)
+            {
+                key.push_back(violation.frames[frame]);
+            }
+            auto call_site = call_sites.find(key);
+            if (call_site == call_sites.end())
+            {
+                call_sites[key] = RtCallSite{violation.kind, 1, name_, violation.block_id};
+            }
+            else
+            {
+                ++call_site->second.count;
+            }
+        }
+
+        std::cout << std::left << std::setw(40) << name_.substring(0, 39) << std::right
+                  << std::setw(8) << stats.rendered_blocks << std::setw(8) << per_block.size();
+        for (int kind = 0; kind != SUM_RT_VIOLATIONS; ++kind)
+        {
+            std::cout << std::setw(15) << per_kind[kind];
+        }
+        if (dropped > 0)
+        {
+            std::cout << "  (" << dropped << " not recorded)";
+        }
+        std::cout << std::endl;
+
+        for (const auto &block : per_block)
+        {
+            if (bad_blocks.size() >= max_blocks)
+            {
+                break;
+            }
+            int counts[SUM_RT_VIOLATIONS] = {};
+            for (const int kind : block.second)
+            {
+                ++counts[kind];
+            }
+            juce::String line = name_ + " block " + juce::String(block.first) + " (sample " +
+                                juce::String(std::int64_t(block.first) * block_size) + "):";
+            for (int kind = 0; kind != SUM_RT_VIOLATIONS; ++kind)
+            {
+                if (counts[kind] > 0)
+                {
+                    line << " " << counts[kind] << " " << rt_violation_names[kind];
+                }
+            }
+            bad_blocks.add(line);
+        }
+
+        host.flush(1);
+    };
+
+    if (filter.isEmpty())
+    {
+        host.load_default();
+        check("FACTORY DEFAULT");
+    }
+    for (const MoniqueBenchHost::Program &program : host.collect_programs(filter))
+    {
+        if (host.load(program))
+        {
+            check(program.get_full_name());
+        }
+    }
+
+    host.set_block_listener(nullptr);
+    rt_violations = nullptr;
+    rt_violations_capacity = 0;
+
+    //==========================================================================
+    // REPORT
+    std::cout << std::endl << "FIRST BLOCKS WITH VIOLATIONS" << std::endl;
+    for (const juce::String &line : bad_blocks)
+    {
+        std::cout << "  " << line << std::endl;
+    }
+
+    std::vector<std::pair<std::vector<void *>, RtCallSite>> sorted(call_sites.begin(),
+                                                                   call_sites.end());
+    std::sort(sorted.begin(), sorted.end(), [](const auto &a_, const auto &b_) {
+        return a_.second.count > b_.second.count;
+    });
+
+    std::cout << std::endl
+              << sorted.size() << " DISTINCT CALL STACKS, " << sum_violations << " VIOLATIONS"
+              << std::endl;
+    for (int i = 0; i < int(sorted.size()) && i < max_stacks; ++i)
+    {
+        const std::vector<void *> &frames = sorted[i].first;
+        const RtCallSite &call_site = sorted[i].second;
+        std::cout << std::endl
+                  << "#" << i + 1 << " " << rt_violation_names[call_site.kind] << " x"
+                  << call_site.count << ", first in " << call_site.first_seen_in << " block "
+                  << call_site.first_block_id << std::endl;
+
+        const int num_frames = juce::jmin(depth, int(frames.size()));
+        char **const symbols = backtrace_symbols(frames.data(), num_frames);
+        for (int frame = 0; frame != num_frames; ++frame)
+        {
+            std::cout << "    " << (symbols ? demangle_frame(symbols[frame]) : juce::String())
+                      << std::endl;
+        }
+        std::free(symbols);
+    }
+
+    if (sum_violations > 0)
+    {
+        juce::ConsoleApplication::fail(juce::String(sum_violations) +
+                                       " real-time violations on the audio thread");
+    }
+}
+#else
+//==============================================================================
+void run_bench_rtcheck(const juce::ArgumentList &)
+{
+#if JUCE_LINUX
+    juce::ConsoleApplication::fail("rtcheck runs in monique-bench-rtcheck, this build does not "
+                                   "interpose malloc and pthread");
+#else
+    juce::ConsoleApplication::fail("rtcheck needs glibc to interpose malloc and pthread");
+#endif
+}
+#endif
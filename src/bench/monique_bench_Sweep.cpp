@@ -0,0 +1,234 @@
+/*
+** Monique is Free and Open Source Software
+**
+** Monique is made available under the Gnu General Public License, v3.0
+** https://www.gnu.org/licenses/gpl-3.0.en.html; The authors of the code
+** reserve the right to re-license their contributions under the MIT license in the
+** future at the discretion of the project maintainers.
+**
+** Copyright 2016-2022 by various individuals as described by the git transaction log
+**
+** All source at: https://github.com/surge-synthesizer/monique-monosynth.git
+**
+** Monique was a commercial product from 2016-2021, with copyright and ownership
+** in that period held by Thomas Arndt at Monoplugs. Thomas made Monique
+** open source in December 2021.
+*/
+
+#include "monique_bench_Commands.h"
+#include "monique_bench_Host.h"
+
+#include "version.h"
+
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+struct SweepPoint
+{
+    double sample_rate;
+    int block_size;
+    std::int64_t rendered_blocks;
+    std::int64_t rendered_samples;
+    double cpu_seconds;
+
+    double get_mean_block_us() const noexcept
+    {
+        return rendered_blocks > 0 ? cpu_seconds / rendered_blocks * 1e6 : 0;
+    }
+    double get_ns_per_sample() const noexcept
+    {
+        return rendered_samples > 0 ? cpu_seconds / rendered_samples * 1e9 : 0;
+    }
+};
+
+// cpu_seconds = fixed_per_block * blocks + per_sample * samples
+struct SweepFit
+{
+    double fixed_per_block_us;
+    double per_sample_ns;
+    double max_relative_error;
+};
+
+// LEAST SQUARES ON THE RELATIVE ERROR, OTHERWISE THE BIG BLOCKS DECIDE THE FIT ALONE
+static SweepFit fit_sweep(const juce::Array<SweepPoint> &points_) noexcept
+{
+    double bb = 0, bs = 0, ss = 0, bt = 0, st = 0;
+    for (const SweepPoint &point : points_)
+    {
+        if (point.cpu_seconds <= 0)
+        {
+            continue;
+        }
+        const double b = point.rendered_blocks / point.cpu_seconds;
+        const double s = point.rendered_samples / point.cpu_seconds;
+        bb += b * b;
+        bs += b * s;
+        ss += s * s;
+        bt += b;
+        st += s;
+    }
+
+    SweepFit fit{0, 0, 0};
+    const double det = bb * ss - bs * bs;
+    if (std::abs(det) <= 0)
+    {
+        return fit;
+    }
+    const double fixed_per_block = (bt * ss - st * bs) / det;
+    const double per_sample = (st * bb - bt * bs) / det;
+    fit.fixed_per_block_us = fixed_per_block * 1e6;
+    fit.per_sample_ns = per_sample * 1e9;
+
+    for (const SweepPoint &point : points_)
+    {
+        if (point.cpu_seconds <= 0)
+        {
+            continue;
+        }
+        const double model =
+            fixed_per_block * point.rendered_blocks + per_sample * point.rendered_samples;
+        fit.max_relative_error = juce::jmax(
+            fit.max_relative_error, std::abs(model - point.cpu_seconds) / point.cpu_seconds);
+    }
+
+    return fit;
+}
+
+template <typename T>
+static juce::Array<T> parse_list(const juce::String &list_, T min_, T max_) noexcept
+{
+    juce::Array<T> values;
+    for (const juce::String &token : juce::StringArray::fromTokens(list_, ",", ""))
+    {
+        const T value = T(token.trim().getDoubleValue());
+        if (value >= min_ && value <= max_)
+        {
+            values.addIfNotAlreadyThere(value);
+        }
+    }
+    values.sort();
+    return values;
+}
+
+//==============================================================================
+void run_bench_sweep(const juce::ArgumentList &args_)
+{
+    const double seconds = get_bench_option(args_, "--seconds", 2.0);
+    const juce::Array<int> block_sizes = parse_list<int>(
+        get_bench_option(args_, "--blocks",
+                         juce::String("1,2,4,8,16,32,64,128,256,512,1024,2048,4096")),
+        1, 1 << 16);
+    const juce::Array<double> sample_rates = parse_list<double>(
+        get_bench_option(args_, "--rates", juce::String("44100,48000,88200,96000,176400,192000")),
+        8000.0, 768000.0);
+    const juce::String filter = get_bench_option(args_, "--programs", juce::String());
+    const juce::File csv_file =
+        juce::File::getCurrentWorkingDirectory().getChildFile(
+            get_bench_option(args_, "--csv", juce::String()));
+    const bool write_csv = args_.containsOption("--csv");
+
+    if (block_sizes.isEmpty() || sample_rates.isEmpty())
+    {
+        juce::ConsoleApplication::fail("sweep needs at least one block size and one sample rate");
+    }
+
+    MoniqueBenchHost host(sample_rates.getFirst(), block_sizes.getFirst());
+    const MoniqueBenchMidiScript script = MoniqueBenchMidiScript::create_default();
+    // WITHOUT --programs ONLY THE FACTORY DEFAULT, THE FULL GRID OVER ALL PROGRAMS TAKES HOURS
+    const juce::Array<MoniqueBenchHost::Program> programs =
+        filter.isEmpty() ? juce::Array<MoniqueBenchHost::Program>() : host.collect_programs(filter);
+    if (!filter.isEmpty() && programs.isEmpty())
+    {
+        juce::ConsoleApplication::fail("no program matches " + filter);
+    }
+
+    std::cout << "monique-bench sweep: " << seconds << "s per program and setup, "
+              << (filter.isEmpty() ? juce::String("FACTORY DEFAULT") : filter) << " ("
+              << juce::jmax(1, programs.size()) << " programs)" << std::endl;
+
+    // ONE ROW PER SETUP, THE FIT OF ITS SAMPLE RATE IS REPEATED IN EVERY ROW
+    juce::String csv;
+    csv << "version,sample_rate,block_size,blocks,samples,cpu_seconds,fixed_per_block_us,"
+           "ns_per_sample\n";
+
+    juce::Array<SweepFit> fits;
+    for (const double sample_rate : sample_rates)
+    {
+        std::cout << std::endl
+                  << std::fixed << std::setprecision(0) << sample_rate << "Hz" << std::endl;
+        std::cout << std::right << std::setw(8) << "block" << std::setw(12) << "ns/sample"
+                  << std::setw(14) << "mean blk us" << std::setw(12) << "fixed %" << std::endl;
+
+        juce::Array<SweepPoint> points;
+        for (const int block_size : block_sizes)
+        {
+            host.prepare(sample_rate, block_size);
+
+            SweepPoint point{sample_rate, block_size, 0, 0, 0};
+            auto render = [&](const juce::String &name_) {
+                const MoniqueBenchHost::RenderStats stats = host.render(name_, seconds, script);
+                point.rendered_blocks += stats.rendered_blocks;
+                point.rendered_samples += stats.rendered_samples;
+                point.cpu_seconds += stats.cpu_seconds;
+                host.flush(1);
+            };
+            if (filter.isEmpty())
+            {
+                host.load_default();
+                render("FACTORY DEFAULT");
+            }
+            for (const MoniqueBenchHost::Program &program : programs)
+            {
+                if (host.load(program))
+                {
+                    render(program.get_full_name());
+                }
+            }
+            points.add(point);
+        }
+
+        // THE SHARE OF THE FIXED PART IS ONLY KNOWN AFTER THE FIT
+        const SweepFit fit = fit_sweep(points);
+        fits.add(fit);
+        for (const SweepPoint &point : points)
+        {
+            const double fixed_share =
+                point.get_mean_block_us() > 0
+                    ? juce::jlimit(0.0, 1.0, fit.fixed_per_block_us / point.get_mean_block_us())
+                    : 0;
+            std::cout << std::setw(8) << point.block_size << std::setprecision(1)
+                      << std::setw(12) << point.get_ns_per_sample() << std::setw(14)
+                      << point.get_mean_block_us() << std::setw(11) << fixed_share * 100 << "%"
+                      << std::endl;
+
+            csv << Monique::Build::FullVersionStr << "," << sample_rate << ","
+                << point.block_size << "," << point.rendered_blocks << ","
+                << point.rendered_samples << "," << juce::String(point.cpu_seconds, 9) << ","
+                << juce::String(fit.fixed_per_block_us, 6) << ","
+                << juce::String(fit.per_sample_ns, 6) << "\n";
+        }
+    }
+
+    //==========================================================================
+    std::cout << std::endl
+              << "FIT: cpu = fixed_per_block * blocks + per_sample * samples" << std::endl;
+    std::cout << std::right << std::setw(10) << "rate" << std::setw(18) << "fixed us/block"
+              << std::setw(16) << "ns/sample" << std::setw(14) << "max error" << std::endl;
+    for (int i = 0; i != sample_rates.size(); ++i)
+    {
+        const SweepFit &fit = fits.getReference(i);
+        std::cout << std::setw(10) << std::setprecision(0) << sample_rates[i] << std::setw(18)
+                  << std::setprecision(3) << fit.fixed_per_block_us << std::setw(16)
+                  << std::setprecision(2) << fit.per_sample_ns << std::setw(13)
+                  << std::setprecision(1) << fit.max_relative_error * 100 << "%" << std::endl;
+    }
+
+    if (write_csv && !csv_file.replaceWithText(csv))
+    {
+        juce::ConsoleApplication::fail("can not write " + csv_file.getFullPathName());
+    }
+}
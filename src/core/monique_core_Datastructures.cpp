@@ -122,11 +122,110 @@ COLD void RuntimeNotifyer::set_block_size(int bs_) noexcept
     }
 }
 
+//==============================================================================
+//==============================================================================
+//==============================================================================
+const char *StageTimings::get_stage_name(int stage_) noexcept
+{
+    switch (stage_)
+    {
+    case TIMING_SMOOTH_1:
+        return "SMOOTH OSC 1";
+    case TIMING_SMOOTH_2:
+        return "SMOOTH OSC 2";
+    case TIMING_SMOOTH_3:
+        return "SMOOTH OSC 3";
+    case TIMING_SMOOTH_4:
+        return "SMOOTH 4";
+    case TIMING_FILTER_1:
+        return "FILTER 1";
+    case TIMING_FILTER_2:
+        return "FILTER 2";
+    case TIMING_FILTER_3:
+        return "FILTER 3";
+    case TIMING_EQ:
+        return "EQ";
+    case TIMING_FX_ENV:
+        return "AMP ENV";
+    case TIMING_FX_CHORUS:
+        return "CHORUS";
+    case TIMING_FX_DELAY:
+        return "DELAY";
+    case TIMING_FX_REVERB:
+        return "REVERB";
+    case TIMING_FX_OUTPUT:
+        return "OUTPUT";
+    default:
+        return "";
+    }
+}
+void StageTimings::reset() noexcept
+{
+    for (int i = 0; i != SUM_TIMING_STAGES; ++i)
+    {
+        smoothed_us[i].store(0, std::memory_order_relaxed);
+        sum_seconds[i].store(0, std::memory_order_relaxed);
+    }
+    smoothed_block_us.store(0, std::memory_order_relaxed);
+    sum_blocks.store(0, std::memory_order_relaxed);
+}
+
+//==============================================================================
+const char *LoadTimings::get_stage_name(int stage_) noexcept
+{
+    switch (stage_)
+    {
+    case LOAD_TIMING_PARSE:
+        return "PARSE";
+    case LOAD_TIMING_PARAMETERS:
+        return "PARAMETERS";
+    case LOAD_TIMING_MORPH_SOURCES:
+        return "MORPH SOURCES";
+    case LOAD_TIMING_MORPH:
+        return "MORPH";
+    case LOAD_TIMING_BACKUP:
+        return "BACKUP";
+    case LOAD_TIMING_MIDI_FEEDBACK:
+        return "MIDI FEEDBACK";
+    default:
+        return "";
+    }
+}
+
+//==============================================================================
+const char *MemoryFootprint::get_category_name(int category_) noexcept
+{
+    switch (category_)
+    {
+    case MEMORY_SYNTH_DATA:
+        return "SYNTH DATA";
+    case MEMORY_MORPH_SOURCES:
+        return "MORPH SOURCES";
+    case MEMORY_SMOOTHERS:
+        return "SMOOTHERS";
+    case MEMORY_DATA_BUFFER:
+        return "DATA BUFFER";
+    case MEMORY_DELAY:
+        return "DELAY";
+    case MEMORY_CHORUS:
+        return "CHORUS";
+    case MEMORY_REVERB:
+        return "REVERB";
+    case MEMORY_LOOKUP_TABLES:
+        return "LOOKUP TABLES";
+    case MEMORY_EDITOR:
+        return "EDITOR";
+    default:
+        return "";
+    }
+}
+
 //==============================================================================
 //==============================================================================
 //==============================================================================
 COLD RuntimeInfo::RuntimeInfo() noexcept
-    : samples_since_start(0), relative_samples_since_start(0), bpm(120), steps_per_sample(0)
+    : samples_since_start(0), relative_samples_since_start(0), bpm(120), steps_per_sample(0),
+      pre_fx_capture(nullptr)
 {
     if (is_standalone())
     {
@@ -1624,6 +1723,32 @@ COLD MoniqueSynthData::MoniqueSynthData(DATA_TYPES data_type, UiLookAndFeel *loo
                       generate_param_name(SYNTH_DATA_NAME, MASTER, "ui_scale_factor"),
                       generate_short_human_name("CONF", "ui_scale_factor")),
 
+      // -------------------------------------------------------------
+      only_active_osc_waves(true,
+                            generate_param_name(SYNTH_DATA_NAME, MASTER, "only_active_osc_waves"),
+                            generate_short_human_name("ENGINE", "only_active_osc_waves")),
+      osc_engine(MIN_MAX(OSC_ENGINE_BLIT, SUM_OSC_ENGINES - 1), OSC_ENGINE_BLIT,
+                 generate_param_name(SYNTH_DATA_NAME, MASTER, "osc_engine"),
+                 generate_short_human_name("ENGINE", "osc_engine")),
+      atan_accuracy(MIN_MAX(ATAN_EXACT, SUM_ATAN_ACCURACIES - 1), ATAN_EXACT,
+                    generate_param_name(SYNTH_DATA_NAME, MASTER, "atan_accuracy"),
+                    generate_short_human_name("ENGINE", "atan_accuracy")),
+      filter_coefficient_rate(MIN_MAX(1, 16), 1,
+                              generate_param_name(SYNTH_DATA_NAME, MASTER,
+                                                  "filter_coefficient_rate"),
+                              generate_short_human_name("ENGINE", "filter_coefficient_rate")),
+      control_rate(MIN_MAX(CONTROL_RATE_1, SUM_CONTROL_RATES - 1), CONTROL_RATE_1,
+                   generate_param_name(SYNTH_DATA_NAME, MASTER, "control_rate"),
+                   generate_short_human_name("ENGINE", "control_rate")),
+      filter_oversampling(MIN_MAX(FILTER_OVERSAMPLING_OFF, SUM_FILTER_OVERSAMPLINGS - 1),
+                          FILTER_OVERSAMPLING_OFF,
+                          generate_param_name(SYNTH_DATA_NAME, MASTER, "filter_oversampling"),
+                          generate_short_human_name("ENGINE", "filter_oversampling")),
+      render_filter_oversampling(
+          MIN_MAX(FILTER_OVERSAMPLING_OFF, SUM_FILTER_OVERSAMPLINGS - 1), FILTER_OVERSAMPLING_OFF,
+          generate_param_name(SYNTH_DATA_NAME, MASTER, "render_filter_oversampling"),
+          generate_short_human_name("ENGINE", "render_filter_oversampling")),
+
       // -------------------------------------------------------------
       midi_lfo_wave(MIN_MAX(0, 1), 0, 1000, generate_param_name("MIDI", 0, "lfo_wave"),
                     generate_short_human_name("POPUP", "lfo_wave")),
@@ -1697,7 +1822,7 @@ COLD MoniqueSynthData::MoniqueSynthData(DATA_TYPES data_type, UiLookAndFeel *loo
 
       alternative_program_name("NO PROGRAM SELECTED"), error_string("ERROR"),
 
-      force_morph_update__load_flag(false),
+      force_morph_update__load_flag(false), load_timings(nullptr),
 
       program_restore_block_time(1500)
 {
@@ -1839,6 +1964,60 @@ COLD MoniqueSynthData::~MoniqueSynthData() noexcept
     }
 }
 //==============================================================================
+COLD std::size_t MoniqueSynthData::get_memory_usage() const noexcept
+{
+    std::size_t bytes = sizeof(MoniqueSynthData) + sizeof(ENVData) + sizeof(FMOscData) +
+                        sizeof(EQData) + sizeof(ArpSequencerData) + sizeof(ReverbData) +
+                        sizeof(ChorusData);
+    bytes += (lfo_datas.size() + mfo_datas.size()) * sizeof(LFOData);
+    bytes += osc_datas.size() * sizeof(OSCData);
+    for (const FilterData *filter_data : filter_datas)
+    {
+        bytes += sizeof(FilterData) + sizeof(ENVData);
+        bytes += filter_data->input_smoothers.size() * sizeof(SmoothedParameter);
+        bytes += filter_data->input_envs.size() * sizeof(ENVData);
+    }
+    bytes += eq_data->velocity_smoothers.size() * sizeof(SmoothedParameter);
+    bytes += eq_data->envs.size() * sizeof(ENVData);
+    bytes += arp_sequencer_data->velocity_smoothers.size() * sizeof(SmoothedParameter);
+    if (tuning)
+    {
+        bytes += sizeof(MoniqueTuningData);
+    }
+    if (morph_group_1)
+    {
+        bytes += 4 * sizeof(MorphGroup);
+    }
+
+    for (const Parameter *param : all_parameters)
+    {
+        bytes += param->get_memory_usage();
+    }
+    bytes += std::size_t(saveable_parameters.size() + automateable_parameters.size() +
+                         global_parameters.size() + all_parameters.size() +
+                         mono_parameters.size()) *
+                 sizeof(Parameter *) +
+             saveable_backups.size() * sizeof(float);
+
+    return bytes;
+}
+COLD void MoniqueSynthData::collect_memory_footprint(MemoryFootprint &footprint_) const noexcept
+{
+    footprint_.add(MEMORY_SYNTH_DATA, get_memory_usage());
+    for (int i = 0; i != left_morph_sources.size(); ++i)
+    {
+        footprint_.add(MEMORY_MORPH_SOURCES,
+                       left_morph_sources.getUnchecked(i)->get_memory_usage());
+        footprint_.add(MEMORY_MORPH_SOURCES,
+                       right_morph_sources.getUnchecked(i)->get_memory_usage());
+    }
+    if (id == MASTER)
+    {
+        footprint_.add(MEMORY_SMOOTHERS, smooth_manager->get_memory_usage());
+        footprint_.add(MEMORY_LOOKUP_TABLES, 3 * (LOOKUP_TABLE_SIZE + 1) * sizeof(float));
+    }
+}
+//==============================================================================
 void MoniqueSynthData::set_to_stereo(bool state_) noexcept
 {
     for (int i = 0; i != mono_parameters.size(); ++i)
@@ -2032,6 +2211,14 @@ COLD void MoniqueSynthData::colect_global_parameters() noexcept
     global_parameters.add(&ui_is_large);
     global_parameters.add(&ui_scale_factor);
 
+    global_parameters.add(&only_active_osc_waves);
+    global_parameters.add(&osc_engine);
+    global_parameters.add(&atan_accuracy);
+    global_parameters.add(&filter_coefficient_rate);
+    global_parameters.add(&control_rate);
+    global_parameters.add(&filter_oversampling);
+    global_parameters.add(&render_filter_oversampling);
+
     global_parameters.add(&midi_pickup_offset);
     // global_parameters.add( &ctrl );
 
@@ -3359,10 +3546,12 @@ bool MoniqueSynthData::load(const juce::String bank_name_, const juce::String pr
                             bool load_morph_groups, bool ignore_warnings_) noexcept
 {
     bool success = false;
+    LoadLapTimer lap_timer(load_timings);
     juce::File program_file = get_program_file(bank_name_, program_name_);
     // last_bank = bank_name_;
     // last_program = program_name_;
     auto xml = juce::XmlDocument(program_file).getDocumentElement();
+    lap_timer.lap(LOAD_TIMING_PARSE);
     if (xml)
     {
         if (xml->hasTagName("PROJECT-1.0") || xml->hasTagName("MONOLisa"))
@@ -3471,6 +3660,8 @@ void MoniqueSynthData::read_from(const juce::XmlElement *xml_) noexcept
 {
     if (xml_)
     {
+        LoadLapTimer lap_timer(load_timings);
+
         // PARAMS
         {
             for (int i = 0; i != saveable_parameters.size(); ++i)
@@ -3494,6 +3685,7 @@ void MoniqueSynthData::read_from(const juce::XmlElement *xml_) noexcept
                 */
             }
         }
+        lap_timer.lap(LOAD_TIMING_PARAMETERS);
 
         // MORPH STUFF
         if (id == MASTER)
@@ -3514,6 +3706,7 @@ void MoniqueSynthData::read_from(const juce::XmlElement *xml_) noexcept
                     juce::String("RightMorphData_") + juce::String(morpher_id)));
                 force_morph_update__load_flag = true;
             }
+            lap_timer.lap(LOAD_TIMING_MORPH_SOURCES);
 
             for (int morpher_id = 0; morpher_id != SUM_MORPHER_GROUPS; ++morpher_id)
             {
@@ -3521,6 +3714,7 @@ void MoniqueSynthData::read_from(const juce::XmlElement *xml_) noexcept
                 // morhp_states[morpher_id].notify_value_listeners();
                 morph(morpher_id, morhp_states[morpher_id], true);
             }
+            lap_timer.lap(LOAD_TIMING_MORPH);
 
             // FORCE STOP ARP
             // if( was_arp_on && !arp_sequencer_data->is_on )
@@ -3542,6 +3736,7 @@ void MoniqueSynthData::read_from(const juce::XmlElement *xml_) noexcept
             create_internal_backup(
                 program_names_per_bank.getReference(current_bank)[current_program],
                 banks[current_bank]);
+            lap_timer.lap(LOAD_TIMING_BACKUP);
 
             // UPDATE MIDI
             for (int i = 0; i != saveable_parameters.size(); ++i)
@@ -3549,6 +3744,7 @@ void MoniqueSynthData::read_from(const juce::XmlElement *xml_) noexcept
                 Parameter *param = saveable_parameters.getUnchecked(i);
                 param->midi_control->send_feedback_only();
             }
+            lap_timer.lap(LOAD_TIMING_MIDI_FEEDBACK);
         }
     }
 }
@@ -3784,6 +3980,44 @@ void MoniqueTuningData::updateMTSESPStatus()
     mtsChecked++;
 }
 
+void MoniqueTuningData::update_frequency_cache()
+{
+    // MTS-ESP CAN RETUNE AT ANY TIME, THE OTHER MODES ONLY CHANGE WITH THE MODE
+    if (mode == MTS_ESP)
+    {
+        cached_mode = mode;
+        ++cache_block;
+        return;
+    }
+    if (cached_mode == mode)
+    {
+        return;
+    }
+    cached_mode = mode;
+
+    for (int note = 0; note != 129; ++note)
+    {
+        refresh_note(note);
+    }
+}
+
+void MoniqueTuningData::refresh_note(int note)
+{
+    note_blocks[note] = cache_block;
+    if (note == 128)
+    {
+        if (note_blocks[127] != cache_block)
+        {
+            refresh_note(127);
+        }
+        note_frequencies[128] = note_frequencies[127] * std::pow(2.0f, 1.0f / 12);
+    }
+    else
+    {
+        note_frequencies[note] = midiNoteToFrequency(float(note));
+    }
+}
+
 float MoniqueTuningData::midiNoteFromMTS(float note)
 {
     auto idx = (int)floor(note);
@@ -54,6 +54,53 @@ enum WAVE_TYPES
     NOICE
 };
 
+//==============================================================================
+enum OSC_ENGINES
+{
+    OSC_ENGINE_BLIT,
+    OSC_ENGINE_POLYBLEP,
+
+    SUM_OSC_ENGINES
+};
+
+//==============================================================================
+// THE DEFAULT IS std::atan, THE POLYNOMIALS ARE OPT IN
+enum ATAN_ACCURACIES
+{
+    ATAN_EXACT,
+    ATAN_PRECISE,
+    ATAN_FAST,
+
+    SUM_ATAN_ACCURACIES
+};
+
+//==============================================================================
+// THE SMOOTHERS AND LFOS CALCULATE EVERY 1, 8, 16 OR 32 SAMPLES AND RAMP IN BETWEEN. THE DEFAULT
+// IS EXACT, THE OTHER RATES ARE OPT IN
+enum CONTROL_RATES
+{
+    CONTROL_RATE_1,
+    CONTROL_RATE_8,
+    CONTROL_RATE_16,
+    CONTROL_RATE_32,
+
+    SUM_CONTROL_RATES
+};
+
+//==============================================================================
+// THE PER SAMPLE PARAMETERS AND WORKERS OF mono_Reverb::process_block
+enum REVERB_BUFFERS
+{
+    REVERB_FEEDBACK,
+    REVERB_WET_GAIN_1,
+    REVERB_WET_GAIN_2,
+    REVERB_DRY_LEVEL,
+    REVERB_INPUT,
+    REVERB_OUTPUT,
+
+    SUM_REVERB_BUFFERS
+};
+
 //==============================================================================
 enum FILTER_TYPS
 {
@@ -101,6 +148,33 @@ enum MONIQUE_SETUP
 #endif
 };
 
+//==============================================================================
+// AROUND THE FILTER DISTORTION AND THE FILTERS, ONE SETTING LIVE AND ONE FOR RENDERS. BOTH ARE OFF
+// BY DEFAULT, SO RENDERS SOUND LIKE THE LIVE PLAYBACK UNTIL THE USER PICKS 2X OR 4X FOR THEM
+enum FILTER_OVERSAMPLINGS
+{
+    FILTER_OVERSAMPLING_OFF,
+    FILTER_OVERSAMPLING_2X,
+    FILTER_OVERSAMPLING_4X,
+
+    SUM_FILTER_OVERSAMPLINGS,
+
+    MAX_FILTER_OVERSAMPLING = 4
+};
+
+// THE OVERSAMPLED INPUTS, OUTPUTS AND PARAMETERS OF ONE FILTER, MAX_FILTER_OVERSAMPLING TIMES
+// THE BLOCK SIZE
+enum FILTER_OVERSAMPLING_BUFFERS
+{
+    OVERSAMPLED_INPUTS,
+    OVERSAMPLED_OUTPUTS = OVERSAMPLED_INPUTS + SUM_INPUTS_PER_FILTER,
+    OVERSAMPLED_RESONANCE = OVERSAMPLED_OUTPUTS + SUM_INPUTS_PER_FILTER,
+    OVERSAMPLED_CUTOFF,
+    OVERSAMPLED_DISTORTION,
+
+    SUM_FILTER_OVERSAMPLING_BUFFERS
+};
+
 //==============================================================================
 
 enum PLAY_MODES
@@ -137,49 +211,112 @@ enum TRACKING_MODES
 //==============================================================================
 //==============================================================================
 //==============================================================================
+// EVERY CHANNEL OF THE DataBuffer STARTS ON A CACHE LINE, SO SIMD CAN ALWAYS LOAD ALIGNED
+#define DATA_BUFFER_ALIGNMENT 64
+
+// THE CHANNELS OF ONE WORKER INSIDE THE ARENA OF THE DataBuffer, WHICH OWNS THE MEMORY
+template <int num_channels> class mono_ArenaBuffer
+{
+    float *channels[num_channels];
+    int size;
+
+  public:
+    inline const float *getReadPointer(int channel_ = 0) const noexcept
+    {
+        return channels[channel_];
+    }
+    inline float *getWritePointer(int channel_ = 0) noexcept { return channels[channel_]; }
+
+    inline int get_size() const noexcept { return size; }
+    inline void clear() noexcept
+    {
+        for (int channel = 0; channel != num_channels; ++channel)
+        {
+            juce::FloatVectorOperations::clear(channels[channel], size);
+        }
+    }
+
+    //==========================================================================
+    // FLOATS FROM ONE CHANNEL TO THE NEXT, size_ ROUNDED UP TO THE ALIGNMENT
+    static inline std::size_t get_stride(int size_) noexcept
+    {
+        const std::size_t floats_per_line = DATA_BUFFER_ALIGNMENT / sizeof(float);
+        return (std::size_t(size_) + floats_per_line - 1) / floats_per_line * floats_per_line;
+    }
+    // PUTS THE CHANNELS AT arena_ + offset_ AND RETURNS THE OFFSET BEHIND THEM. WITHOUT AN
+    // arena_ IT ONLY COUNTS
+    inline std::size_t place(float *const arena_, const std::size_t offset_, int size_) noexcept
+    {
+        const std::size_t stride = get_stride(size_);
+        size = size_;
+        for (int channel = 0; channel != num_channels; ++channel)
+        {
+            channels[channel] = arena_ ? arena_ + offset_ + channel * stride : nullptr;
+        }
+        return offset_ + num_channels * stride;
+    }
+
+    //==========================================================================
+    COLD mono_ArenaBuffer() noexcept : channels(), size(0) {}
+
+    JUCE_DECLARE_NON_COPYABLE(mono_ArenaBuffer)
+};
+
 class MoniqueAudioProcessor;
 class mono_AudioDeviceManager;
 class DataBuffer // DEFINITION IN SYNTH.CPP
 {
     int size;
 
+    // ALL WORKERS IN ONE BLOCK, IN THE ORDER OF THE MEMBERS BELOW
+    juce::HeapBlock<char> arena;
+    std::size_t arena_bytes;
+
   public:
     // ==============================================================================
     // WORKERS
     // TODO REDUCE TO NEEDED
-    mono_AudioSampleBuffer<SUM_EQ_BANDS> band_env_buffers;
-    mono_AudioSampleBuffer<SUM_EQ_BANDS> band_out_buffers;
+    mono_ArenaBuffer<SUM_EQ_BANDS> band_env_buffers;
+    mono_ArenaBuffer<SUM_EQ_BANDS> band_out_buffers;
 
-    mono_AudioSampleBuffer<SUM_FILTERS> lfo_amplitudes;
-    mono_AudioSampleBuffer<SUM_MORPHER_GROUPS> mfo_amplitudes;
-    mono_AudioSampleBuffer<SUM_FILTERS * 2> filter_output_samples_l_r;
-    mono_AudioSampleBuffer<2> filter_stereo_output_samples;
+    mono_ArenaBuffer<SUM_FILTERS> lfo_amplitudes;
+    mono_ArenaBuffer<SUM_MORPHER_GROUPS> mfo_amplitudes;
+    mono_ArenaBuffer<SUM_FILTERS * 2> filter_output_samples_l_r;
+    mono_ArenaBuffer<2> filter_stereo_output_samples;
 
-    mono_AudioSampleBuffer<SUM_OSCS> osc_samples;
-    mono_AudioSampleBuffer<1> osc_switchs;
-    mono_AudioSampleBuffer<1> osc_sync_switchs;
-    mono_AudioSampleBuffer<1> modulator_samples;
+    mono_ArenaBuffer<SUM_OSCS> osc_samples;
+    mono_ArenaBuffer<1> osc_switchs;
+    mono_ArenaBuffer<1> osc_sync_switchs;
+    mono_ArenaBuffer<1> modulator_samples;
 
-    mono_AudioSampleBuffer<1> final_env;
+    mono_ArenaBuffer<1> final_env;
 #ifdef POLY
-    mono_AudioSampleBuffer<SUM_FILTERS> filter_env_tracking;
+    mono_ArenaBuffer<SUM_FILTERS> filter_env_tracking;
 #endif
-    mono_AudioSampleBuffer<1> chorus_env;
+    mono_ArenaBuffer<1> chorus_env;
 
-    mono_AudioSampleBuffer<SUM_INPUTS_PER_FILTER * SUM_FILTERS> filter_input_samples;
-    mono_AudioSampleBuffer<SUM_INPUTS_PER_FILTER * SUM_FILTERS> filter_input_env_amps;
-    mono_AudioSampleBuffer<SUM_INPUTS_PER_FILTER * SUM_FILTERS> filter_output_samples;
-    mono_AudioSampleBuffer<SUM_FILTERS> filter_env_amps;
+    mono_ArenaBuffer<SUM_INPUTS_PER_FILTER * SUM_FILTERS> filter_input_samples;
+    mono_ArenaBuffer<SUM_INPUTS_PER_FILTER * SUM_FILTERS> filter_input_env_amps;
+    mono_ArenaBuffer<SUM_INPUTS_PER_FILTER * SUM_FILTERS> filter_output_samples;
+    mono_ArenaBuffer<SUM_FILTERS> filter_env_amps;
 
-    mono_AudioSampleBuffer<1> tmp_buffer;
-    mono_AudioSampleBuffer<1> second_mono_buffer;
+    mono_ArenaBuffer<1> tmp_buffer;
+    mono_ArenaBuffer<1> second_mono_buffer;
+    mono_ArenaBuffer<2> pan_gains;
+    mono_ArenaBuffer<SUM_REVERB_BUFFERS> reverb_buffers;
+    mono_ArenaBuffer<SUM_FILTER_OVERSAMPLING_BUFFERS> filter_oversampling;
 
-    mono_AudioSampleBuffer<1> velocity_buffer;
+    mono_ArenaBuffer<1> velocity_buffer;
 
   private:
     // ==============================================================================
     friend class MoniqueAudioProcessor;
     COLD void resize_buffer_if_required(int size_) noexcept;
+    COLD std::size_t place_buffers(float *arena_) noexcept;
+    COLD void allocate_arena() noexcept;
+
+  public:
+    COLD std::size_t get_memory_usage() const noexcept;
 
   public:
     // ==============================================================================
@@ -270,6 +407,240 @@ class Step
     }
     inline ~Step() noexcept {}
 };
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+// COMPILE WITH MONIQUE_STAGE_TIMING=1 TO MEASURE THE STAGES OF THE VOICE RENDER
+#ifndef MONIQUE_STAGE_TIMING
+#define MONIQUE_STAGE_TIMING 0
+#endif
+
+enum TIMING_STAGES
+{
+    TIMING_SMOOTH_1,
+    TIMING_SMOOTH_2,
+    TIMING_SMOOTH_3,
+    TIMING_SMOOTH_4,
+    TIMING_FILTER_1,
+    TIMING_FILTER_2,
+    TIMING_FILTER_3,
+    TIMING_EQ,
+    TIMING_FX_ENV,
+    TIMING_FX_CHORUS,
+    TIMING_FX_DELAY,
+    TIMING_FX_REVERB,
+    TIMING_FX_OUTPUT,
+
+    SUM_TIMING_STAGES
+};
+
+// WRITTEN BY THE AUDIO THREAD ONLY, THE UI READS WITHOUT LOCKING
+class StageTimings
+{
+    std::atomic<float> smoothed_us[SUM_TIMING_STAGES];
+    std::atomic<float> smoothed_block_us;
+
+    std::atomic<double> sum_seconds[SUM_TIMING_STAGES];
+    std::atomic<std::int64_t> sum_blocks;
+
+    static inline void smooth(std::atomic<float> &target_, float value_) noexcept
+    {
+        const float last = target_.load(std::memory_order_relaxed);
+        target_.store(last + (value_ - last) * 0.05f, std::memory_order_relaxed);
+    }
+
+  public:
+    //==========================================================================
+    inline void add(int stage_, double seconds_) noexcept
+    {
+        smooth(smoothed_us[stage_], float(seconds_ * 1.0e6));
+        sum_seconds[stage_].store(sum_seconds[stage_].load(std::memory_order_relaxed) + seconds_,
+                                  std::memory_order_relaxed);
+    }
+    inline void add_block(int num_samples_, double sample_rate_) noexcept
+    {
+        smooth(smoothed_block_us, float(num_samples_ * 1.0e6 / sample_rate_));
+        sum_blocks.store(sum_blocks.load(std::memory_order_relaxed) + 1,
+                         std::memory_order_relaxed);
+    }
+
+    //==========================================================================
+    // SMOOTHED STAGE TIME AND DURATION OF ONE RENDERED BLOCK, THE STAGES DO NOT OVERLAP
+    inline float get_us(int stage_) const noexcept
+    {
+        return smoothed_us[stage_].load(std::memory_order_relaxed);
+    }
+    inline float get_block_us() const noexcept
+    {
+        return smoothed_block_us.load(std::memory_order_relaxed);
+    }
+    inline double get_sum_seconds(int stage_) const noexcept
+    {
+        return sum_seconds[stage_].load(std::memory_order_relaxed);
+    }
+    inline std::int64_t get_sum_blocks() const noexcept
+    {
+        return sum_blocks.load(std::memory_order_relaxed);
+    }
+    static const char *get_stage_name(int stage_) noexcept;
+
+    void reset() noexcept;
+
+    //==========================================================================
+    COLD StageTimings() noexcept { reset(); }
+    COLD ~StageTimings() noexcept {}
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(StageTimings)
+};
+
+// MEASURES THE TIME SINCE THE LAST LAP (OR CONSTRUCTION) FOR A STAGE
+class StageLapTimer
+{
+    StageTimings &timings;
+    std::int64_t last_ticks;
+
+  public:
+    inline void lap(int stage_) noexcept
+    {
+        const std::int64_t now = juce::Time::getHighResolutionTicks();
+        timings.add(stage_, juce::Time::highResolutionTicksToSeconds(now - last_ticks));
+        last_ticks = now;
+    }
+
+    inline StageLapTimer(StageTimings &timings_) noexcept
+        : timings(timings_), last_ticks(juce::Time::getHighResolutionTicks())
+    {
+    }
+};
+
+// MEASURES ITS SCOPE ONLY, FOR STAGES WITH CODE BETWEEN THEM THAT IS NO STAGE
+class StageScopeTimer
+{
+    StageTimings &timings;
+    const int stage;
+    const std::int64_t start_ticks;
+
+  public:
+    inline StageScopeTimer(StageTimings &timings_, int stage_) noexcept
+        : timings(timings_), stage(stage_), start_ticks(juce::Time::getHighResolutionTicks())
+    {
+    }
+    inline ~StageScopeTimer() noexcept
+    {
+        timings.add(stage, juce::Time::highResolutionTicksToSeconds(
+                               juce::Time::getHighResolutionTicks() - start_ticks));
+    }
+};
+
+#if MONIQUE_STAGE_TIMING
+#define MONIQUE_STAGE_LAP_TIMER(timings_) StageLapTimer stage_lap_timer(timings_)
+#define MONIQUE_STAGE_LAP(stage_) stage_lap_timer.lap(stage_)
+#define MONIQUE_STAGE_SCOPE(timings_, stage_)                                                      \
+    const StageScopeTimer stage_scope_timer(timings_, stage_)
+#else
+#define MONIQUE_STAGE_LAP_TIMER(timings_)
+#define MONIQUE_STAGE_LAP(stage_)
+#define MONIQUE_STAGE_SCOPE(timings_, stage_)
+#endif
+
+//==============================================================================
+// PROGRAM LOAD STAGES, MEASURED ONLY IF MoniqueSynthData::load_timings IS SET
+enum LOAD_TIMING_STAGES
+{
+    LOAD_TIMING_PARSE,
+    LOAD_TIMING_PARAMETERS,
+    LOAD_TIMING_MORPH_SOURCES,
+    LOAD_TIMING_MORPH,
+    LOAD_TIMING_BACKUP,
+    LOAD_TIMING_MIDI_FEEDBACK,
+
+    SUM_LOAD_TIMING_STAGES
+};
+
+struct LoadTimings
+{
+    double sum_seconds[SUM_LOAD_TIMING_STAGES];
+
+    static const char *get_stage_name(int stage_) noexcept;
+
+    inline void reset() noexcept
+    {
+        for (int i = 0; i != SUM_LOAD_TIMING_STAGES; ++i)
+        {
+            sum_seconds[i] = 0;
+        }
+    }
+
+    COLD LoadTimings() noexcept { reset(); }
+};
+
+// LIKE StageLapTimer, BUT DOES NOTHING WITHOUT TIMINGS
+class LoadLapTimer
+{
+    LoadTimings *const timings;
+    std::int64_t last_ticks;
+
+  public:
+    inline void lap(int stage_) noexcept
+    {
+        if (timings)
+        {
+            const std::int64_t now = juce::Time::getHighResolutionTicks();
+            timings->sum_seconds[stage_] +=
+                juce::Time::highResolutionTicksToSeconds(now - last_ticks);
+            last_ticks = now;
+        }
+    }
+
+    inline LoadLapTimer(LoadTimings *timings_) noexcept
+        : timings(timings_), last_ticks(timings_ ? juce::Time::getHighResolutionTicks() : 0)
+    {
+    }
+};
+
+//==============================================================================
+// HEAP OF ONE INSTANCE, SEE MoniqueAudioProcessor::collect_memory_footprint
+enum MEMORY_CATEGORIES
+{
+    MEMORY_SYNTH_DATA,
+    MEMORY_MORPH_SOURCES,
+    MEMORY_SMOOTHERS,
+    MEMORY_DATA_BUFFER,
+    MEMORY_DELAY,
+    MEMORY_CHORUS,
+    MEMORY_REVERB,
+    MEMORY_LOOKUP_TABLES,
+    MEMORY_EDITOR,
+
+    SUM_MEMORY_CATEGORIES
+};
+struct MemoryFootprint
+{
+    std::size_t bytes[SUM_MEMORY_CATEGORIES];
+
+    static const char *get_category_name(int category_) noexcept;
+
+    inline void add(int category_, std::size_t bytes_) noexcept { bytes[category_] += bytes_; }
+    inline std::size_t get_total() const noexcept
+    {
+        std::size_t total = 0;
+        for (int i = 0; i != SUM_MEMORY_CATEGORIES; ++i)
+        {
+            total += bytes[i];
+        }
+        return total;
+    }
+
+    COLD MemoryFootprint() noexcept
+    {
+        for (int i = 0; i != SUM_MEMORY_CATEGORIES; ++i)
+        {
+            bytes[i] = 0;
+        }
+    }
+};
+
 struct RuntimeInfo
 {
     std::int64_t samples_since_start;
@@ -277,6 +648,11 @@ struct RuntimeInfo
     double bpm;
     double steps_per_sample;
 
+    StageTimings stage_timings;
+
+    // OPTIONAL TAP OF THE VOICE OUTPUT BEFORE THE FX, SET BY OFFLINE TOOLS ONLY
+    juce::AudioSampleBuffer *pre_fx_capture;
+
     struct standalone_features
     {
         bool is_extern_synced = false;
@@ -435,11 +811,13 @@ class SmoothManager : public RuntimeListener, juce::DeletedAtShutdown
     juce::Array<SmoothedParameter *> smoothers;
     RuntimeNotifyer *const notifyer;
 
+    int control_rate; // IN SAMPLES, SET BY THE VOICE FOR EACH BLOCK
+
     //==========================================================================
     friend struct MoniqueSynthData;
     friend struct juce::ContainerDeletePolicy<SmoothManager>;
     COLD SmoothManager(RuntimeNotifyer *const notifyer_) noexcept
-        : RuntimeListener(notifyer_), notifyer(notifyer_)
+        : RuntimeListener(notifyer_), notifyer(notifyer_), control_rate(1)
     {
     }
     COLD ~SmoothManager() noexcept {}
@@ -447,10 +825,16 @@ class SmoothManager : public RuntimeListener, juce::DeletedAtShutdown
     void sample_rate_or_block_changed() noexcept override{};
 
   public:
+    inline void set_control_rate(int control_rate_) noexcept { control_rate = control_rate_; }
+    inline int get_control_rate() const noexcept { return control_rate; }
+
     void smooth_and_morph(bool force_by_load_, bool do_really_morph_, const float *morph_amount_,
                           int num_samples_, int smooth_motor_time_in_ms_,
                           int morph_motor_time_in_ms_, MorphGroup *morph_group_) noexcept;
 
+    // THE BUFFERS OF ALL REGISTERED SMOOTHERS
+    inline std::size_t get_memory_usage() const noexcept;
+
   public:
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(SmoothManager)
 };
@@ -466,6 +850,11 @@ class SmoothedParameter : RuntimeListener
     mono_AudioSampleBuffer<1> values;
     mono_AudioSampleBuffer<1> modulation_power;
 
+    // THE LAST CONTROL POINTS, THE NEXT BLOCK RAMPS FROM THERE
+    float last_morphed_value;
+    float last_morphed_modulation;
+    float last_modulation_power;
+
   public:
     Parameter *const param_to_smooth;
     float const max_value;
@@ -517,6 +906,10 @@ class SmoothedParameter : RuntimeListener
         return values.getReadPointer();
     }
     inline void sample_rate_or_block_changed() noexcept override;
+    inline std::size_t get_memory_usage() const noexcept
+    {
+        return values.get_memory_usage() + modulation_power.get_memory_usage();
+    }
 
     //==========================================================================
     COLD SmoothedParameter(SmoothManager *const smooth_manager_,
@@ -527,6 +920,17 @@ class SmoothedParameter : RuntimeListener
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(SmoothedParameter)
 };
 
+//==============================================================================
+inline std::size_t SmoothManager::get_memory_usage() const noexcept
+{
+    std::size_t bytes = 0;
+    for (const SmoothedParameter *smoother : smoothers)
+    {
+        bytes += smoother->get_memory_usage();
+    }
+    return bytes;
+}
+
 //==============================================================================
 //==============================================================================
 //==============================================================================
@@ -1363,6 +1767,7 @@ class MorphGroup : public juce::Timer, ParameterListener
 struct MTSClient;
 struct MoniqueTuningData
 {
+    MoniqueTuningData() { update_frequency_cache(); }
     ~MoniqueTuningData();
 
     enum Mode
@@ -1389,6 +1794,39 @@ struct MoniqueTuningData
         return 421;
     }
 
+    // ONE FREQUENCY PER MIDI NOTE AND ONE ABOVE FOR THE INTERPOLATION. UNDER MTS-ESP EVERY BLOCK
+    // INVALIDATES THE CACHE AND A NOTE IS ONLY ASKED AGAIN WHEN IT IS READ, THE OTHER MODES FILL
+    // ALL NOTES WHEN THE MODE CHANGES
+    float note_frequencies[129];
+    std::uint32_t note_blocks[129] = {};
+    std::uint32_t cache_block{0};
+    int cached_mode{-1};
+    void update_frequency_cache();
+    void refresh_note(int note);
+
+    // LIKE midiNoteToFrequency, BUT FROM THE CACHE. BETWEEN TWO NOTES IT INTERPOLATES IN CENTS,
+    // LIKE THE MTS-ESP PATH DOES, SO FOR WHOLE NOTES IT IS A LOOKUP
+    inline float get_frequency(float note) noexcept
+    {
+        if (note >= 0 && note < 128)
+        {
+            const int idx = int(note);
+            const float frac = note - idx;
+            if (note_blocks[idx] != cache_block)
+            {
+                refresh_note(idx);
+            }
+            if (frac != 0 && note_blocks[idx + 1] != cache_block)
+            {
+                refresh_note(idx + 1);
+            }
+            const float frequency = note_frequencies[idx];
+            return frac == 0 ? frequency
+                             : frequency * std::pow(note_frequencies[idx + 1] / frequency, frac);
+        }
+        return midiNoteToFrequency(note);
+    }
+
     MTSClient *mts_client{nullptr};
     int mtsChecked{0};
     void updateMTSESPStatus();
@@ -1511,6 +1949,15 @@ struct MoniqueSynthData : ParameterListener
     BoolParameter ui_is_large;
     Parameter ui_scale_factor;
 
+    // ENGINE
+    BoolParameter only_active_osc_waves;
+    IntParameter osc_engine;
+    IntParameter atan_accuracy; // OF THE BLOCK CLIPPERS AND FILTER DISTORTION
+    IntParameter filter_coefficient_rate; // IN SAMPLES, 1 (DEFAULT) IS EXACT, RENDERS ARE EXACT
+    IntParameter control_rate;            // CONTROL_RATES, OFFLINE RENDERS ARE EXACT
+    IntParameter filter_oversampling;     // FILTER_OVERSAMPLINGS
+    IntParameter render_filter_oversampling; // FILTER_OVERSAMPLINGS OF OFFLINE RENDERS
+
     // MIDI HACKS
     Parameter midi_lfo_wave;
     IntParameter midi_lfo_speed;
@@ -1705,8 +2152,16 @@ struct MoniqueSynthData : ParameterListener
     void load_default() noexcept;
     void save_to(juce::XmlElement *xml) noexcept;
     bool force_morph_update__load_flag;
+    LoadTimings *load_timings; // OPTIONAL, FOR THE BENCH
     void read_from(const juce::XmlElement *xml) noexcept;
 
+  public:
+    // ==============================================================================
+    // ESTIMATE: THE DATA OBJECTS AND THE HEAP OF THEIR PARAMETERS
+    COLD std::size_t get_memory_usage() const noexcept;
+    // THIS, THE MORPH SOURCES, THE SMOOTHERS AND THE LOOKUPS
+    COLD void collect_memory_footprint(MemoryFootprint &footprint_) const noexcept;
+
   private:
     bool write2file(const juce::String &bank_name_, const juce::String &program_name_) noexcept;
 
@@ -103,6 +103,13 @@ COLD Parameter::~Parameter() noexcept
     delete runtime_info;
     delete info;
 }
+COLD std::size_t Parameter::get_memory_usage() const noexcept
+{
+    return sizeof(ParameterInfo) + sizeof(ParameterRuntimeInfo) + sizeof(MIDIControl) +
+           info->name.getNumBytesAsUTF8() + info->short_name.getNumBytesAsUTF8() +
+           std::size_t(value_listeners.size() + always_value_listeners.size()) *
+               sizeof(ParameterListener *);
+}
 
 //==============================================================================
 //==============================================================================
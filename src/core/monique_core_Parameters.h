@@ -369,6 +369,10 @@ class Parameter
   protected:
     ParameterRuntimeInfo *const runtime_info;
 
+  public:
+    // HEAP OWNED BY THIS PARAMETER, THE OBJECT ITSELF BELONGS TO ITS DATA
+    COLD std::size_t get_memory_usage() const noexcept;
+
   protected:
     // ==============================================================================
     // OBSERVABLE
@@ -1543,6 +1547,26 @@ class LinearSmoother
 
         return lastValue;
     }
+    // num_ticks_ SAMPLES AT ONCE, FOR THE CONTROL RATE
+    inline float tick(int num_ticks_) noexcept
+    {
+        if (countdown > 0)
+        {
+            if ((countdown -= num_ticks_) < 1)
+            {
+                countdown = 0;
+                currentValue = target;
+                lastValue = currentValue;
+            }
+            else
+            {
+                currentValue += step * num_ticks_;
+                lastValue = currentValue;
+            }
+        }
+
+        return lastValue;
+    }
     inline bool is_up_to_date() const noexcept { return countdown == 0; }
     //==========================================================================
     inline float get_last_value() const noexcept { return lastValue; }
@@ -1622,6 +1646,16 @@ template <int min = 0, int max = 1> class LinearSmootherMinMax : public LinearSm
 
         return lastValue;
     }
+    inline float tick(int num_ticks_) noexcept
+    {
+        if (countdown > 0)
+        {
+            LinearSmoother::tick(num_ticks_);
+            lastValue = juce::jlimit(float(min), float(max), lastValue);
+        }
+
+        return lastValue;
+    }
 
     inline float glide_tick(float to_value) noexcept
     {
@@ -1650,6 +1684,34 @@ template <int min = 0, int max = 1> class LinearSmootherMinMax : public LinearSm
         return lastValue;
     }
 
+    // num_ticks_ SAMPLES AT ONCE TO to_value, FOR THE CONTROL RATE
+    inline float glide_tick(float to_value, int num_ticks_) noexcept
+    {
+        if (glide_countdown > 0)
+        {
+            if (stepsToTarget == glide_countdown)
+            {
+                countdown = glide_countdown;
+            }
+
+            if (target != to_value)
+            {
+                target = to_value;
+                step = (target - currentValue) / countdown;
+            }
+
+            glide_countdown = juce::jmax(0, glide_countdown - num_ticks_);
+            LinearSmootherMinMax::tick(num_ticks_);
+        }
+        else
+        {
+            currentValue = to_value;
+            lastValue = currentValue;
+        }
+
+        return lastValue;
+    }
+
     inline void reset_glide_countdown() noexcept { glide_countdown = stepsToTarget; }
 
     //==============================================================================
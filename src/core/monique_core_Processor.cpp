@@ -167,7 +167,7 @@ struct MoniqueAudioProcessor::standalone_features : public juce::Timer
 COLD MoniqueAudioProcessor::MoniqueAudioProcessor() noexcept
     : mono_AudioDeviceManager(new RuntimeNotifyer()), stored_note(-1), stored_velocity(0),
       peak_meter(nullptr), force_sample_rate_update(true), sampleReader(nullptr), samplePosition(0),
-      lastBlockTime(0), restore_time(-1), amp_painter(nullptr),
+      lastBlockTime(0), restore_time(-1), amp_painter(nullptr), save_settings_on_shutdown(true),
       AudioProcessor(BusesProperties().withOutput("Output", juce::AudioChannelSet::stereo(), true))
 {
     juce::SystemStats::setApplicationCrashHandler(&crash_handler);
@@ -717,8 +717,11 @@ COLD MoniqueAudioProcessor::~MoniqueAudioProcessor() noexcept
         }
     }
 
-    synth_data->save_midi();
-    synth_data->save_settings();
+    if (save_settings_on_shutdown)
+    {
+        synth_data->save_midi();
+        synth_data->save_settings();
+    }
 
     ui_look_and_feel->clear_synth_data();
     synth->removeVoice(0);
@@ -732,6 +735,15 @@ COLD MoniqueAudioProcessor::~MoniqueAudioProcessor() noexcept
     info = nullptr;
 }
 
+//==============================================================================
+COLD void MoniqueAudioProcessor::collect_memory_footprint(
+    MemoryFootprint &footprint_) const noexcept
+{
+    synth_data->collect_memory_footprint(footprint_);
+    footprint_.add(MEMORY_DATA_BUFFER, data_buffer->get_memory_usage());
+    voice->collect_memory_footprint(footprint_);
+}
+
 //==============================================================================
 //==============================================================================
 //==============================================================================
@@ -765,6 +777,9 @@ void MoniqueAudioProcessor::reset_pending_notes() { synth->reset_note_down_store
 void MoniqueAudioProcessor::process(juce::AudioSampleBuffer &buffer_,
                                     juce::MidiBuffer &midi_messages_, bool bypassed_)
 {
+    // FLUSH TO ZERO AND DENORMALS ARE ZERO FOR THE WHOLE BLOCK, DECAYING TAILS STAY CHEAP
+    const juce::ScopedNoDenormals no_denormals;
+
     if (is_standalone())
     {
         if (!standalone_features_pimpl->block_lock.tryEnter())
@@ -786,6 +801,7 @@ void MoniqueAudioProcessor::process(juce::AudioSampleBuffer &buffer_,
     if (synth_data->tuning)
     {
         synth_data->tuning->updateMTSESPStatus();
+        synth_data->tuning->update_frequency_cache();
     }
 
     const int num_samples = buffer_.getNumSamples();
@@ -30,6 +30,7 @@ class ClockSmoothBuffer;
 class MoniqueSynthesizer;
 class Monique_Ui_AmpPainter;
 class Monique_Ui_Mainwindow;
+struct MemoryFootprint;
 
 class MoniqueAudioProcessor : public juce::AudioProcessor,
                               public juce::MidiKeyboardState,
@@ -157,6 +158,10 @@ class MoniqueAudioProcessor : public juce::AudioProcessor,
         return reinterpret_cast<Monique_Ui_Mainwindow *>(getActiveEditor());
     }
 
+    //==========================================================================
+    // HEAP OF THIS INSTANCE, THE EDITOR CAN ONLY BE MEASURED FROM OUTSIDE (monique-bench memory)
+    COLD void collect_memory_footprint(MemoryFootprint &footprint_) const noexcept;
+
     //==========================================================================
     // GLOBAL CLASSES
   public:
@@ -166,6 +171,8 @@ class MoniqueAudioProcessor : public juce::AudioProcessor,
     std::unique_ptr<DataBuffer> data_buffer;
     std::unique_ptr<RuntimeInfo> info;
     Monique_Ui_AmpPainter *amp_painter;
+    // TOOLS LIKE monique-bench TURN IT OFF, SO THEY NEVER OVERWRITE session.mcfg AND patch.midi
+    bool save_settings_on_shutdown;
 
     // keeps the shared data singleton alive
     std::shared_ptr<Status> scoped_shared_global_settings;
@@ -19,45 +19,13 @@
 
 #include "monique_core_Datastructures.h"
 #include "monique_core_Processor.h"
+#include "monique_core_Synth_dsp.h"
 #include "ui/monique_ui_AmpPainter.h"
 #include "ui/monique_ui_SegmentedMeter.h"
 
+#include <juce_dsp/juce_dsp.h>
 #include <memory>
 
-//==============================================================================
-//==============================================================================
-//==============================================================================
-// TOOPT WITH SIMDRegister or AudioBuffer and Function
-static inline float sample_mix(float s1_, float s2_) noexcept
-{
-    if ((s1_ > 0) && (s2_ > 0))
-    {
-        s1_ = s1_ + s2_ - (s1_ * s2_);
-    }
-    else if ((s1_ < 0) && (s2_ < 0))
-    {
-        s1_ = s1_ + s2_ + (s1_ * s2_);
-    }
-    else
-    {
-        s1_ += s2_;
-    }
-
-    return s1_;
-}
-
-//==============================================================================
-//==============================================================================
-//==============================================================================
-// TOOPT WITH TABLE LOCKUP
-#define left_pan(pan_, sin_lookup_)                                                                \
-    juce::jmax((float)std::sin(((pan_ + 1) * 0.5) * (juce::MathConstants<float>::pi * 0.5f)),      \
-               0.00001f)
-// TOOPT WITH TABLE LOCKUP
-#define right_pan(pan_, cos_lookup_)                                                               \
-    juce::jmax((float)std::cos(((pan_ + 1) * 0.5) * (juce::MathConstants<float>::pi * 0.5f)),      \
-               0.00001f)
-
 //==============================================================================
 //==============================================================================
 //==============================================================================
@@ -75,6 +43,9 @@ COLD SmoothedParameter::SmoothedParameter(SmoothManager *const smooth_manager_,
 
       values(block_size), modulation_power(block_size),
 
+      last_morphed_value(param_to_smooth_->get_value()), last_morphed_modulation(0),
+      last_modulation_power(0),
+
       param_to_smooth(param_to_smooth_),
 
       max_value(param_to_smooth_->get_info().max_value),
@@ -140,702 +111,748 @@ COLD void SmoothedParameter::sample_rate_or_block_changed() noexcept
 }
 
 //==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-class Smoother : RuntimeListener
+COLD DataBuffer::DataBuffer(int init_buffer_size_) noexcept
+    : size(init_buffer_size_), arena(), arena_bytes(0)
 {
-    int pos;
-    float sum;
-    int size_in_ms;
-    int size;
-    mono_AudioSampleBuffer<1> buffer;
-    float *ptr_to_buffer;
+    allocate_arena();
+}
+COLD DataBuffer::~DataBuffer() noexcept {}
+COLD std::size_t DataBuffer::get_memory_usage() const noexcept { return arena_bytes; }
 
-  public:
-    //==========================================================================
-    inline void add(float val_) noexcept
-    {
-        sum -= ptr_to_buffer[pos];
-        ptr_to_buffer[pos] = val_;
-        sum += val_;
+//==============================================================================
+COLD std::size_t DataBuffer::place_buffers(float *const arena_) noexcept
+{
+    std::size_t offset = 0;
 
-        if (++pos >= size)
-        {
-            pos = 0;
-        }
-    }
-    inline float add_and_get_average(float val_) noexcept
-    {
-        add(val_);
-        return get_average();
-    }
-    inline float get_average() const noexcept { return sum * (1.0f / size); }
-    inline void reset(float value_) noexcept
-    {
-        sum = 0;
-        for (int i = 0; i != size; ++i)
-        {
-            ptr_to_buffer[i] = value_;
-            sum += value_;
-        }
-    }
-    void set_size_in_ms(int size_in_ms_, bool force_ = false) noexcept
-    {
-        if (size_in_ms != size_in_ms_ || force_)
-        {
-            float last_average = get_average();
+    offset = band_env_buffers.place(arena_, offset, size);
+    offset = band_out_buffers.place(arena_, offset, size);
 
-            size_in_ms = size_in_ms_;
-            size = juce::jmax(3, msToSamplesFast(size_in_ms_, sample_rate));
-            buffer.setSize(size, false);
-            ptr_to_buffer = buffer.getWritePointer();
+    offset = lfo_amplitudes.place(arena_, offset, size);
+    offset = mfo_amplitudes.place(arena_, offset, size);
+    offset = filter_output_samples_l_r.place(arena_, offset, size);
+    offset = filter_stereo_output_samples.place(arena_, offset, size);
 
-            if (pos > size)
-            {
-                pos = 0;
-            }
+    offset = osc_samples.place(arena_, offset, size);
+    offset = osc_switchs.place(arena_, offset, size);
+    offset = osc_sync_switchs.place(arena_, offset, size);
+    offset = modulator_samples.place(arena_, offset, size);
 
-            sum = 0;
-            for (int i = 0; i != size; ++i)
-            {
-                ptr_to_buffer[i] = last_average;
-                sum += last_average;
-            }
-        }
-    }
+    offset = final_env.place(arena_, offset, size);
+#ifdef POLY
+    offset = filter_env_tracking.place(arena_, offset, size);
+#endif
+    offset = chorus_env.place(arena_, offset, size);
 
-  private:
-    virtual void sample_rate_or_block_changed() noexcept override
-    {
-        set_size_in_ms(size_in_ms, true);
-    };
+    offset = filter_input_samples.place(arena_, offset, size);
+    offset = filter_input_env_amps.place(arena_, offset, size);
+    offset = filter_output_samples.place(arena_, offset, size);
+    offset = filter_env_amps.place(arena_, offset, size);
 
-  public:
-    //==========================================================================
-    COLD Smoother(RuntimeNotifyer *const notifyer_, int init_size_in_ms_) noexcept
-        : RuntimeListener(notifyer_), pos(0), sum(0), size_in_ms(init_size_in_ms_),
-          size(juce::jmax(3, msToSamplesFast(init_size_in_ms_, sample_rate))), buffer(size),
-          ptr_to_buffer(buffer.getWritePointer())
-    {
-        reset(0);
-    }
-    COLD ~Smoother() {}
+    offset = tmp_buffer.place(arena_, offset, size);
+    offset = second_mono_buffer.place(arena_, offset, size);
+    offset = pan_gains.place(arena_, offset, size);
+    offset = reverb_buffers.place(arena_, offset, size);
+    offset = filter_oversampling.place(arena_, offset, size * MAX_FILTER_OVERSAMPLING);
 
-    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(Smoother)
-};
+    offset = velocity_buffer.place(arena_, offset, size);
 
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-// TOOPT with AudioBuffer and Function
-// atan lookup???
-static inline float soft_clipping(float input_and_worker_) noexcept
+    return offset;
+}
+COLD void DataBuffer::allocate_arena() noexcept
 {
-    return (std::atan(input_and_worker_) * (1.0f / juce::MathConstants<float>::pi)) * 1.5;
+    // ONE ALIGNMENT MORE TO MOVE THE START TO THE NEXT CACHE LINE
+    arena_bytes = place_buffers(nullptr) * sizeof(float) + DATA_BUFFER_ALIGNMENT;
+    arena.allocate(arena_bytes, true);
+    place_buffers(juce::snapPointerToAlignment(reinterpret_cast<float *>(arena.getData()),
+                                               DATA_BUFFER_ALIGNMENT));
 }
-
-//==============================================================================
-// TOOPT with AudioBuffer and Function
-static inline float lfo2amp(float sample_) noexcept { return (sample_ + 1.0f) * 0.5f; }
-
-//==============================================================================
-static inline float distortion(float input_and_worker_, float distortion_power_) noexcept
+COLD void DataBuffer::resize_buffer_if_required(int size_) noexcept
 {
-    if (distortion_power_ != 0)
+    if (size_ != size)
     {
-        const float distortion_add_on = distortion_power_ * 0.9f;
-        input_and_worker_ =
-            ((1.0f + distortion_add_on) * input_and_worker_) -
-            (input_and_worker_ * input_and_worker_ * input_and_worker_) * distortion_add_on;
+        size = size_;
+        allocate_arena();
     }
-
-    return input_and_worker_;
 }
 
 //==============================================================================
-//==============================================================================
-//==============================================================================
-// TOOPT with AudioBuffer and Function
-static inline float clipp_to_0_and_1(float input_and_worker_) noexcept
+static std::atomic<std::int64_t> next_noise_seed(0);
+COLD void set_noise_seed(std::int64_t seed_) noexcept { next_noise_seed = seed_; }
+std::int64_t take_noise_seed() noexcept
 {
-    if (input_and_worker_ > 1)
-    {
-        input_and_worker_ = 1;
-    }
-    else if (input_and_worker_ < 0)
+    const std::int64_t seed = next_noise_seed;
+    if (seed != 0)
     {
-        input_and_worker_ = 0;
+        next_noise_seed = seed + 1;
     }
-
-    return input_and_worker_;
+    return seed;
 }
 
 //==============================================================================
 //==============================================================================
 //==============================================================================
-// TOOPT with AudioBuffer and Function
-static inline float soft_clipp_greater_1_2(float x) noexcept
-{
-    if (x > 1)
-    {
-        x = 1.0f + soft_clipping(x - 1.0f);
-    }
-    else if (x < -1)
-    {
-        x = -1.0f + soft_clipping(x + 1.0f);
-    }
-
-    if (x > 1.2)
-    {
-        x = 1.2;
-    }
-    else if (x < -1.2)
-    {
-        x = -1.2;
-    }
-
-    return x;
-}
-//==============================================================================
-//==============================================================================
 //==============================================================================
-// TOOPT with AudioBuffer and Function
-static inline float soft_clipp_greater_0_9(float x) noexcept
-{
-    if (x > 0.9f)
-    {
-        x = 0.9f + soft_clipping(x - 0.9f);
-    }
-    else if (x < -0.9f)
-    {
-        x = -0.9f + soft_clipping(x + 0.9f);
-    }
-
-    if (x > 1)
-    {
-        x = 1;
-    }
-    else if (x < -1)
-    {
-        x = -1;
-    }
-
-    return x;
-}
-
 //==============================================================================
 //==============================================================================
 //==============================================================================
-// TOOPT with AudioBuffer and Function
-static inline float hard_clipper_1(float x) noexcept
-{
-    if (x > 1)
-    {
-        x = 1;
-    }
-    else if (x < -1)
-    {
-        x = -1;
-    }
-
-    return x;
-}
-
 //==============================================================================
 //==============================================================================
 //==============================================================================
-// replace with juce table lookup
-static float inline lookup(const float *table_, float x) noexcept
+class MasterOSC : public RuntimeListener
 {
-    return table_[int(x * TABLESIZE_MULTI) % LOOKUP_TABLE_SIZE];
-}
-//==============================================================================
-COLD DataBuffer::DataBuffer(int init_buffer_size_) noexcept
-    : size(init_buffer_size_),
-
-      band_env_buffers(init_buffer_size_), band_out_buffers(init_buffer_size_),
+    // RUNTIME
+    //==============================================================================
+    ExponentialGlide freq_glide;
 
-      lfo_amplitudes(init_buffer_size_), mfo_amplitudes(init_buffer_size_),
-      filter_output_samples_l_r(init_buffer_size_), filter_stereo_output_samples(init_buffer_size_),
+    float sync_glide_samples;
+    int sync_glide_samples_left;
+    float last_value;
+    float last_modulator_value;
+    float sync_value;
+    float sync_modulator_value;
 
-      osc_samples(init_buffer_size_), osc_switchs(init_buffer_size_),
-      osc_sync_switchs(init_buffer_size_), modulator_samples(init_buffer_size_),
+    float root_note;
 
-      final_env(init_buffer_size_),
-#ifdef POLY
-      filter_env_tracking(init_buffer_size_),
-#endif
-      chorus_env(init_buffer_size_),
+    float last_root_note;
+    float root_frequency; // WITHOUT THE GLIDE
+    float last_frequency;
 
-      filter_input_samples(init_buffer_size_), filter_input_env_amps(init_buffer_size_),
-      filter_output_samples(init_buffer_size_), filter_env_amps(init_buffer_size_),
+    float last_modulator_frequency;
+    int modulator_sync_cylces;
+    int modulator_run_circle;
+    bool modulator_waits_for_sync_cycle;
 
-      tmp_buffer(init_buffer_size_),
+    // RAW OSCILATORS
+    //==============================================================================
+    PerfectCycleCounter cycle_counter;
+    mono_BlitSaw saw_generator;
+    mono_BlitSquare square_generator;
+    mono_PolyBlepSaw blep_saw_generator;
+    mono_PolyBlepSquare blep_square_generator;
+    mono_SineWave sine_generator;
+    mono_Noise noise;
+    ActiveWaves active_waves;
 
-      second_mono_buffer(init_buffer_size_),
+    mono_Modulate modulator;
 
-      velocity_buffer(init_buffer_size_)
-{
-}
-COLD DataBuffer::~DataBuffer() noexcept {}
+    // DATA SOURCE
+    //==============================================================================
+    DataBuffer *const data_buffer;
+    const MoniqueSynthData *const synth_data;
+    FMOscData *const fm_osc_data;
+    OSCData *const osc_data;
 
-//==============================================================================
-COLD void DataBuffer::resize_buffer_if_required(int size_) noexcept
-{
-    if (size_ != size)
+  public:
+    //==============================================================================
+    inline void process(DataBuffer *data_buffer_, const int num_samples_) noexcept
     {
-        size = size_;
-
-        band_env_buffers.setSize(size_);
-        band_out_buffers.setSize(size_);
-
-        lfo_amplitudes.setSize(size_);
-        mfo_amplitudes.setSize(size_);
-        filter_stereo_output_samples.setSize(size_);
-        filter_output_samples_l_r.setSize(size_);
+        float *const output_buffer(data_buffer->osc_samples.getWritePointer(MASTER_OSC));
 
-        osc_samples.setSize(size_);
-        osc_switchs.setSize(size_);
-        osc_sync_switchs.setSize(size_);
-        modulator_samples.setSize(size_);
+        float *const switch_buffer(data_buffer->osc_switchs.getWritePointer());
+        juce::FloatVectorOperations::clear(switch_buffer, num_samples_);
+        float *const modulator_buffer(data_buffer->modulator_samples.getWritePointer(MASTER_OSC));
+        const float *const lfo_amps((data_buffer->lfo_amplitudes.getReadPointer(MASTER_OSC)));
 
-        final_env.setSize(size_);
-#ifdef POLY
-        filter_env_tracking.setSize(size_);
-#endif
-        chorus_env.setSize(size_);
+        const bool is_lfo_modulated = osc_data->is_lfo_modulated;
+        const bool fm_sync = fm_osc_data->sync;
 
-        filter_input_samples.setSize(size_);
-        filter_input_env_amps.setSize(size_);
-        filter_output_samples.setSize(size_);
-        filter_env_amps.setSize(size_);
+        fm_osc_data->master_shift_smoother.process_modulation(is_lfo_modulated, lfo_amps,
+                                                              num_samples_);
 
-        tmp_buffer.setSize(size_);
+        // const float*const smoothed_tune_buffer(
+        // osc_data->tune_smoother.get_smoothed_modulated_value_buffer() );
+        const float *const smoothed_fm_amount_buffer(
+            osc_data->fm_amount_smoother.get_smoothed_value_buffer());
+        const float *const smoothed_wave_buffer(
+            osc_data->wave_smoother.get_smoothed_value_buffer());
+        const float *const smoothed_fm_freq_buffer(
+            fm_osc_data->fm_freq_smoother.get_smoothed_value_buffer());
+        const float *const smoothed_fm_swing_buffer(
+            fm_osc_data->fm_swing_smoother.get_smoothed_value_buffer());
+        const float *const smoothed_fm_phaser(
+            fm_osc_data->fm_shape_smoother.get_smoothed_value_buffer());
+        const float *const smoothed_phase_offset(
+            fm_osc_data->master_shift_smoother.get_smoothed_value_buffer());
 
-        second_mono_buffer.setSize(size_);
+        const bool use_blits = synth_data->osc_engine == OSC_ENGINE_BLIT;
+        active_waves.update(smoothed_wave_buffer, num_samples_, synth_data->only_active_osc_waves,
+                            use_blits, cycle_counter, saw_generator, square_generator);
 
-        velocity_buffer.setSize(size_);
-    }
-}
+        for (int sid = 0; sid < num_samples_; ++sid)
+        {
+            // SETUP TUNE
+            {
+                // BASE FREQUENCY
+                bool base_frequency_changed = false;
+                if (freq_glide.is_gliding() || last_root_note != root_note)
+                {
+                    freq_glide.tick();
 
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-class PerfectCycleCounter : RuntimeListener
-{
-    //==========================================================================
-    double frequency;
+                    {
+                        if (last_root_note != root_note)
+                        {
+                            last_root_note = root_note;
+                            root_frequency = synth_data->tuning->get_frequency(root_note);
+                        }
 
-    double delta;
-    double angle;
+                        const float new_frequence =
+                            juce::jmax(5.0f, root_frequency * freq_glide.get_factor());
+                        if (new_frequence != last_frequency)
+                        {
+                            cycle_counter.set_frequency(new_frequence);
+                            square_generator.updateHarmonics(cycle_counter.get_cylces_per_sec());
+                            saw_generator.updateHarmonics(cycle_counter.get_cylces_per_sec());
+                            blep_square_generator.updateHarmonics(
+                                cycle_counter.get_cylces_per_sec());
+                            blep_saw_generator.updateHarmonics(cycle_counter.get_cylces_per_sec());
 
-    double rate;
-    double phase;
+                            last_frequency = new_frequence;
+                        }
+                    }
 
-    double cylces_per_sec;
+                    base_frequency_changed = true;
+                }
 
-    bool new_cycle;
+                // MODULATOR FREQUENCY
+                {
+                    const float modulator_freq = smoothed_fm_freq_buffer[sid];
+                    if (base_frequency_changed || modulator_freq != last_modulator_frequency)
+                    {
+                        modulator.set_vibrato_frequency(
+                            last_frequency + last_frequency * (modulator_freq * 6 + 1.01));
+                        modulator_sync_cylces = std::floor(modulator_freq * 6 + 1);
 
-  public:
-    //==========================================================================
-    inline void set_frequency(double frequency_) noexcept
-    {
-        if (frequency != frequency_)
-        {
-            frequency = frequency_;
-            cylces_per_sec = sample_rate / frequency_;
+                        last_modulator_frequency = modulator_freq;
+                    }
+                }
 
-            delta = frequency_ / sample_rate *
-                    (juce::MathConstants<double>::pi + juce::MathConstants<double>::pi);
-            rate = (1.0 / cylces_per_sec) * juce::MathConstants<double>::pi;
-        }
-    }
-    inline void tick() noexcept
-    {
-        new_cycle = false;
+                // ADD PHASE SHIFT
+                square_generator.set_phase_offset(smoothed_phase_offset[sid]);
+                saw_generator.set_phase_offset(smoothed_phase_offset[sid]);
+                blep_square_generator.set_phase_offset(smoothed_phase_offset[sid]);
+                blep_saw_generator.set_phase_offset(smoothed_phase_offset[sid]);
+                sine_generator.set_phase_offset(smoothed_phase_offset[sid]);
+            }
 
-        angle += delta;
-        phase += rate;
-        if (angle > (juce::MathConstants<double>::pi + juce::MathConstants<double>::pi))
-        {
-            angle -= (juce::MathConstants<double>::pi + juce::MathConstants<double>::pi);
-            phase -= (juce::MathConstants<double>::pi + juce::MathConstants<double>::pi);
-            new_cycle = true;
-        }
-    }
-    inline double get_last_angle() const noexcept { return angle; }
-    inline double get_last_phase() const noexcept { return phase; }
-
-    inline double get_cylces_per_sec() const noexcept { return cylces_per_sec; }
-    inline bool is_new_cycle() const noexcept { return new_cycle; }
-    inline bool is_clean() const noexcept { return angle == 0 && new_cycle && phase == 0; }
+            // PROCESS OSC ITSELF
+            bool is_last_sample_of_cycle = false;
+            float sample;
+            float sine_sample = 0;
+            float square_sample = 0;
+            float saw_sample = 0;
+            {
+                // TICK THE HEARD OSCILATTORS
+                {
+                    cycle_counter.tick();
+                    if (active_waves.saw)
+                    {
+                        const double phase = cycle_counter.get_last_phase();
+                        saw_sample = use_blits ? saw_generator.tick(phase)
+                                               : blep_saw_generator.tick(phase);
+                    }
+                    {
+                        double angle = cycle_counter.get_last_angle();
+                        if (active_waves.square)
+                        {
+                            square_sample = use_blits ? square_generator.tick(angle)
+                                                      : blep_square_generator.tick(angle);
+                        }
+                        if (active_waves.sine)
+                        {
+                            sine_sample = sine_generator.tick(angle);
+                        }
+                    }
 
-    //==========================================================================
-    void reset() noexcept
-    {
-        angle = 0;
-        new_cycle = true;
-        phase = 0;
-    }
+                    // FORCE SYNC OF THE SINE AT THE NEXT SID
+                    if (cycle_counter.is_new_cycle())
+                    {
+                        // SET THE SWITCH
+                        is_last_sample_of_cycle = true;
+                        switch_buffer[sid] = true;
+                    }
+                }
 
-    //==========================================================================
-    void sample_rate_or_block_changed() noexcept override
-    {
-        float frequency_old = frequency;
-        frequency = 0;
-        set_frequency(frequency_old);
-    }
+                // CALC THE SAMPLE MIX
+                {
+                    const float wave_form = smoothed_wave_buffer[sid];
 
-  public:
-    //==========================================================================
-    COLD PerfectCycleCounter(RuntimeNotifyer *const notifyer_) noexcept
-        : RuntimeListener(notifyer_), frequency(0), delta(0), angle(0), rate(0), phase(0),
-          cylces_per_sec(0), new_cycle(true)
-    {
-    }
-    COLD ~PerfectCycleCounter() noexcept {}
+                    // SINE - SQUARE
+                    if (wave_form <= 1)
+                    {
+                        const float multi = wave_form;
+                        const float sine_wave_powerd = sine_sample * (1.0f - multi);
+                        const float square_wave_powerd = square_sample * multi;
+                        sample = sine_wave_powerd + square_wave_powerd;
+                    }
+                    // SQUARE - SAW
+                    else if (wave_form <= 2)
+                    {
+                        const float multi = wave_form - 1;
+                        const float square_wave_powerd = square_sample * (1.0f - multi);
+                        const float saw_wave_powerd = saw_sample * multi;
+                        sample = square_wave_powerd + saw_wave_powerd;
+                    }
+                    // SAW - RAND
+                    else /*if( wave_form <= 3 )*/
+                    {
+                        const float multi = wave_form - 2;
+                        const float saw_wave_powerd = saw_sample * (1.0f - multi);
+                        const float noice_powerd = noise.tick() * multi;
+                        sample = saw_wave_powerd + noice_powerd;
+                    }
+                }
+            }
 
-    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PerfectCycleCounter)
-};
+            // PROCESS MODULATOR
+            float modulator_sample = 0;
+            {
+                // MODULATOR SYNC AND PROCESSING
+                if (!modulator_waits_for_sync_cycle)
+                {
+                    modulator_sample = modulator.tick();
+                }
 
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-class mono_BlitSaw
-{
-    float phase_offset;
-    double last_tick_value;
-    double p_;
-    double C2_;
-    double phase_correction;
-    double a_;
-    double state_;
+                const bool is_last_sample_of_modulator_cycle = modulator.is_next_a_new_cycle();
 
-    unsigned int m_;
+                // STOP THE MODULATOR IF IN SYNC // IGNORED IF SHOT IS ENABLED
+                if (modulator_run_circle > modulator_sync_cylces && fm_sync)
+                {
+                    modulator_waits_for_sync_cycle = !is_last_sample_of_cycle;
+                    modulator_run_circle = 0;
+                }
+                else if (is_last_sample_of_cycle)
+                {
+                    modulator_waits_for_sync_cycle = false;
+                    modulator_run_circle = 0;
+                }
 
-  public:
-    //==========================================================================
-    inline float tick(double phase_) noexcept
-    {
-        double tmp;
-        {
-            const double working_phase_ = (phase_ + phase_offset) - phase_correction;
+                // COUNT CYCLES AND CLEAR STATE IF NOT WAITING FOR SYNC
+                if (is_last_sample_of_modulator_cycle && !modulator_waits_for_sync_cycle)
+                {
+                    ++modulator_run_circle;
+                }
 
-            // Avoid a divide by zero, or use of a denormalized divisor
-            // at the sinc peak, which has a limiting value of m_ / p_.
-            const double denominator = std::sin(working_phase_);
-            if (std::fabs(denominator) <= std::numeric_limits<double>::epsilon())
-            {
-                tmp = a_;
+                // UPDATE SWING
+                if (is_last_sample_of_modulator_cycle)
+                {
+                    modulator.set_swing_frequency(smoothed_fm_swing_buffer[sid] * 5);
+                }
             }
-            else
+
+            // ADD FM TO THE OUTPUT
             {
-                tmp = sin(working_phase_ * m_) / (p_ * denominator);
+                if (const float fm_amount = smoothed_fm_amount_buffer[sid])
+                {
+                    const float phase_move =
+                        smoothed_fm_phaser[sid]; // * jmin(1.0f,smoothed_fm_swing_buffer[sid]*80);
+                    sample = (1.0f - fm_amount) * sample +
+                             fm_amount * ((1.0f - phase_move) * sample * modulator_sample +
+                                          phase_move * (modulator_sample * modulator_sample *
+                                                        modulator_sample * sample));
+                }
+
+                if (--sync_glide_samples_left > 0)
+                {
+                    const float power = 1.0f / sync_glide_samples * sync_glide_samples_left;
+                    sample = sample * (1.0f - power) + sync_value * power;
+                    modulator_sample =
+                        modulator_sample * (1.0f - power) + sync_modulator_value * power;
+                }
+
+                output_buffer[sid] = sample;
+                modulator_buffer[sid] = modulator_sample;
             }
         }
 
-        tmp += (state_ - C2_);
-        state_ = tmp * 0.995;
-
-        return last_tick_value = tmp;
+        last_value = output_buffer[num_samples_ - 1];
+        last_modulator_value = modulator_buffer[num_samples_ - 1];
     }
-    inline float lastOut() const noexcept { return last_tick_value; }
 
-    //==========================================================================
-    inline void set_phase_offset(float offset_) noexcept
-    {
-        phase_offset = offset_ * juce::MathConstants<float>::pi;
-    }
-    inline void updateHarmonics(double p) noexcept
+    //==============================================================================
+    inline void update(float root_note_, int sample_pos_) noexcept
     {
-        p_ = p;
-        C2_ = 1.0 / p;
-        phase_correction = C2_ * (juce::MathConstants<double>::pi * 0.5) / 0.9;
-        m_ = 2 * floor(0.5 * p) + 1;
-        a_ = p / p;
-    }
+        root_note_ += synth_data->octave_offset * 12;
+        const float glide = synth_data->glide_smoother.get_smoothed_value_buffer()[sample_pos_];
+        if (glide != 0 && (root_note != root_note_ || freq_glide.is_gliding()))
+        {
+            root_note_ = juce::jmax(1.0f, juce::jmin(127.0f, root_note_));
 
-    //==========================================================================
-    inline void reset() noexcept
-    {
-        state_ = 0;
-        last_tick_value = 0;
-    }
+            // FROM WHERE THE RUNNING GLIDE IS NOW
+            MoniqueTuningData *const tuning = synth_data->tuning;
+            freq_glide.start(tuning->get_frequency(root_note) * freq_glide.get_factor() /
+                                 tuning->get_frequency(root_note_),
+                             int(juce::jmax(10.0f, float(sample_rate * 0.5) * glide)));
+        }
 
-  public:
-    //==========================================================================
-    COLD mono_BlitSaw() noexcept
-        : phase_offset(0), last_tick_value(0), p_(0), C2_(0), phase_correction(0), a_(0), state_(0),
-          m_(0)
-    {
+        root_note = root_note_;
     }
-    COLD ~mono_BlitSaw() noexcept {}
-
-    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(mono_BlitSaw)
-};
+    inline void reset() noexcept
+    {
+        cycle_counter.reset();
+        saw_generator.reset();
+        square_generator.reset();
+        blep_saw_generator.reset();
+        blep_square_generator.reset();
+        active_waves.reset();
+        modulator.reset();
 
-//==============================================================================
+        freq_glide.reset();
 
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-class mono_BlitSquare
-{
-    float last_tick_value;
-    float phase_offset;
-    double a_;
-    double p_;
-    double phase_correction;
-    double lastBlitOutput_;
-    double dcbState_;
+        sync_value = last_value;
+        sync_modulator_value = last_modulator_value;
+        sync_glide_samples = juce::jmax(10, msToSamplesFast(1, sample_rate));
+        sync_glide_samples_left = sync_glide_samples;
+    }
 
-    unsigned int m_;
+    void sample_rate_or_block_changed() noexcept override {}
 
   public:
-    //==========================================================================
-    inline float tick(double phase_) noexcept
-    {
-        // OUTPUT PROCESS
-        float out;
-        {
-            const double temp = lastBlitOutput_;
-            {
-                const double current_phase = (phase_ + phase_offset) - phase_correction;
-
-                // Avoid a divide by zero, or use of a denomralized divisor
-                // at the sinc peak, which has a limiting value of 1.0.
-                {
+    //==============================================================================
+    COLD MasterOSC(RuntimeNotifyer *const notifyer_, const MoniqueSynthData *synth_data_,
+                   const float *const sine_lookup_) noexcept
+        : RuntimeListener(notifyer_),
 
-                    const double denominator = std::sin(current_phase);
-                    if (std::fabs(denominator) < std::numeric_limits<double>::epsilon())
-                    {
-                        // Inexact comparison safely distinguishes between *close to zero*, and
-                        // *close to PI*.
-                        if (current_phase < 0.0001 ||
-                            current_phase > (juce::MathConstants<double>::pi +
-                                             juce::MathConstants<double>::pi) -
-                                                0.0001)
-                        {
-                            lastBlitOutput_ = a_;
-                        }
-                        else
-                        {
-                            lastBlitOutput_ = -a_;
-                        }
-                    }
-                    else
-                    {
-                        lastBlitOutput_ = std::sin(current_phase * m_) / (p_ * denominator);
-                    }
-                }
-            }
+          freq_glide(),
 
-            lastBlitOutput_ += temp;
+          sync_glide_samples(0), sync_glide_samples_left(0), last_value(0), last_modulator_value(0),
+          sync_value(0), sync_modulator_value(0),
 
-            // Now apply DC blocker.
-            out = lastBlitOutput_ - dcbState_ + 0.999f * last_tick_value;
-            dcbState_ = lastBlitOutput_;
-        }
+          root_note(60),
 
-        return last_tick_value = out;
-    }
-    inline float lastOut(void) const noexcept { return last_tick_value; }
+          last_root_note(0), root_frequency(0), last_frequency(0),
 
-    //==========================================================================
-    inline void set_phase_offset(float offset_) noexcept
-    {
-        phase_offset = offset_ * juce::MathConstants<float>::pi;
-    }
-    inline void updateHarmonics(double p) noexcept
-    {
-        p_ = p * 0.5;
-        m_ = (floor(0.5 * p_) + 1) * 2;
-        a_ = p / p;
+          last_modulator_frequency(0), modulator_sync_cylces(0), modulator_run_circle(0),
+          modulator_waits_for_sync_cycle(false),
 
-        phase_correction = (1.0 / p) * juce::MathConstants<double>::pi;
-    }
+          cycle_counter(notifyer_), saw_generator(), square_generator(), blep_saw_generator(),
+          blep_square_generator(), sine_generator(sine_lookup_), noise(), active_waves(),
 
-    //==========================================================================
-    inline void reset() noexcept
-    {
-        last_tick_value = 0;
-        dcbState_ = 0;
-        lastBlitOutput_ = 0;
-    }
+          modulator(notifyer_, sine_lookup_),
 
-  public:
-    //==========================================================================
-    COLD mono_BlitSquare() noexcept
-        : last_tick_value(0), phase_offset(0), a_(0), p_(0), phase_correction(0),
-          lastBlitOutput_(0), dcbState_(0), m_(0)
+          data_buffer(synth_data_->data_buffer), synth_data(synth_data_),
+          fm_osc_data(synth_data_->fm_osc_data.get()), osc_data(synth_data_->osc_datas[MASTER_OSC])
     {
     }
-    COLD ~mono_BlitSquare() noexcept {}
+    COLD ~MasterOSC() noexcept {}
 
-    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(mono_BlitSquare)
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(MasterOSC)
 };
 
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-class mono_SineWave
+//===================================================================================
+//===================================================================================
+//===================================================================================
+class SecondOSC : public RuntimeListener
 {
-    const float *const sine_lookup;
-
-    float last_tick_value;
-    float phase_offset;
+    const int id;
 
-  public:
-    //==========================================================================
-    inline float tick(double angle_) noexcept
-    {
-        return last_tick_value = lookup(sine_lookup, angle_ + phase_offset);
-    }
-    inline float lastOut() const noexcept { return last_tick_value; }
+    // RUNTIME
+    //==============================================================================
+    ExponentialGlide freq_glide;
 
-    //==========================================================================
-    inline void set_phase_offset(float offset_) noexcept
-    {
-        phase_offset = offset_ * juce::MathConstants<float>::pi;
-    }
+    float sync_glide_samples;
+    int sync_glide_samples_left;
+    float last_value;
+    float sync_value;
 
-  public:
-    //==========================================================================
-    COLD mono_SineWave(const float *sine_lookup_) noexcept
-        : sine_lookup(sine_lookup_), last_tick_value(0), phase_offset(0)
+    float root_note;
+    float last_root_note;
+    float last_tune;
+    float tuned_frequency; // WITHOUT THE GLIDE
+    float last_frequency;
+
+    bool wait_for_new_master_cycle;
+    float last_sync_was_to_tune;
+
+    // RAW OSCILATORS
+    //==============================================================================
+    PerfectCycleCounter cycle_counter;
+    mono_BlitSaw saw_generator;
+    mono_BlitSquare square_generator;
+    mono_PolyBlepSaw blep_saw_generator;
+    mono_PolyBlepSquare blep_square_generator;
+    mono_SineWave sine_generator;
+    mono_Noise noise;
+    ActiveWaves active_waves;
+
+    // DATA SOURCE
+    //==============================================================================
+    DataBuffer *const data_buffer;
+    const MoniqueSynthData *const synth_data;
+    OSCData *const osc_data;
+    OSCData *const master_osc_data;
+    FMOscData *const fm_osc_data;
+
+  public:
+    //==============================================================================
+    static inline bool is_syncanble_by_tune(float tune_) noexcept
     {
+        bool syncable = false;
+        if (tune_ == 0)
+        {
+            syncable = true;
+        }
+        else if (tune_ == 0 + 24)
+        {
+            syncable = true;
+        }
+        else if (tune_ == 0 - 24)
+        {
+            syncable = true;
+        }
+
+        return syncable;
     }
-    COLD ~mono_SineWave() noexcept {}
 
-    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(mono_SineWave)
-};
+    //==============================================================================
+    inline void process(DataBuffer *data_buffer_, const int num_samples_) noexcept
+    {
+        float *const output_buffer(data_buffer->osc_samples.getWritePointer(id));
 
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-class mono_SineWaveAutonom : public RuntimeListener
-{
-    const float *const sine_lookup;
+        const float *const switch_buffer(data_buffer->osc_switchs.getWritePointer());
+        const float *const modulator_buffer(
+            data_buffer->modulator_samples.getWritePointer(MASTER_OSC));
+        const float *const lfo_amps((data_buffer->lfo_amplitudes.getReadPointer(id)));
+
+        const bool is_lfo_modulated = osc_data->is_lfo_modulated;
 
-    double frequency;
+        const bool sync_to_master = osc_data->sync;
+        osc_data->tune_smoother.process_modulation(is_lfo_modulated, lfo_amps, num_samples_);
+        const float *const smoothed_tune_buffer(
+            osc_data->tune_smoother.get_smoothed_value_buffer());
+        const float *const smoothed_fm_amount_buffer(
+            osc_data->fm_amount_smoother.get_smoothed_value_buffer());
+        const float *const smoothed_wave_buffer(
+            osc_data->wave_smoother.get_smoothed_value_buffer());
+        // const float*const smoothed_fm_swing_buffer(
+        // fm_osc_data->fm_swing_smoother.get_smoothed_modulated_value_buffer() );
+        const float *const smoothed_fm_phaser(
+            fm_osc_data->fm_shape_smoother.get_smoothed_value_buffer());
 
-    double delta;
-    double angle;
+        const bool use_blits = synth_data->osc_engine == OSC_ENGINE_BLIT;
+        active_waves.update(smoothed_wave_buffer, num_samples_, synth_data->only_active_osc_waves,
+                            use_blits, cycle_counter, saw_generator, square_generator);
+        for (int sid = 0; sid < num_samples_; ++sid)
+        {
+            // SETUP TUNE
+            const float tune = smoothed_tune_buffer[sid];
+            {
+                // FREQUENCY
+                if (freq_glide.is_gliding() || tune != last_tune || last_root_note != root_note)
+                {
+                    freq_glide.tick();
 
-    bool new_cycle;
+                    {
+                        if (tune != last_tune || last_root_note != root_note)
+                        {
+                            last_tune = tune;
+                            last_root_note = root_note;
+                            tuned_frequency = synth_data->tuning->get_frequency(root_note + tune);
+                        }
 
-    float last_tick_value;
+                        const float new_frequence =
+                            juce::jmax(5.0f, tuned_frequency * freq_glide.get_factor());
+                        if (new_frequence != last_frequency)
+                        {
+                            cycle_counter.set_frequency(new_frequence);
+                            square_generator.updateHarmonics(cycle_counter.get_cylces_per_sec());
+                            saw_generator.updateHarmonics(cycle_counter.get_cylces_per_sec());
+                            blep_square_generator.updateHarmonics(
+                                cycle_counter.get_cylces_per_sec());
+                            blep_saw_generator.updateHarmonics(cycle_counter.get_cylces_per_sec());
+                        }
+                    }
+                }
+            }
 
-  public:
-    //==========================================================================
-    inline float tick() noexcept
-    {
-        new_cycle = false;
+            // PROCESS OSC AND SYNC IT TO THE MASTER
+            const bool is_last_sample_of_master_cycle = switch_buffer[sid];
+            float sample = 0;
+            // WHILE WAITING FOR THE MASTER THE GENERATORS HOLD THEIR LAST VALUE
+            float sine_sample = sine_generator.lastOut();
+            float square_sample =
+                use_blits ? square_generator.lastOut() : blep_square_generator.lastOut();
+            float saw_sample = use_blits ? saw_generator.lastOut() : blep_saw_generator.lastOut();
+            {
+                // TICK THE HEARD OSCILATTORS
+                if (!wait_for_new_master_cycle)
+                {
+                    cycle_counter.tick();
+                    if (active_waves.saw)
+                    {
+                        const double phase = cycle_counter.get_last_phase();
+                        saw_sample = use_blits ? saw_generator.tick(phase)
+                                               : blep_saw_generator.tick(phase);
+                    }
+                    {
+                        double angle = cycle_counter.get_last_angle();
+                        if (active_waves.square)
+                        {
+                            square_sample = use_blits ? square_generator.tick(angle)
+                                                      : blep_square_generator.tick(angle);
+                        }
+                        if (active_waves.sine)
+                        {
+                            sine_sample = sine_generator.tick(angle);
+                        }
+                    }
+                }
 
-        angle += delta;
-        if (angle > (juce::MathConstants<double>::pi + juce::MathConstants<double>::pi))
-        {
-            angle -= (juce::MathConstants<double>::pi + juce::MathConstants<double>::pi);
-            new_cycle = true;
+                // FORCE SYNC OF THE SINE AT THE NEXT SID
+                if (cycle_counter.is_new_cycle())
+                {
+                    const bool syncanble_by_tune = is_syncanble_by_tune(tune);
+                    if (!syncanble_by_tune)
+                    {
+                        last_sync_was_to_tune = -25;
+                    }
+                    if (sync_to_master)
+                    {
+                        if (!is_lfo_modulated && !syncanble_by_tune &&
+                            last_sync_was_to_tune != tune)
+                        {
+                            wait_for_new_master_cycle = true;
+                        }
+                    }
+                    else
+                    {
+                        if (!is_lfo_modulated && !freq_glide.is_gliding())
+                        {
+                            if (syncanble_by_tune && last_sync_was_to_tune != tune)
+                            {
+                                wait_for_new_master_cycle = true;
+                                last_sync_was_to_tune = tune;
+                            }
+                        }
+                    }
+                }
+                if (is_last_sample_of_master_cycle)
+                {
+                    wait_for_new_master_cycle = false;
+                }
+
+                // CALC THE SAMPLE MIX
+                if (!wait_for_new_master_cycle)
+                {
+                    const float wave_form = smoothed_wave_buffer[sid];
+
+                    // SINE - SQUARE
+                    if (wave_form <= 1)
+                    {
+                        const float multi = wave_form;
+                        const float sine_wave_powerd = sine_sample * (1.0f - multi);
+                        const float square_wave_powerd = square_sample * multi;
+                        sample = sine_wave_powerd + square_wave_powerd;
+                    }
+                    // SQUARE - SAW
+                    else if (wave_form <= 2)
+                    {
+                        const float multi = wave_form - 1;
+                        const float square_wave_powerd = square_sample * (1.0f - multi);
+                        const float saw_wave_powerd = saw_sample * multi;
+                        sample = square_wave_powerd + saw_wave_powerd;
+                    }
+                    // SAW - RAND
+                    else /*if( wave_form <= 3 )*/
+                    {
+                        const float multi = wave_form - 2;
+                        const float saw_wave_powerd = saw_sample * (1.0f - multi);
+                        const float noice_powerd = noise.tick() * multi;
+                        sample = saw_wave_powerd + noice_powerd;
+                    }
+                }
+            }
+
+            // ADD FM TO THE OUTPUT
+            {
+                if (const float fm_amount = smoothed_fm_amount_buffer[sid])
+                {
+                    float modulator_sample = modulator_buffer[sid];
+                    const float phase_move =
+                        smoothed_fm_phaser[sid]; // * jmin(1.0f,smoothed_fm_swing_buffer[sid]*80);
+                    sample = (1.0f - fm_amount) * sample +
+                             fm_amount * ((1.0f - phase_move) * sample * modulator_sample +
+                                          phase_move * (modulator_sample * modulator_sample *
+                                                        modulator_sample * sample));
+                }
+
+                if (--sync_glide_samples_left > 0)
+                {
+                    const float power = 1.0f / sync_glide_samples * sync_glide_samples_left;
+                    sample = sample * (1.0f - power) + sync_value * power;
+                }
+
+                output_buffer[sid] = sample;
+            }
         }
 
-        return last_tick_value = lookup(sine_lookup, angle);
-    }
-    inline float lastOut_with_phase_offset(float offset_) noexcept
-    {
-        return lookup(sine_lookup, angle + offset_ * (juce::MathConstants<double>::pi +
-                                                      juce::MathConstants<double>::pi));
+        last_value = output_buffer[num_samples_ - 1];
     }
-    inline float lastOut() const noexcept { return last_tick_value; }
 
-    //==========================================================================
-    inline void set_frequency(double frequency_) noexcept
+    //==============================================================================
+    inline void update(float root_note_, int sample_pos_) noexcept
     {
-        if (frequency != frequency_)
+        root_note_ += synth_data->octave_offset * 12;
+        const float glide = synth_data->glide_smoother.get_smoothed_value_buffer()[sample_pos_];
+        if (glide != 0 && (root_note != root_note_ || freq_glide.is_gliding()))
         {
-            frequency = frequency_;
-            delta = frequency_ / sample_rate *
-                    (juce::MathConstants<double>::pi + juce::MathConstants<double>::pi);
+            root_note_ = juce::jmax(1.0f, juce::jmin(127.0f, root_note_));
+
+            // FROM WHERE THE RUNNING GLIDE IS NOW
+            MoniqueTuningData *const tuning = synth_data->tuning;
+            freq_glide.start(tuning->get_frequency(root_note) * freq_glide.get_factor() /
+                                 tuning->get_frequency(root_note_),
+                             int((sample_rate * 0.5) * glide));
         }
+
+        root_note = root_note_;
     }
-    inline void overwrite_angle(float angle_) noexcept { angle = angle_; }
+    inline void reset() noexcept
+    {
+        cycle_counter.reset();
+        saw_generator.reset();
+        square_generator.reset();
+        blep_saw_generator.reset();
+        blep_square_generator.reset();
+        active_waves.reset();
 
-    //==========================================================================
-    inline bool is_new_cycle() const noexcept { return new_cycle; }
+        freq_glide.reset();
 
-    inline void sample_rate_or_block_changed() noexcept override
-    {
-        float frequency_old = frequency;
-        frequency = 0;
-        set_frequency(frequency_old);
+        wait_for_new_master_cycle = false;
+
+        sync_value = last_value;
+        sync_glide_samples = juce::jmax(10, msToSamplesFast(1, sample_rate));
+        sync_glide_samples_left = sync_glide_samples;
     }
+    void sample_rate_or_block_changed() noexcept override {}
 
   public:
-    //==========================================================================
-    COLD mono_SineWaveAutonom(RuntimeNotifyer *const notifyer_,
-                              const float *const sine_lookup_) noexcept
+    //==============================================================================
+    COLD SecondOSC(RuntimeNotifyer *const notifyer_, const MoniqueSynthData *synth_data_, int id_,
+                   const float *const sine_lookup_) noexcept
         : RuntimeListener(notifyer_),
 
-          sine_lookup(sine_lookup_), frequency(0),
+          id(id_),
+
+          freq_glide(),
+
+          sync_glide_samples(0), sync_glide_samples_left(0), last_value(0), sync_value(0),
+
+          root_note(60), last_root_note(0), last_tune(-25), tuned_frequency(0), last_frequency(0),
 
-          delta(0), angle(0),
+          wait_for_new_master_cycle(false), last_sync_was_to_tune(-25),
 
-          new_cycle(0),
+          cycle_counter(notifyer_), saw_generator(), square_generator(), blep_saw_generator(),
+          blep_square_generator(), sine_generator(sine_lookup_), noise(), active_waves(),
 
-          last_tick_value(0)
+          data_buffer(synth_data_->data_buffer), synth_data(synth_data_),
+          osc_data(synth_data_->osc_datas[id_]),
+          master_osc_data(synth_data_->osc_datas[MASTER_OSC]),
+          fm_osc_data(synth_data_->fm_osc_data.get())
     {
     }
-    COLD ~mono_SineWaveAutonom() noexcept {}
+    COLD ~SecondOSC() noexcept {}
 
-    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(mono_SineWaveAutonom)
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(SecondOSC)
 };
 
 //==============================================================================
@@ -848,253 +865,171 @@ class mono_SineWaveAutonom : public RuntimeListener
 //==============================================================================
 //==============================================================================
 //==============================================================================
-class mono_SineWaveAutonomShifted : public RuntimeListener
+class mono_ENVOsccilator : public RuntimeListener
 {
     const float *const sine_lookup;
+    const float *const cos_lookup;
+    const float *const exp_lookup;
 
-    double frequency;
+    float start_amp;
+    float out_amp;
+    float target_amp;
+    enum TYPE
+    {
+        ATTACK,
+        RELEASE,
+        KEEP
+    };
+    TYPE type;
 
-    double delta;
-    double angle;
+    float delta;
+    float angle;
+    float sine_angle_start;
 
-    bool new_cycle;
-
-    float last_tick_value;
+    float shape;
+    float time_in_samples;
+    int sample_counter;
+    bool is_unlimited;
 
   public:
     //==========================================================================
-    inline float tick() noexcept
+    // SHAPE 0 - sine-, 1 - linear, 2 - sine+
+    inline void set_process_values(float start_value_, float end_value_, float shape_,
+                                   float time_in_samples_) noexcept
     {
-        new_cycle = false;
-
-        angle += delta;
-        if (angle - (juce::MathConstants<double>::pi * 0.5) >
-            (juce::MathConstants<double>::pi + juce::MathConstants<double>::pi))
-        {
-            angle -= (juce::MathConstants<double>::pi + juce::MathConstants<double>::pi);
-            new_cycle = true;
-        }
-
-        return last_tick_value = (lookup(sine_lookup, angle) * -1 + 1) * 0.5;
+        start_amp = start_value_;
+        target_amp = end_value_;
+        shape = ((shape_ + 1) * 0.5f) * 0.9f + 0.1;
+        time_in_samples = time_in_samples_;
     }
-    inline float lastOut() const noexcept { return last_tick_value; }
-
-    //==========================================================================
-    inline void set_frequency(double frequency_) noexcept
+    inline void calculate_attack_coeffecients() noexcept
     {
-        if (frequency != frequency_)
-        {
-            frequency = frequency_;
-            delta = frequency_ / sample_rate *
-                    (juce::MathConstants<double>::pi + juce::MathConstants<double>::pi);
-        }
+        sample_counter = time_in_samples;
+        angle = 0;
+        sine_angle_start = juce::MathConstants<float>::pi * 1.5f;
+        type = TYPE::ATTACK;
+        is_unlimited = false;
+        delta = juce::MathConstants<float>::pi / sample_counter;
     }
-
-    //==========================================================================
-    inline bool is_new_cycle() const noexcept { return new_cycle; }
-
-    //==========================================================================
-    inline void sample_rate_or_block_changed() noexcept override
+    inline void calculate_release_coeffecients() noexcept
     {
-        float frequency_old = frequency;
-        frequency = 0;
-        set_frequency(frequency_old);
+        sample_counter = time_in_samples;
+        angle = 0;
+        sine_angle_start = juce::MathConstants<float>::pi * 1.5f;
+        type = TYPE::RELEASE;
+        is_unlimited = false;
+        delta = juce::MathConstants<float>::pi / sample_counter;
     }
-
-  public:
-    //==========================================================================
-    COLD mono_SineWaveAutonomShifted(RuntimeNotifyer *const notifyer_,
-                                     const float *const sine_lookup_) noexcept
-        : RuntimeListener(notifyer_),
-
-          sine_lookup(sine_lookup_), frequency(0),
-
-          delta(0), angle(juce::MathConstants<double>::pi * 0.5),
-
-          new_cycle(0),
-
-          last_tick_value(0)
+    inline void calculate_keep_coeffecients() noexcept
     {
+        sample_counter = time_in_samples;
+        delta = 0;
+        angle = 0;
+        type = TYPE::KEEP;
+        is_unlimited = false;
     }
-    COLD ~mono_SineWaveAutonomShifted() noexcept {}
-
-    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(mono_SineWaveAutonomShifted)
-};
-
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-class mono_Noise
-{
-    juce::Random random;
-    float last_tick_value;
-
-  public:
-    //==========================================================================
-    inline float tick() noexcept { return last_tick_value = random.nextFloat() * 2 - 1; }
-    inline float lastOut() const noexcept { return last_tick_value; }
-
-  public:
-    //==========================================================================
-    COLD mono_Noise() noexcept : last_tick_value(0) {}
-    COLD ~mono_Noise() noexcept {}
-
-    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(mono_Noise)
-};
-
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-class mono_OnePole
-{
-    float last_tick_value;
-    float gain;
-    float a1, b;
-
-  public:
-    //==========================================================================
-    inline float tick(float input) noexcept
+    inline void calculate_unlimited_coeffecients() noexcept
     {
-        return last_tick_value = b * gain * input - a1 * last_tick_value;
+        sample_counter = 0;
+        delta = 0;
+        angle = 0;
+        type = TYPE::KEEP;
+        is_unlimited = true;
     }
-    inline float lastOut() const noexcept { return last_tick_value; }
-
-    //==========================================================================
-    inline void setPole(float thePole) noexcept
+    inline void only_calculate_new_target(float target_) noexcept
     {
-        if (thePole > 0)
-        {
-            b = 1.0f - thePole;
-        }
-        else
-        {
-            b = 1.0f + thePole;
-        }
-
-        a1 = -thePole;
+        // start_amp = out_amp;
+        target_amp = target_;
+        // sample_counter = time_in_samples;
+        // delta = (juce::MathConstants<float>::pi) / sample_counter;
+        // angle = 0;
     }
-    inline void setGain(float gain_) noexcept { gain = gain_; }
 
-  public:
     //==========================================================================
-    COLD mono_OnePole(float thePole = 0.9) noexcept : last_tick_value(0), gain(0), a1(0), b(0)
+    void sample_rate_or_block_changed() noexcept override
     {
-        this->setPole(thePole);
+        // AUTO RESET ON NEXT CYCLE
     }
-    COLD ~mono_OnePole() noexcept {}
-
-    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(mono_OnePole)
-};
-
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-class mono_Modulate : public RuntimeListener
-{
-    const float *const sine_lookup;
-
-    mono_SineWaveAutonomShifted vibrato;
-    mono_SineWaveAutonom swing;
-    mono_OnePole filter;
-    mono_Noise noise;
-
-    float last_tick_value;
-    float last_swing_frequency;
-    unsigned int noiseRate;
-    unsigned int noiseCounter;
 
   public:
     //==========================================================================
     inline float tick() noexcept
     {
-        // Compute periodic and random modulations.
-        last_tick_value = vibrato.tick();
-        if (++noiseCounter > noiseRate)
+        if (--sample_counter > 0)
+        {
+            if (delta != 0)
+            {
+                angle += delta;
+                /*shape*(angle-cos_for_angle)*/
+                const float angle_drift =
+                    lookup(exp_lookup, angle) * angle * shape +
+                    (angle + lookup(cos_lookup, angle + sine_angle_start)) * (1.0f - shape);
+                if (type == TYPE::ATTACK)
+                {
+                    out_amp = start_amp +
+                              ((lookup(sine_lookup, angle_drift + sine_angle_start) + 1) * 0.5f) *
+                                  (target_amp - start_amp);
+                }
+                else if (type == TYPE::RELEASE)
+                {
+                    out_amp = start_amp -
+                              ((lookup(sine_lookup, angle_drift + sine_angle_start) + 1) * 0.5f) *
+                                  (start_amp - target_amp);
+                }
+            }
+        }
+        else
         {
-            noise.tick();
-            noiseCounter = 0;
+            out_amp = target_amp;
         }
-        last_tick_value += filter.tick(noise.lastOut());
 
-        return last_tick_value * swing.tick();
+        return out_amp;
     }
-    inline float lastOut() const noexcept { return last_tick_value; }
 
+  public:
     //==========================================================================
-    inline void set_vibrato_frequency(float frequency_) noexcept
-    {
-        vibrato.set_frequency(frequency_);
-    }
-    inline void set_swing_frequency(float frequency_) noexcept
-    {
-        if (last_swing_frequency != frequency_)
-        {
-            if (frequency_ == 0)
-            {
-                swing.overwrite_angle(juce::MathConstants<float>::pi * 0.5);
-            }
-
-            last_swing_frequency = frequency_;
-            swing.set_frequency(frequency_);
-        }
-    }
-    inline bool is_next_a_new_cycle() const noexcept { return vibrato.is_new_cycle(); }
+    inline float last_out() const noexcept { return out_amp; }
+    inline void overwrite_current_value(float amp_) noexcept { out_amp = amp_; }
 
     //==========================================================================
-    inline void reset() noexcept { last_tick_value = 0; }
+    inline bool is_finished() const noexcept { return is_endless() && sample_counter <= 0; }
+    inline bool is_endless() const noexcept { return !is_unlimited; }
 
-    void sample_rate_or_block_changed() noexcept override
+    //==========================================================================
+    inline void reset() noexcept
     {
-        noiseRate = (unsigned int)(330.0 * sample_rate / 22050.0);
+        sample_counter = 0;
+        start_amp = 0;
+        out_amp = 0;
+        type = KEEP;
+        target_amp = 0;
+        delta = 0;
+        angle = 0;
+        time_in_samples = 0;
+        sample_counter = 0;
+        is_unlimited = false;
     }
 
   public:
     //==========================================================================
-    COLD mono_Modulate(RuntimeNotifyer *const notifyer_, const float *const sine_lookup_) noexcept
-        : RuntimeListener(notifyer_),
-
-          sine_lookup(sine_lookup_),
+    COLD mono_ENVOsccilator(RuntimeNotifyer *const notifyer_, const float *const sine_lookup_,
+                            const float *const cos_lookup_, const float *const exp_lookup_) noexcept
 
-          vibrato(notifyer_, sine_lookup_), swing(notifyer_, sine_lookup_),
+        : RuntimeListener(notifyer_), sine_lookup(sine_lookup_), cos_lookup(cos_lookup_),
+          exp_lookup(exp_lookup_),
 
-          filter(), noise(),
+          start_amp(0), out_amp(0), target_amp(0), type(KEEP),
 
-          last_tick_value(0), last_swing_frequency(0), noiseRate(0), noiseCounter(0)
-    {
-        vibrato.set_frequency(6.0);
-        swing.set_frequency(0);
-        swing.overwrite_angle(juce::MathConstants<float>::pi * 0.5);
+          delta(0), angle(0), sine_angle_start(0),
 
-        noiseRate = (unsigned int)(330.0 * sample_rate / 22050.0);
-        noiseCounter = noiseRate;
+          shape(0),
 
-        filter.setPole(0.999);
-        filter.setGain(0.05);
+          time_in_samples(0), sample_counter(0), is_unlimited(false)
+    {
     }
-    COLD ~mono_Modulate() noexcept {}
+    COLD ~mono_ENVOsccilator() noexcept {}
 
-    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(mono_Modulate)
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(mono_ENVOsccilator)
 };
 
 //==============================================================================
@@ -1107,265 +1042,233 @@ class mono_Modulate : public RuntimeListener
 //==============================================================================
 //==============================================================================
 //==============================================================================
-class LFO : public RuntimeListener
+enum STAGES
 {
-    const float *const sine_lookup;
-
-    float delta;
-    float angle;
-    int last_samples_per_clock;
+    END_ENV = false,
+    ATTACK = true,
+    DECAY,
+    SUSTAIN,
+    RELEASE,
+    TRIGGER_START
+};
+class ENV : RuntimeListener
+{
+    mono_ENVOsccilator env_osc;
 
-    int last_speed;
-    float last_out;
+    STAGES current_stage;
 
-    float glide_samples;
-    int glide_counter;
-    float glide_value;
+    const MoniqueSynthData *const synth_data;
+    float last_sustain;
+    bool goes_to_sustain;
+    bool is_sustain;
 
-    DataBuffer *const data_buffer;
-    const LFOData *const lfo_data;
-    const RuntimeInfo *const runtime_info;
+  public:
+    ENVData *const env_data;
 
-    //==============================================================================
-    inline void calculate_delta(const int samples_per_clock_, const float speed_multi_,
-                                const std::int64_t sync_sample_pos_) noexcept
+  public:
+    //==========================================================================
+    inline void process(float *dest_, const int num_samples_) noexcept
     {
-        if (last_samples_per_clock != samples_per_clock_)
+        const float *smoothed_sustain_buffer =
+            env_data->sustain_smoother.get_smoothed_value_buffer();
+        for (int sid = 0; sid < num_samples_; ++sid)
         {
+            const float sustain = smoothed_sustain_buffer[sid];
+            if (last_sustain != sustain)
             {
-                const float samples_per_bar = samples_per_clock_ * 96;
-                const float samples_per_cylce = samples_per_bar * speed_multi_;
-                delta = (1.0f / samples_per_cylce);
+                last_sustain = sustain;
+                if (goes_to_sustain)
+                {
+                    env_osc.only_calculate_new_target(last_sustain);
+                }
+                else if (is_sustain)
+                {
+                    env_osc.overwrite_current_value(last_sustain);
+                }
             }
+            dest_[sid] = env_osc.tick();
 
-            last_samples_per_clock = samples_per_clock_;
+            if (env_osc.is_finished())
+            {
+                update_stage(sid);
+            }
         }
     }
 
-  public:
-    inline void process(float *dest_, int step_number_, int absoloute_step_number_,
-                        int start_pos_in_buffer_, int num_samples_, bool use_process_sample = true,
-                        juce::Array<RuntimeInfo::standalone_features::ClockSync::SyncPosPair>
-                            *clock_infos_ = nullptr) noexcept
+  private:
+    inline void update_stage(int sid_, bool force_relese_ = false) noexcept
     {
-        // USER SPEED
-        const int speed(lfo_data->speed);
-        const float speed_multi(get_lfo_speed_multi(speed));
-        if (speed != last_speed)
+        const float *smoothed_sustain_buffer =
+            env_data->sustain_smoother.get_smoothed_value_buffer();
+        const float *smoothed_shape_buffer = env_data->shape_smoother.get_smoothed_value_buffer();
+        switch (current_stage)
         {
-            glide_samples = glide_counter = sample_rate / 1000;
-            glide_value = last_out;
-            last_speed = speed;
-        }
-
-        // TO MIDI CLOCK SYNC
-        std::int64_t sync_sample_pos =
-            (runtime_info->relative_samples_since_start + start_pos_in_buffer_);
-        if (!use_process_sample)
+        case TRIGGER_START: // --> ATTACK
         {
-            sync_sample_pos = start_pos_in_buffer_;
-        }
-
-        bool same_samples_per_block_for_buffer = true;
-        if (is_standalone() && runtime_info->standalone_features_pimpl->is_extern_synced)
-        {
-            auto &runtime_info_standalone_features = *runtime_info->standalone_features_pimpl;
-
-            juce::Array<RuntimeInfo::standalone_features::ClockSync::SyncPosPair>
-                clock_informations =
-                    clock_infos_ ? *clock_infos_
-                                 : runtime_info_standalone_features.clock_sync_information
-                                       .get_a_working_copy();
-
-            if (!runtime_info_standalone_features.clock_sync_information.has_clocks_inside())
+            if (env_data->decay > 0)
             {
-                same_samples_per_block_for_buffer = true;
-                calculate_delta(runtime_info_standalone_features.clock_sync_information
-                                    .get_last_samples_per_clock(),
-                                speed_multi, sync_sample_pos);
+                env_osc.set_process_values(env_osc.last_out(), 1, smoothed_shape_buffer[sid_],
+                                           get_env_samples(env_data->attack, sample_rate));
+                goes_to_sustain = false;
+                is_sustain = false;
             }
             else
             {
-                same_samples_per_block_for_buffer = false;
+                env_osc.set_process_values(env_osc.last_out(), smoothed_sustain_buffer[sid_],
+                                           smoothed_shape_buffer[sid_],
+                                           get_env_samples(env_data->attack, sample_rate));
+                goes_to_sustain = true;
+                is_sustain = false;
             }
 
-            if (sync_sample_pos <= 0)
-            {
-                angle = 0;
-            }
+            env_osc.calculate_attack_coeffecients();
+            current_stage = ATTACK;
 
-            // FORCE SYNC
-            if (step_number_ != -1)
+            break;
+        }
+        case ATTACK: // --> DECAY
+        {
+            const float decay = env_data->decay;
+            if (decay > 0)
             {
-                bool should_smooth = false;
-                if (fmod(absoloute_step_number_, speed_multi * 16) == 0)
-                {
-                    should_smooth = angle != 0;
-                    angle = 0;
-                }
+                env_osc.set_process_values(env_osc.last_out(), smoothed_sustain_buffer[sid_],
+                                           smoothed_shape_buffer[sid_],
+                                           get_env_samples(decay, sample_rate));
+                goes_to_sustain = true;
+                is_sustain = false;
+                env_osc.calculate_release_coeffecients();
 
-                if (should_smooth && glide_counter <= 0)
-                {
-                    glide_samples = glide_counter = juce::jmax(10.0, sample_rate / 1000);
-                    glide_value = last_out;
-                }
-            }
+                current_stage = DECAY;
 
-            // PROCESS
+                break;
+            }
+            // ELSE FALL TO DECAY AND START SUSTAIN LEVEL
+            [[fallthrough]];
+        }
+        case DECAY: // --> SUSTAIN
+        {
+            const float sustain_time = env_data->sustain_time;
+            const float sustain_level = smoothed_sustain_buffer[sid_];
+            if (sustain_time >= 1)
             {
-                const float *smoothed_wave_buffer(
-                    lfo_data->wave_smoother.get_smoothed_value_buffer());
-                const float *smoothed_offset_buffer(
-                    lfo_data->phase_shift_smoother.get_smoothed_value_buffer());
-                for (int sid = 0; sid != num_samples_; ++sid)
-                {
-                    if (++sync_sample_pos < 0)
-                    {
-                        continue;
-                    }
-
-                    {
-                        float amp;
-                        {
-                            // CURRENT ANGLE
-                            {
-                                if (!same_samples_per_block_for_buffer)
-                                {
-                                    calculate_delta(
-                                        runtime_info_standalone_features.clock_sync_information
-                                            .get_samples_per_clock(start_pos_in_buffer_ + sid,
-                                                                   clock_informations),
-                                        speed_multi, sync_sample_pos);
-                                }
-                                angle += delta;
-                                angle = angle - floor(angle);
-                            }
-
-                            // AMP
-                            {
-                                const float sine_amp =
-                                    lookup(sine_lookup, angle * juce::MathConstants<double>::twoPi +
-                                                            smoothed_offset_buffer[sid] *
-                                                                juce::MathConstants<double>::twoPi);
-                                const float wave = smoothed_wave_buffer[sid];
-                                amp = sine_amp * (1.0f - wave) +
-                                      (std::atan(sine_amp * 250 * juce::jmax(speed_multi, 1.0f)) *
-                                       (1.0f / 1.55)) *
-                                          wave;
-                                if (amp > 1)
-                                {
-                                    amp = 1;
-                                }
-                                else if (amp < -1)
-                                {
-                                    amp = -1;
-                                }
-                                amp = lfo2amp(amp);
-                            }
-                        }
-
-                        if (--glide_counter > 0)
-                        {
-                            float glide = (1.0f / glide_samples * glide_counter);
-                            amp = amp * (1.0f - glide) + glide_value * glide;
-                        }
-
-                        dest_[sid] = amp;
-                    }
-                }
-                last_out = dest_[num_samples_ - 1];
+                env_osc.set_process_values(env_osc.last_out(), sustain_level,
+                                           smoothed_shape_buffer[sid_],
+                                           get_env_samples(sustain_time, sample_rate));
+                env_osc.calculate_unlimited_coeffecients();
+                is_sustain = true;
+                goes_to_sustain = false;
+            }
+            else
+            {
+                env_osc.set_process_values(
+                    env_osc.last_out(), sustain_level, smoothed_shape_buffer[sid_],
+                    juce::jmax(20.0f, get_env_samples(sustain_time, sample_rate)));
+                env_osc.calculate_release_coeffecients();
+                is_sustain = true;
+                goes_to_sustain = false;
             }
+            current_stage = SUSTAIN;
+
+            break;
         }
-        else
-        // PERFECT SYNC
+        case SUSTAIN: // --> RELEASE or RETRIGGER
         {
-            const float bars_per_sec = runtime_info->bpm / 4 / 60;
-            const float samples_per_bar = (1.0f / bars_per_sec) * sample_rate;
-            const float samples_per_cylce = samples_per_bar * speed_multi;
-            const float cycles_per_sample = (1.0 / samples_per_cylce);
+            const float sustain_time = env_data->sustain_time;
+            if (force_relese_)
+            {
+                env_osc.set_process_values(env_osc.last_out(), 0, smoothed_shape_buffer[sid_],
+                                           get_env_samples(env_data->release, sample_rate));
+                goes_to_sustain = false;
+                is_sustain = false;
+                env_osc.calculate_release_coeffecients();
 
-            // PROCESS
+                current_stage = RELEASE;
+            }
+            // RETRIGGER
+            else
             {
-                const float *smoothed_wave_buffer(
-                    lfo_data->wave_smoother.get_smoothed_value_buffer());
-                const float *smoothed_offset_buffer(
-                    lfo_data->phase_shift_smoother.get_smoothed_value_buffer());
-                for (int sid = 0; sid != num_samples_; ++sid)
-                {
-                    float amp;
-                    {
-                        angle = cycles_per_sample * sync_sample_pos;
-                        angle = angle - floor(angle);
+                start_attack();
+            }
 
-                        // AMP
-                        {
-                            const float sine_amp =
-                                lookup(sine_lookup, angle * juce::MathConstants<double>::twoPi +
-                                                        smoothed_offset_buffer[sid] *
-                                                            juce::MathConstants<double>::twoPi);
-                            const float wave = smoothed_wave_buffer[sid];
-                            amp = sine_amp * (1.0f - wave) +
-                                  (std::atan(sine_amp * 250 * juce::jmax(speed_multi, 1.0f)) *
-                                   (1.0f / 1.55)) *
-                                      wave;
-                            if (amp > 1)
-                            {
-                                amp = 1;
-                            }
-                            else if (amp < -1)
-                            {
-                                amp = -1;
-                            }
-                            amp = lfo2amp(amp);
-                        }
-                    }
+            break;
+        }
+        case RELEASE: // --> RELEASE
+        {
+            goes_to_sustain = false;
+            is_sustain = false;
+            current_stage = END_ENV;
 
-                    if (glide_counter > 0 && false)
-                    {
-                        --glide_counter;
-                        float glide = (1.0f / glide_samples * glide_counter);
-                        amp = amp * (1.0f - glide) + glide_value * glide;
-                    }
+            break;
+        }
+        default:
+        {
+            goes_to_sustain = false;
+            is_sustain = false;
+            current_stage = END_ENV;
+        }
+        }
+    }
 
-                    dest_[sid] = amp;
+  public:
+    //==========================================================================
+    inline void start_attack() noexcept
+    {
+        current_stage = TRIGGER_START;
+        update_stage(0);
+    }
+    inline void set_to_release() noexcept
+    {
+        current_stage = SUSTAIN;
+        update_stage(0, true);
+    }
+    inline void reset() noexcept
+    {
+        current_stage = END_ENV;
 
-                    ++sync_sample_pos;
-                }
-                last_out = dest_[num_samples_ - 1];
-            }
-        }
+        last_sustain = 0;
+        goes_to_sustain = false;
+        is_sustain = false;
+        env_osc.reset();
     }
 
-    void sample_rate_or_block_changed() noexcept override { last_speed = -1; }
+    //==============================================================================
+    inline STAGES get_current_stage() const noexcept { return current_stage; }
+    inline void set_current_stage(STAGES current_stage_) noexcept
+    {
+        current_stage = current_stage_;
+    }
+    inline void overwrite_current_value(float amp_) noexcept
+    {
+        env_osc.overwrite_current_value(amp_);
+        last_sustain = amp_;
+    }
+    inline bool is_endless() noexcept { return env_osc.is_endless(); }
 
-    //==========================================================================
-    float get_current_amp() const noexcept { return last_out; }
+    //==============================================================================
+    inline float get_amp() const noexcept { return env_osc.last_out(); }
 
-    //==========================================================================
-    void reset() noexcept { last_out = 0; }
+    //==============================================================================
+    void sample_rate_or_block_changed() noexcept override {}
 
   public:
-    //==========================================================================
-    LFO(RuntimeNotifyer *const notifyer_, MoniqueSynthData *synth_data_, LFOData *lfo_data_,
-        const float *const sine_lookup_)
-    noexcept
-        : RuntimeListener(notifyer_),
-
-          sine_lookup(sine_lookup_),
+    //==============================================================================
+    inline ENV(RuntimeNotifyer *const notifyer_, const MoniqueSynthData *synth_data_,
+               ENVData *env_data_, const float *const sine_lookup_, const float *const cos_lookup_,
+               const float *const exp_lookup_) noexcept
+        : RuntimeListener(notifyer_), env_osc(notifyer_, sine_lookup_, cos_lookup_, exp_lookup_),
 
-          delta(0), angle(0), last_samples_per_clock(-1),
+          current_stage(END_ENV),
 
-          last_speed(0), last_out(0),
+          synth_data(synth_data_),
 
-          glide_samples(0), glide_counter(0), glide_value(0),
+          last_sustain(0), goes_to_sustain(false), is_sustain(false),
 
-          data_buffer(synth_data_->data_buffer), lfo_data(lfo_data_),
-          runtime_info(synth_data_->runtime_info)
+          env_data(env_data_)
     {
     }
-    ~LFO() noexcept {}
+    inline ~ENV() noexcept {}
 
-    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(LFO)
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ENV)
 };
 
 //==============================================================================
@@ -1378,2943 +1281,1147 @@ class LFO : public RuntimeListener
 //==============================================================================
 //==============================================================================
 //==============================================================================
-class MasterOSC : public RuntimeListener
-{
-    // RUNTIME
-    //==============================================================================
-    int freq_glide_samples_left;
-    float freq_glide_delta;
-
-    float sync_glide_samples;
-    int sync_glide_samples_left;
-    float last_value;
-    float last_modulator_value;
-    float sync_value;
-    float sync_modulator_value;
+//==============================================================================
+//==============================================================================
+//==============================================================================
 
-    float root_note;
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+template <int smooth_samples> class AmpSmoother
+{
+    float current_value;
+    float target_value;
+    float delta;
+    int counter;
 
-    float last_root_note;
-    float last_frequency;
+  private:
+    inline void glide_tick() noexcept;
 
-    float last_modulator_frequency;
-    int modulator_sync_cylces;
-    int modulator_run_circle;
-    bool modulator_waits_for_sync_cycle;
+  public:
+    inline float add_get(float in_) noexcept;
+    bool is_up_to_date() const noexcept;
+    inline float add_get_and_keep_current_time(float in_) noexcept;
+    inline void reset(float value_ = 0) noexcept;
+    inline float get_current_value() const noexcept;
 
-    // RAW OSCILATORS
-    //==============================================================================
-    PerfectCycleCounter cycle_counter;
-    mono_BlitSaw saw_generator;
-    mono_BlitSquare square_generator;
-    mono_SineWave sine_generator;
-    mono_Noise noise;
+    COLD AmpSmoother(float start_value_ = 0) noexcept;
+    COLD ~AmpSmoother() noexcept;
 
-    mono_Modulate modulator;
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(AmpSmoother)
+};
 
-    // DATA SOURCE
-    //==============================================================================
-    DataBuffer *const data_buffer;
-    const MoniqueSynthData *const synth_data;
-    FMOscData *const fm_osc_data;
-    OSCData *const osc_data;
+//==============================================================================
+template <int smooth_samples>
+COLD AmpSmoother<smooth_samples>::AmpSmoother(float start_value_) noexcept
+    : current_value(0), target_value(start_value_), delta(0), counter(0)
+{
+}
+template <int smooth_samples> COLD AmpSmoother<smooth_samples>::~AmpSmoother() noexcept {}
 
-  public:
-    //==============================================================================
-    inline void process(DataBuffer *data_buffer_, const int num_samples_) noexcept
+//==============================================================================
+template <int smooth_samples> inline float AmpSmoother<smooth_samples>::add_get(float in_) noexcept
+{
+    if (current_value != in_ || target_value != in_)
     {
-        float *const output_buffer(data_buffer->osc_samples.getWritePointer(MASTER_OSC));
-
-        float *const switch_buffer(data_buffer->osc_switchs.getWritePointer());
-        juce::FloatVectorOperations::clear(switch_buffer, num_samples_);
-        float *const modulator_buffer(data_buffer->modulator_samples.getWritePointer(MASTER_OSC));
-        const float *const lfo_amps((data_buffer->lfo_amplitudes.getReadPointer(MASTER_OSC)));
+        // ONLY UPDATE IF WE HAVE A NEW VALUE
+        if (target_value != in_)
+        {
+            counter = smooth_samples;
+            delta = (in_ - current_value) / smooth_samples;
+            target_value = in_;
+        }
 
-        const bool is_lfo_modulated = osc_data->is_lfo_modulated;
-        const bool fm_sync = fm_osc_data->sync;
+        glide_tick();
+    }
 
-        fm_osc_data->master_shift_smoother.process_modulation(is_lfo_modulated, lfo_amps,
-                                                              num_samples_);
+    return current_value;
+}
+template <int smooth_samples> bool AmpSmoother<smooth_samples>::is_up_to_date() const noexcept
+{
+    return target_value == current_value;
+}
+template <int smooth_samples> inline void AmpSmoother<smooth_samples>::reset(float value_) noexcept
+{
+    current_value = value_;
+    delta = 0;
+    counter = 0;
+}
+template <int smooth_samples>
+inline float AmpSmoother<smooth_samples>::add_get_and_keep_current_time(float in_) noexcept
+{
+    if (current_value != in_ || target_value != in_)
+    {
+        // ONLY UPDATE IF WE HAVE A NEW VALUE
+        if (target_value != in_)
+        {
+            delta = (in_ - current_value) / counter;
+            target_value = in_;
+        }
 
-        // const float*const smoothed_tune_buffer(
-        // osc_data->tune_smoother.get_smoothed_modulated_value_buffer() );
-        const float *const smoothed_fm_amount_buffer(
-            osc_data->fm_amount_smoother.get_smoothed_value_buffer());
-        const float *const smoothed_wave_buffer(
-            osc_data->wave_smoother.get_smoothed_value_buffer());
-        const float *const smoothed_fm_freq_buffer(
-            fm_osc_data->fm_freq_smoother.get_smoothed_value_buffer());
-        const float *const smoothed_fm_swing_buffer(
-            fm_osc_data->fm_swing_smoother.get_smoothed_value_buffer());
-        const float *const smoothed_fm_phaser(
-            fm_osc_data->fm_shape_smoother.get_smoothed_value_buffer());
-        const float *const smoothed_phase_offset(
-            fm_osc_data->master_shift_smoother.get_smoothed_value_buffer());
+        glide_tick();
+    }
 
-        for (int sid = 0; sid < num_samples_; ++sid)
+    return current_value;
+}
+template <int smooth_samples> inline void AmpSmoother<smooth_samples>::glide_tick() noexcept
+{
+    if (--counter <= 0)
+        current_value = target_value;
+    else
+    {
+        current_value += delta;
+        if (current_value > 1 || current_value < 0)
         {
-            // SETUP TUNE
-            {
-                // BASE FREQUENCY
-                bool base_frequency_changed = false;
-                if (freq_glide_samples_left > 0 || last_root_note != root_note)
-                {
-                    if (freq_glide_samples_left > 0)
-                    {
-                        --freq_glide_samples_left;
-                    }
+            current_value = target_value;
+            counter = 0;
+        }
+    }
+}
+template <int smooth_samples>
+inline float AmpSmoother<smooth_samples>::get_current_value() const noexcept
+{
+    return current_value;
+}
 
-                    {
-                        last_root_note = root_note;
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+class FilterProcessor
+{
+    juce::OwnedArray<DoubleAnalogFilter> double_filter;
+    friend class mono_ParameterOwnerStore;
 
-                        const float new_frequence = juce::jmax(
-                            5.0f, synth_data->tuning->midiNoteToFrequency(
-                                      root_note + freq_glide_delta * freq_glide_samples_left));
-                        if (new_frequence != last_frequency)
-                        {
-                            cycle_counter.set_frequency(new_frequence);
-                            square_generator.updateHarmonics(cycle_counter.get_cylces_per_sec());
-                            saw_generator.updateHarmonics(cycle_counter.get_cylces_per_sec());
+  public:
+    std::unique_ptr<ENV> env;
+    juce::Array<ENVData *> input_env_datas;
+    juce::OwnedArray<ENV> input_envs;
 
-                            last_frequency = new_frequence;
-                        }
-                    }
+  private:
+    const int id;
 
-                    base_frequency_changed = true;
-                }
+    const MoniqueSynthData *const synth_data;
+    FilterData *const filter_data;
+    DataBuffer *const data_buffer;
 
-                // MODULATOR FREQUENCY
-                {
-                    const float modulator_freq = smoothed_fm_freq_buffer[sid];
-                    if (base_frequency_changed || modulator_freq != last_modulator_frequency)
-                    {
-                        modulator.set_vibrato_frequency(
-                            last_frequency + last_frequency * (modulator_freq * 6 + 1.01));
-                        modulator_sync_cylces = std::floor(modulator_freq * 6 + 1);
+    // THE BUFFERS OF THE FILTER DISTORTION AND THE FILTERS, AT THE OVERSAMPLED RATE IF ENABLED
+    struct FilterStage
+    {
+        int num_samples;
+        int coefficient_rate;
+        const float *resonance;
+        const float *cutoff;
+        const float *distortion;
+        float *inputs[SUM_INPUTS_PER_FILTER];
+        float *outputs[SUM_INPUTS_PER_FILTER];
+        bool input_is_silent[SUM_INPUTS_PER_FILTER];
+        bool skip[SUM_INPUTS_PER_FILTER]; // IF THE FILTER DOES NOT CHANGE ITS TYPE
+    } stage;
+    float last_resonance, last_cutoff, last_distortion;
+    TailBypass input_tails[SUM_INPUTS_PER_FILTER];
+#if JUCE_USE_SIMD
+    DoubleAnalogFilterLanes lanes;
+    FilterOversampler oversampler;
+#endif
 
-                        last_modulator_frequency = modulator_freq;
-                    }
-                }
+  public:
+    //==========================================================================
+    inline void start_attack() noexcept
+    {
+        start_env();
+        start_input_env(0);
+        start_input_env(1);
+        start_input_env(2);
+    }
+    inline void start_env() noexcept { env->start_attack(); }
+    inline void start_input_env(int id_) noexcept { input_envs.getUnchecked(id_)->start_attack(); }
+    inline void start_release() noexcept
+    {
+        start_env_release();
+        start_input_env_release(0);
+        start_input_env_release(1);
+        start_input_env_release(2);
+    }
+    inline void start_env_release() noexcept { env->set_to_release(); }
+    inline void start_input_env_release(int id_) noexcept
+    {
+        input_envs.getUnchecked(id_)->set_to_release();
+    }
 
-                // ADD PHASE SHIFT
-                square_generator.set_phase_offset(smoothed_phase_offset[sid]);
-                saw_generator.set_phase_offset(smoothed_phase_offset[sid]);
-                sine_generator.set_phase_offset(smoothed_phase_offset[sid]);
-            }
+    //==========================================================================
+    inline void reset() noexcept
+    {
+        env->reset();
+        for (int input_id = 0; input_id != SUM_INPUTS_PER_FILTER; ++input_id)
+        {
+            input_envs.getUnchecked(input_id)->reset();
+        }
 
-            // PROCESS OSC ITSELF
-            bool is_last_sample_of_cycle = false;
-            float sample;
+        // double_filter[0]->reset();
+        // double_filter[1]->reset();
+        // double_filter[2]->reset();
+    }
+
+  private:
+    //==========================================================================
+    inline void pre_process(const int input_id, const int num_samples) noexcept
+    {
+        // CALCULATE INPUTS AND ENVELOPS
+        {
             {
-                // TICK ALL OSCILATTORS
+                const int glide_modotr_time = synth_data->glide_motor_time;
+                if (id == FILTER_1)
                 {
-                    cycle_counter.tick();
-                    saw_generator.tick(cycle_counter.get_last_phase());
-                    {
-                        double angle = cycle_counter.get_last_angle();
-                        square_generator.tick(angle);
-                        sine_generator.tick(angle);
-                    }
+                    float *tmp_input_amp = data_buffer->filter_input_env_amps.getWritePointer(
+                        input_id + SUM_INPUTS_PER_FILTER * FILTER_1);
+                    ENV *const input_env(input_envs.getUnchecked(input_id));
+                    filter_data->input_smoothers[input_id]->process_amp(
+                        !filter_data->input_holds[input_id], glide_modotr_time, input_env,
+                        tmp_input_amp, num_samples);
 
-                    // FORCE SYNC OF THE SINE AT THE NEXT SID
-                    if (cycle_counter.is_new_cycle())
+                    float *filter_input_buffer =
+                        data_buffer->filter_input_samples.getWritePointer(input_id);
+                    const float *const osc_input_buffer =
+                        data_buffer->osc_samples.getReadPointer(input_id);
+                    for (int sid = 0; sid != num_samples; ++sid)
                     {
-                        // SET THE SWITCH
-                        is_last_sample_of_cycle = true;
-                        switch_buffer[sid] = true;
+                        filter_input_buffer[sid] = osc_input_buffer[sid] * tmp_input_amp[sid];
                     }
                 }
-
-                // CALC THE SAMPLE MIX
+                else if (id == FILTER_2)
                 {
-                    const float wave_form = smoothed_wave_buffer[sid];
+                    float *tmp_input_amp = data_buffer->filter_input_env_amps.getWritePointer(
+                        input_id + SUM_INPUTS_PER_FILTER * FILTER_2);
+                    ENV *const input_env(input_envs.getUnchecked(input_id));
+                    filter_data->input_smoothers[input_id]->process_amp(
+                        !filter_data->input_holds[input_id], glide_modotr_time, input_env,
+                        tmp_input_amp, num_samples);
 
-                    // SINE - SQUARE
-                    if (wave_form <= 1)
+                    float *const filter_input_buffer =
+                        data_buffer->filter_input_samples.getWritePointer(
+                            input_id + SUM_INPUTS_PER_FILTER * FILTER_2);
+                    const float *const filter_before_buffer =
+                        data_buffer->filter_output_samples.getReadPointer(
+                            input_id + SUM_INPUTS_PER_FILTER * FILTER_1);
+                    const float *const osc_input_buffer =
+                        data_buffer->osc_samples.getReadPointer(input_id);
+                    for (int sid = 0; sid != num_samples; ++sid)
                     {
-                        const float multi = wave_form;
-                        const float sine_wave_powerd = sine_generator.lastOut() * (1.0f - multi);
-                        const float square_wave_powerd = square_generator.lastOut() * multi;
-                        sample = sine_wave_powerd + square_wave_powerd;
+                        filter_input_buffer[sid] =
+                            tmp_input_amp[sid] < 0 ? osc_input_buffer[sid] * tmp_input_amp[sid] * -1
+                                                   : filter_before_buffer[sid] * tmp_input_amp[sid];
                     }
-                    // SQUARE - SAW
-                    else if (wave_form <= 2)
+                }
+                else
+                {
+                    float *tmp_input_amp_1 = data_buffer->filter_input_env_amps.getWritePointer(
+                        0 + SUM_INPUTS_PER_FILTER * FILTER_3);
+                    float *tmp_input_amp_2 = data_buffer->filter_input_env_amps.getWritePointer(
+                        1 + SUM_INPUTS_PER_FILTER * FILTER_3);
+                    float *tmp_input_amp_3 = data_buffer->filter_input_env_amps.getWritePointer(
+                        2 + SUM_INPUTS_PER_FILTER * FILTER_3);
                     {
-                        const float multi = wave_form - 1;
-                        const float square_wave_powerd =
-                            square_generator.lastOut() * (1.0f - multi);
-                        const float saw_wave_powerd = saw_generator.lastOut() * multi;
-                        sample = square_wave_powerd + saw_wave_powerd;
+                        ENV *const input_env(input_envs.getUnchecked(0));
+                        filter_data->input_smoothers[0]->process_amp(!filter_data->input_holds[0],
+                                                                     glide_modotr_time, input_env,
+                                                                     tmp_input_amp_1, num_samples);
                     }
-                    // SAW - RAND
-                    else /*if( wave_form <= 3 )*/
                     {
-                        const float multi = wave_form - 2;
-                        const float saw_wave_powerd = saw_generator.lastOut() * (1.0f - multi);
-                        const float noice_powerd = noise.tick() * multi;
-                        sample = saw_wave_powerd + noice_powerd;
+                        ENV *const input_env(input_envs.getUnchecked(1));
+                        filter_data->input_smoothers[1]->process_amp(!filter_data->input_holds[1],
+                                                                     glide_modotr_time, input_env,
+                                                                     tmp_input_amp_2, num_samples);
+                    }
+                    {
+                        ENV *const input_env(input_envs.getUnchecked(2));
+                        filter_data->input_smoothers[2]->process_amp(!filter_data->input_holds[2],
+                                                                     glide_modotr_time, input_env,
+                                                                     tmp_input_amp_3, num_samples);
                     }
-                }
-            }
-
-            // PROCESS MODULATOR
-            float modulator_sample = 0;
-            {
-                // MODULATOR SYNC AND PROCESSING
-                if (!modulator_waits_for_sync_cycle)
-                {
-                    modulator_sample = modulator.tick();
-                }
-
-                const bool is_last_sample_of_modulator_cycle = modulator.is_next_a_new_cycle();
-
-                // STOP THE MODULATOR IF IN SYNC // IGNORED IF SHOT IS ENABLED
-                if (modulator_run_circle > modulator_sync_cylces && fm_sync)
-                {
-                    modulator_waits_for_sync_cycle = !is_last_sample_of_cycle;
-                    modulator_run_circle = 0;
-                }
-                else if (is_last_sample_of_cycle)
-                {
-                    modulator_waits_for_sync_cycle = false;
-                    modulator_run_circle = 0;
-                }
 
-                // COUNT CYCLES AND CLEAR STATE IF NOT WAITING FOR SYNC
-                if (is_last_sample_of_modulator_cycle && !modulator_waits_for_sync_cycle)
-                {
-                    ++modulator_run_circle;
-                }
+                    // FILTER 3 ONLY USES ITS FIRST INPUT, THE OTHER TWO HOLD THE SINGLE INPUTS
+                    float *const filter_input_buffer =
+                        data_buffer->filter_input_samples.getWritePointer(
+                            0 + SUM_INPUTS_PER_FILTER * FILTER_3);
+                    float *const filter_input_buffer_2 =
+                        data_buffer->filter_input_samples.getWritePointer(
+                            1 + SUM_INPUTS_PER_FILTER * FILTER_3);
+                    float *const filter_input_buffer_3 =
+                        data_buffer->filter_input_samples.getWritePointer(
+                            2 + SUM_INPUTS_PER_FILTER * FILTER_3);
+                    const float *const filter_before_buffer_1 =
+                        data_buffer->filter_output_samples.getReadPointer(
+                            0 + SUM_INPUTS_PER_FILTER * FILTER_2);
+                    const float *const filter_before_buffer_2 =
+                        data_buffer->filter_output_samples.getReadPointer(
+                            1 + SUM_INPUTS_PER_FILTER * FILTER_2);
+                    const float *const filter_before_buffer_3 =
+                        data_buffer->filter_output_samples.getReadPointer(
+                            2 + SUM_INPUTS_PER_FILTER * FILTER_2);
+                    const float *const osc_input_buffer_1 =
+                        data_buffer->osc_samples.getReadPointer(0);
+                    const float *const osc_input_buffer_2 =
+                        data_buffer->osc_samples.getReadPointer(1);
+                    const float *const osc_input_buffer_3 =
+                        data_buffer->osc_samples.getReadPointer(2);
 
-                // UPDATE SWING
-                if (is_last_sample_of_modulator_cycle)
-                {
-                    modulator.set_swing_frequency(smoothed_fm_swing_buffer[sid] * 5);
+                    for (int sid = 0; sid != num_samples; ++sid)
+                    {
+                        filter_input_buffer[sid] =
+                            tmp_input_amp_1[sid] < 0
+                                ? osc_input_buffer_1[sid] * tmp_input_amp_1[sid] * -1
+                                : filter_before_buffer_1[sid] * tmp_input_amp_1[sid];
+                        filter_input_buffer_2[sid] =
+                            tmp_input_amp_2[sid] < 0
+                                ? osc_input_buffer_2[sid] * tmp_input_amp_2[sid] * -1
+                                : filter_before_buffer_2[sid] * tmp_input_amp_2[sid];
+                        filter_input_buffer_3[sid] =
+                            tmp_input_amp_3[sid] < 0
+                                ? osc_input_buffer_3[sid] * tmp_input_amp_3[sid] * -1
+                                : filter_before_buffer_3[sid] * tmp_input_amp_3[sid];
+                    }
+                    const float *const inputs[SUM_INPUTS_PER_FILTER] = {
+                        filter_input_buffer, filter_input_buffer_2, filter_input_buffer_3};
+                    sample_mix_block(filter_input_buffer, inputs, SUM_INPUTS_PER_FILTER,
+                                     num_samples);
                 }
             }
+        }
+    }
+    inline void process_amp_mix(const int num_samples) noexcept
+    {
+        // ADSTR - LFO MIX
+        float *amp_mix = data_buffer->lfo_amplitudes.getWritePointer(id);
+        const float *smoothed_mix_buffer(
+            filter_data->adsr_lfo_mix_smoother.get_smoothed_value_buffer());
+        {
+            const float *env_amps = data_buffer->filter_env_amps.getReadPointer(id);
+            const float *lfo_amplitudes = data_buffer->lfo_amplitudes.getReadPointer(id);
+            for (int sid = 0; sid != num_samples; ++sid)
+            {
+                // LFO ADSR MIX - HERE TO SAVE ONE LOOP
+                const float mix = (1.0f + smoothed_mix_buffer[sid]) * 0.5f;
+                amp_mix[sid] = env_amps[sid] * (1.0f - mix) + lfo_amplitudes[sid] * mix;
+            }
+        }
+    }
 
-            // ADD FM TO THE OUTPUT
+#if JUCE_USE_SIMD
+    //==========================================================================
+    // THE THREE INPUTS OF FILTER 1 OR 2 IN SIMD LANES WITH ONE COEFFICIENT CALCULATION FOR ALL.
+    // FALSE WHILE THE FILTERS FADE FROM ANOTHER TYPE, THE EXECUTERS DO THAT
+    inline bool process_inputs_in_lanes(FILTER_TYPS type_) noexcept
+    {
+        for (int input_id = 0; input_id != SUM_INPUTS_PER_FILTER; ++input_id)
+        {
+            if (double_filter.getUnchecked(input_id)->is_changing_type(type_))
             {
-                if (const float fm_amount = smoothed_fm_amount_buffer[sid])
-                {
-                    const float phase_move =
-                        smoothed_fm_phaser[sid]; // * jmin(1.0f,smoothed_fm_swing_buffer[sid]*80);
-                    sample = (1.0f - fm_amount) * sample +
-                             fm_amount * ((1.0f - phase_move) * sample * modulator_sample +
-                                          phase_move * (modulator_sample * modulator_sample *
-                                                        modulator_sample * sample));
-                }
+                return false;
+            }
+        }
 
-                if (--sync_glide_samples_left > 0)
-                {
-                    const float power = 1.0f / sync_glide_samples * sync_glide_samples_left;
-                    sample = sample * (1.0f - power) + sync_value * power;
-                    modulator_sample =
-                        modulator_sample * (1.0f - power) + sync_modulator_value * power;
-                }
+        const int atan_accuracy = synth_data->atan_accuracy;
+        const int num_samples = stage.num_samples;
+        const float *const distortion = stage.distortion;
+        float *const *const inputs = stage.inputs;
+        float *const *const outputs = stage.outputs;
+        if (stage.skip[0] && stage.skip[1] && stage.skip[2])
+        {
+            for (int input_id = 0; input_id != SUM_INPUTS_PER_FILTER; ++input_id)
+            {
+                juce::FloatVectorOperations::clear(outputs[input_id], num_samples);
+            }
+            return true;
+        }
+        for (int input_id = 0; input_id != SUM_INPUTS_PER_FILTER; ++input_id)
+        {
+            filter_distortion_block(inputs[input_id], distortion, inputs[input_id], num_samples,
+                                    atan_accuracy);
+        }
 
-                output_buffer[sid] = sample;
-                modulator_buffer[sid] = modulator_sample;
+        {
+            const float *const resonance = stage.resonance;
+            const float *const cutoff = stage.cutoff;
+            const int coefficient_rate = stage.coefficient_rate;
+            lanes.load(double_filter.getRawDataPointer(), SUM_INPUTS_PER_FILTER);
+            switch (atan_accuracy)
+            {
+            case ATAN_EXACT:
+                lanes.process<ATAN_EXACT>(type_, resonance, cutoff, coefficient_rate, inputs,
+                                          outputs, num_samples);
+                break;
+            case ATAN_FAST:
+                lanes.process<ATAN_FAST>(type_, resonance, cutoff, coefficient_rate, inputs,
+                                         outputs, num_samples);
+                break;
+            default:
+                lanes.process<ATAN_PRECISE>(type_, resonance, cutoff, coefficient_rate, inputs,
+                                            outputs, num_samples);
             }
+            lanes.store();
         }
 
-        last_value = output_buffer[num_samples_ - 1];
-        last_modulator_value = modulator_buffer[num_samples_ - 1];
+        for (int input_id = 0; input_id != SUM_INPUTS_PER_FILTER; ++input_id)
+        {
+            filter_distortion_block(outputs[input_id], distortion, outputs[input_id], num_samples,
+                                    atan_accuracy);
+        }
+        return true;
     }
+#endif
 
-    //==============================================================================
-    inline void update(float root_note_, int sample_pos_) noexcept
+    //==========================================================================
+    // STRETCHES A PARAMETER BUFFER TO THE OVERSAMPLED RATE, LINEAR FROM THE LAST VALUE
+    inline const float *oversample_parameter(const float *const values_, const float last_value_,
+                                             const int buffer_id_, const int factor_,
+                                             const int num_samples_) noexcept
     {
-        root_note_ += synth_data->octave_offset * 12;
-        const float glide = synth_data->glide_smoother.get_smoothed_value_buffer()[sample_pos_];
-        if (glide != 0 && (root_note != root_note_ || freq_glide_samples_left > 0))
+        float *const oversampled = data_buffer->filter_oversampling.getWritePointer(buffer_id_);
+        float from = last_value_;
+        for (int sid = 0; sid != num_samples_; ++sid)
         {
-            root_note_ = juce::jmax(1.0f, juce::jmin(127.0f, root_note_));
+            ramp_to(oversampled + sid * factor_, from, values_[sid], factor_);
+            from = values_[sid];
+        }
+        return oversampled;
+    }
+    // PREPARES THE INPUTS AND POINTS THE STAGE TO THE BUFFERS THE FILTERS RUN ON, OVERSAMPLED
+    // IF ENABLED
+    inline void begin_stage(const int num_samples) noexcept
+    {
+        const int num_inputs = id != FILTER_3 ? SUM_INPUTS_PER_FILTER : 1;
+        for (int input_id = 0; input_id != num_inputs; ++input_id)
+        {
+            pre_process(input_id, num_samples);
+            stage.inputs[input_id] = data_buffer->filter_input_samples.getWritePointer(
+                input_id + SUM_INPUTS_PER_FILTER * id);
+            stage.outputs[input_id] = data_buffer->filter_output_samples.getWritePointer(
+                input_id + SUM_INPUTS_PER_FILTER * id);
+            stage.input_is_silent[input_id] = is_silent_block(stage.inputs[input_id], num_samples);
+            stage.skip[input_id] = input_tails[input_id].can_skip(stage.input_is_silent[input_id]);
+        }
+        stage.num_samples = num_samples;
+        stage.coefficient_rate = get_filter_coefficient_rate(synth_data);
+        stage.resonance = filter_data->resonance_smoother.get_smoothed_value_buffer();
+        stage.cutoff = filter_data->cutoff_smoother.get_smoothed_value_buffer();
+        stage.distortion = filter_data->distortion_smoother.get_smoothed_value_buffer();
 
-            const float rest_glide = freq_glide_delta * freq_glide_samples_left;
-            freq_glide_samples_left = juce::jmax(10.0f, float(sample_rate * 0.5) * glide);
-            const float glide_notes_diverence = root_note - root_note_;
-            if (freq_glide_samples_left > 0)
+        bool is_render = false;
+        const int factor = get_filter_oversampling(synth_data, is_render);
+        for (int input_id = 0; input_id != num_inputs; ++input_id)
+        {
+            double_filter.getUnchecked(input_id)->set_oversampling(factor);
+        }
+#if JUCE_USE_SIMD
+        oversampler.set_mode(factor, is_render);
+        if (factor > 1)
+        {
+            float *inputs[SUM_INPUTS_PER_FILTER];
+            float *outputs[SUM_INPUTS_PER_FILTER];
+            for (int input_id = 0; input_id != SUM_INPUTS_PER_FILTER; ++input_id)
             {
-                freq_glide_delta = (glide_notes_diverence + rest_glide) / freq_glide_samples_left;
+                inputs[input_id] =
+                    data_buffer->filter_oversampling.getWritePointer(OVERSAMPLED_INPUTS + input_id);
+                outputs[input_id] = data_buffer->filter_oversampling.getWritePointer(
+                    OVERSAMPLED_OUTPUTS + input_id);
             }
-            else
+            // THE OUTPUTS ARE FREE UNTIL THE FILTERS RUN
+            oversampler.upsample(stage.inputs, inputs, outputs, num_inputs, num_samples);
+            for (int input_id = 0; input_id != SUM_INPUTS_PER_FILTER; ++input_id)
             {
-                freq_glide_delta = 0;
+                stage.inputs[input_id] = inputs[input_id];
+                stage.outputs[input_id] = outputs[input_id];
             }
-        }
 
-        root_note = root_note_;
+            stage.resonance = oversample_parameter(stage.resonance, last_resonance,
+                                                   OVERSAMPLED_RESONANCE, factor, num_samples);
+            stage.cutoff = oversample_parameter(stage.cutoff, last_cutoff, OVERSAMPLED_CUTOFF,
+                                                factor, num_samples);
+            stage.distortion = oversample_parameter(stage.distortion, last_distortion,
+                                                    OVERSAMPLED_DISTORTION, factor, num_samples);
+            stage.num_samples *= factor;
+            stage.coefficient_rate *= factor;
+        }
+#endif
+        last_resonance =
+            filter_data->resonance_smoother.get_smoothed_value_buffer()[num_samples - 1];
+        last_cutoff = filter_data->cutoff_smoother.get_smoothed_value_buffer()[num_samples - 1];
+        last_distortion =
+            filter_data->distortion_smoother.get_smoothed_value_buffer()[num_samples - 1];
     }
-    inline void reset() noexcept
+    // PUTS SETTLED INPUTS TO SLEEP AND BRINGS THE OVERSAMPLED OUTPUTS BACK TO THE SAMPLE RATE
+    inline void end_stage(const int num_samples) noexcept
     {
-        cycle_counter.reset();
-        saw_generator.reset();
-        square_generator.reset();
-        modulator.reset();
-
-        freq_glide_delta = 0;
-        freq_glide_samples_left = 0;
-
-        sync_value = last_value;
-        sync_modulator_value = last_modulator_value;
-        sync_glide_samples = juce::jmax(10, msToSamplesFast(1, sample_rate));
-        sync_glide_samples_left = sync_glide_samples;
+        const int num_inputs = id != FILTER_3 ? SUM_INPUTS_PER_FILTER : 1;
+        for (int input_id = 0; input_id != num_inputs; ++input_id)
+        {
+            if (input_tails[input_id].settle(
+                    stage.input_is_silent[input_id],
+                    is_silent_block(stage.outputs[input_id], stage.num_samples), 0,
+                    stage.num_samples))
+            {
+                double_filter.getUnchecked(input_id)->clear_state();
+            }
+        }
+#if JUCE_USE_SIMD
+        if (oversampler.get_factor() > 1)
+        {
+            float *outputs[SUM_INPUTS_PER_FILTER];
+            float *tmp[SUM_INPUTS_PER_FILTER];
+            for (int input_id = 0; input_id != SUM_INPUTS_PER_FILTER; ++input_id)
+            {
+                outputs[input_id] = data_buffer->filter_output_samples.getWritePointer(
+                    input_id + SUM_INPUTS_PER_FILTER * id);
+                tmp[input_id] =
+                    data_buffer->filter_oversampling.getWritePointer(OVERSAMPLED_INPUTS + input_id);
+            }
+            oversampler.downsample(stage.outputs, outputs, tmp, num_inputs, num_samples);
+        }
+#else
+        juce::ignoreUnused(num_samples);
+#endif
     }
 
-    void sample_rate_or_block_changed() noexcept override {}
-
   public:
-    //==============================================================================
-    COLD MasterOSC(RuntimeNotifyer *const notifyer_, const MoniqueSynthData *synth_data_,
-                   const float *const sine_lookup_) noexcept
-        : RuntimeListener(notifyer_),
-
-          freq_glide_samples_left(0), freq_glide_delta(0),
-
-          sync_glide_samples(0), sync_glide_samples_left(0), last_value(0), last_modulator_value(0),
-          sync_value(0), sync_modulator_value(0),
-
-          root_note(60),
+    //==========================================================================
+    inline void process(const int num_samples) noexcept
+    {
+        float *amp_mix = data_buffer->lfo_amplitudes.getWritePointer(id);
+        // PROCESS FILTER
+        {
+            // PREPARE
+            {
+                process_amp_mix(num_samples);
 
-          last_root_note(0), last_frequency(0),
+                filter_data->resonance_smoother.process_modulation(filter_data->modulate_resonance,
+                                                                   amp_mix, num_samples);
+                filter_data->cutoff_smoother.process_modulation(filter_data->modulate_cutoff,
+                                                                amp_mix, num_samples);
+                filter_data->distortion_smoother.process_modulation(
+                    filter_data->modulate_distortion, amp_mix, num_samples);
+                if (synth_data->is_stereo)
+                    filter_data->pan_smoother.process_modulation(filter_data->modulate_pan, amp_mix,
+                                                                 num_samples);
+            }
 
-          last_modulator_frequency(0), modulator_sync_cylces(0), modulator_run_circle(0),
-          modulator_waits_for_sync_cycle(false),
+            begin_stage(num_samples);
+            switch (filter_data->filter_type)
+            {
+            case LPF:
+            case LPF_2_PASS:
+            case MOOG_AND_LPF:
+            {
+                // PROCESSOR
+                struct LP2PassExecuter
+                {
+                    DoubleAnalogFilter &filter;
+                    const int num_samples_;
+                    const bool skip;
 
-          cycle_counter(notifyer_), saw_generator(), square_generator(),
-          sine_generator(sine_lookup_), noise(),
+                    const float *const tmp_resonance_buffer;
+                    const float *const tmp_cuttof_buffer;
+                    const float *const tmp_distortion_buffer;
 
-          modulator(notifyer_, sine_lookup_),
+                    const int atan_accuracy;
+                    const int coefficient_rate;
 
-          data_buffer(synth_data_->data_buffer), synth_data(synth_data_),
-          fm_osc_data(synth_data_->fm_osc_data.get()), osc_data(synth_data_->osc_datas[MASTER_OSC])
-    {
-    }
-    COLD ~MasterOSC() noexcept {}
+                    float *const input_buffer;
+                    float *const out_buffer;
 
-    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(MasterOSC)
-};
+                    inline void exec() noexcept
+                    {
+                        if (skip && !filter.is_changing_type(LPF_2_PASS))
+                        {
+                            juce::FloatVectorOperations::clear(out_buffer, num_samples_);
+                            return;
+                        }
+                        filter_distortion_block(input_buffer, tmp_distortion_buffer, input_buffer,
+                                                num_samples_, atan_accuracy);
 
-//===================================================================================
-//===================================================================================
-//===================================================================================
-class SecondOSC : public RuntimeListener
-{
-    const int id;
+                        filter.update_filter_to(LPF_2_PASS);
+                        /*
+                                    filter.updateLow2Pass
+                                    (
+                                        tmp_resonance_buffer[sid],
+                                        ( (10180.0f * tmp_cuttof_buffer[sid]) +20 ),
+                                        tmp_gain_buffer[sid]
+                                    );
+                                    */
+                        // EVERY coefficient_rate SAMPLES GLIDE TO THE END OF THE NEXT SEGMENT
+                        for (int first_sid = 0; first_sid < num_samples_;
+                             first_sid += coefficient_rate)
+                        {
+                            const int end_sid =
+                                juce::jmin(first_sid + coefficient_rate, num_samples_);
+                            filter.glideLow2Pass(tmp_resonance_buffer[end_sid - 1],
+                                                 tmp_cuttof_buffer[end_sid - 1],
+                                                 end_sid - first_sid);
+                            for (int sid = first_sid; sid != end_sid; ++sid)
+                            {
+                                filter.step_coefficients();
+                                out_buffer[sid] = filter.processLow2Pass(input_buffer[sid]);
+                            }
+                        }
+                        filter_distortion_block(out_buffer, tmp_distortion_buffer, out_buffer,
+                                                num_samples_, atan_accuracy);
+                    }
+                    LP2PassExecuter(FilterProcessor *const processor_, int input_id_) noexcept
+                        : filter(*processor_->double_filter.getUnchecked(input_id_)),
+                          num_samples_(processor_->stage.num_samples),
+                          skip(processor_->stage.skip[input_id_]),
 
-    // RUNTIME
-    //==============================================================================
-    int freq_glide_samples_left;
-    float freq_glide_delta;
+                          tmp_resonance_buffer(processor_->stage.resonance),
+                          tmp_cuttof_buffer(processor_->stage.cutoff),
+                          tmp_distortion_buffer(processor_->stage.distortion),
 
-    float sync_glide_samples;
-    int sync_glide_samples_left;
-    float last_value;
-    float sync_value;
+                          atan_accuracy(processor_->synth_data->atan_accuracy),
+                          coefficient_rate(processor_->stage.coefficient_rate),
 
-    float root_note;
-    float last_root_note;
-    float last_tune;
-    float last_frequency;
-
-    bool wait_for_new_master_cycle;
-    float last_sync_was_to_tune;
+                          input_buffer(processor_->stage.inputs[input_id_]),
+                          out_buffer(processor_->stage.outputs[input_id_])
+                    {
+                    }
+                };
+                {
+                    if (id != FILTER_3)
+                    {
+#if JUCE_USE_SIMD
+                        if (process_inputs_in_lanes(LPF_2_PASS))
+                        {
+                            break;
+                        }
+#endif
+                        LP2PassExecuter(this, 0).exec();
+                        LP2PassExecuter(this, 1).exec();
+                        LP2PassExecuter(this, 2).exec();
+                    }
+                    else
+                    {
+                        // 1, 2 and 3
+                        LP2PassExecuter(this, 0).exec();
+                    }
+                }
+            }
+            break;
+            case HPF:
+            case HIGH_2_PASS:
+            {
+                // PROCESSOR
+                struct HP2PassExecuter
+                {
+                    DoubleAnalogFilter &filter;
+                    const int num_samples_;
+                    const bool skip;
 
-    // RAW OSCILATORS
-    //==============================================================================
-    PerfectCycleCounter cycle_counter;
-    mono_BlitSaw saw_generator;
-    mono_BlitSquare square_generator;
-    mono_SineWave sine_generator;
-    mono_Noise noise;
+                    const float *const tmp_resonance_buffer;
+                    const float *const tmp_cuttof_buffer;
+                    const float *const tmp_distortion_buffer;
 
-    // DATA SOURCE
-    //==============================================================================
-    DataBuffer *const data_buffer;
-    const MoniqueSynthData *const synth_data;
-    OSCData *const osc_data;
-    OSCData *const master_osc_data;
-    FMOscData *const fm_osc_data;
+                    const int atan_accuracy;
+                    const int coefficient_rate;
 
-  public:
-    //==============================================================================
-    static inline bool is_syncanble_by_tune(float tune_) noexcept
-    {
-        bool syncable = false;
-        if (tune_ == 0)
-        {
-            syncable = true;
-        }
-        else if (tune_ == 0 + 24)
-        {
-            syncable = true;
-        }
-        else if (tune_ == 0 - 24)
-        {
-            syncable = true;
-        }
+                    float *const input_buffer;
+                    float *const out_buffer;
 
-        return syncable;
-    }
+                    inline void exec() noexcept
+                    {
+                        if (skip && !filter.is_changing_type(HIGH_2_PASS))
+                        {
+                            juce::FloatVectorOperations::clear(out_buffer, num_samples_);
+                            return;
+                        }
+                        filter_distortion_block(input_buffer, tmp_distortion_buffer, input_buffer,
+                                                num_samples_, atan_accuracy);
 
-    //==============================================================================
-    inline void process(DataBuffer *data_buffer_, const int num_samples_) noexcept
-    {
-        float *const output_buffer(data_buffer->osc_samples.getWritePointer(id));
+                        filter.update_filter_to(HIGH_2_PASS);
+                        // EVERY coefficient_rate SAMPLES GLIDE TO THE END OF THE NEXT SEGMENT
+                        for (int first_sid = 0; first_sid < num_samples_;
+                             first_sid += coefficient_rate)
+                        {
+                            const int end_sid =
+                                juce::jmin(first_sid + coefficient_rate, num_samples_);
+                            filter.glideHigh2Pass(tmp_resonance_buffer[end_sid - 1],
+                                                  tmp_cuttof_buffer[end_sid - 1],
+                                                  end_sid - first_sid);
+                            for (int sid = first_sid; sid != end_sid; ++sid)
+                            {
+                                filter.step_coefficients();
+                                out_buffer[sid] = filter.processHigh2Pass(input_buffer[sid]);
+                            }
+                        }
+                        filter_distortion_block(out_buffer, tmp_distortion_buffer, out_buffer,
+                                                num_samples_, atan_accuracy);
+                    }
+                    HP2PassExecuter(FilterProcessor *const processor_, int input_id_) noexcept
+                        : filter(*processor_->double_filter.getUnchecked(input_id_)),
+                          num_samples_(processor_->stage.num_samples),
+                          skip(processor_->stage.skip[input_id_]),
 
-        const float *const switch_buffer(data_buffer->osc_switchs.getWritePointer());
-        const float *const modulator_buffer(
-            data_buffer->modulator_samples.getWritePointer(MASTER_OSC));
-        const float *const lfo_amps((data_buffer->lfo_amplitudes.getReadPointer(id)));
+                          tmp_resonance_buffer(processor_->stage.resonance),
+                          tmp_cuttof_buffer(processor_->stage.cutoff),
+                          tmp_distortion_buffer(processor_->stage.distortion),
 
-        const bool is_lfo_modulated = osc_data->is_lfo_modulated;
+                          atan_accuracy(processor_->synth_data->atan_accuracy),
+                          coefficient_rate(processor_->stage.coefficient_rate),
 
-        const bool sync_to_master = osc_data->sync;
-        osc_data->tune_smoother.process_modulation(is_lfo_modulated, lfo_amps, num_samples_);
-        const float *const smoothed_tune_buffer(
-            osc_data->tune_smoother.get_smoothed_value_buffer());
-        const float *const smoothed_fm_amount_buffer(
-            osc_data->fm_amount_smoother.get_smoothed_value_buffer());
-        const float *const smoothed_wave_buffer(
-            osc_data->wave_smoother.get_smoothed_value_buffer());
-        // const float*const smoothed_fm_swing_buffer(
-        // fm_osc_data->fm_swing_smoother.get_smoothed_modulated_value_buffer() );
-        const float *const smoothed_fm_phaser(
-            fm_osc_data->fm_shape_smoother.get_smoothed_value_buffer());
-        for (int sid = 0; sid < num_samples_; ++sid)
-        {
-            // SETUP TUNE
-            const float tune = smoothed_tune_buffer[sid];
-            {
-                // FREQUENCY
-                if (freq_glide_samples_left > 0 || tune != last_tune || last_root_note != root_note)
-                {
-                    if (freq_glide_samples_left > 0)
+                          input_buffer(processor_->stage.inputs[input_id_]),
+                          out_buffer(processor_->stage.outputs[input_id_])
                     {
-                        --freq_glide_samples_left;
                     }
-
+                };
+                {
+                    if (id != FILTER_3)
                     {
-                        last_tune = tune;
-                        last_root_note = root_note;
-
-                        const float new_frequence =
-                            juce::jmax(5.0f, synth_data->tuning->midiNoteToFrequency(
-                                                 root_note + tune +
-                                                 freq_glide_delta * freq_glide_samples_left));
-                        if (new_frequence != last_frequency)
+#if JUCE_USE_SIMD
+                        if (process_inputs_in_lanes(HIGH_2_PASS))
                         {
-                            cycle_counter.set_frequency(new_frequence);
-                            square_generator.updateHarmonics(cycle_counter.get_cylces_per_sec());
-                            saw_generator.updateHarmonics(cycle_counter.get_cylces_per_sec());
+                            break;
                         }
+#endif
+                        HP2PassExecuter(this, 0).exec();
+                        HP2PassExecuter(this, 1).exec();
+                        HP2PassExecuter(this, 2).exec();
+                    }
+                    else
+                    {
+                        // 1, 2 and 3
+                        HP2PassExecuter(this, 0).exec();
                     }
                 }
             }
-
-            // PROCESS OSC AND SYNC IT TO THE MASTER
-            const bool is_last_sample_of_master_cycle = switch_buffer[sid];
-            float sample = 0;
+            break;
+            case BPF:
             {
-                // TICK ALL OSCILATTORS
-                if (!wait_for_new_master_cycle)
+                // PROCESSOR
+                struct BandExecuter
                 {
-                    cycle_counter.tick();
-                    saw_generator.tick(cycle_counter.get_last_phase());
-                    {
-                        double angle = cycle_counter.get_last_angle();
-                        square_generator.tick(angle);
-                        sine_generator.tick(angle);
-                    }
-                }
+                    DoubleAnalogFilter &filter;
+                    const int num_samples_;
+                    const bool skip;
 
-                // FORCE SYNC OF THE SINE AT THE NEXT SID
-                if (cycle_counter.is_new_cycle())
-                {
-                    const bool syncanble_by_tune = is_syncanble_by_tune(tune);
-                    if (!syncanble_by_tune)
-                    {
-                        last_sync_was_to_tune = -25;
-                    }
-                    if (sync_to_master)
+                    const float *const tmp_resonance_buffer;
+                    const float *const tmp_cuttof_buffer;
+                    const float *const tmp_distortion_buffer;
+
+                    const int atan_accuracy;
+                    const int coefficient_rate;
+
+                    float *const input_buffer;
+                    float *const out_buffer;
+
+                    inline void exec() noexcept
                     {
-                        if (!is_lfo_modulated && !syncanble_by_tune &&
-                            last_sync_was_to_tune != tune)
+                        if (skip && !filter.is_changing_type(BPF))
                         {
-                            wait_for_new_master_cycle = true;
+                            juce::FloatVectorOperations::clear(out_buffer, num_samples_);
+                            return;
                         }
-                    }
-                    else
-                    {
-                        if (!is_lfo_modulated && freq_glide_samples_left <= 0)
+                        filter_distortion_block(input_buffer, tmp_distortion_buffer, input_buffer,
+                                                num_samples_, atan_accuracy);
+
+                        filter.update_filter_to(BPF);
+
+                        // EVERY coefficient_rate SAMPLES GLIDE TO THE END OF THE NEXT SEGMENT
+                        for (int first_sid = 0; first_sid < num_samples_;
+                             first_sid += coefficient_rate)
                         {
-                            if (syncanble_by_tune && last_sync_was_to_tune != tune)
+                            const int end_sid =
+                                juce::jmin(first_sid + coefficient_rate, num_samples_);
+                            filter.glideBand(tmp_resonance_buffer[end_sid - 1],
+                                             tmp_cuttof_buffer[end_sid - 1], end_sid - first_sid);
+                            for (int sid = first_sid; sid != end_sid; ++sid)
                             {
-                                wait_for_new_master_cycle = true;
-                                last_sync_was_to_tune = tune;
+                                filter.step_coefficients();
+                                out_buffer[sid] = filter.processBand(input_buffer[sid]);
                             }
                         }
+                        filter_distortion_block(out_buffer, tmp_distortion_buffer, out_buffer,
+                                                num_samples_, atan_accuracy);
                     }
-                }
-                if (is_last_sample_of_master_cycle)
-                {
-                    wait_for_new_master_cycle = false;
-                }
+                    BandExecuter(FilterProcessor *const processor_, int input_id_) noexcept
+                        : filter(*processor_->double_filter.getUnchecked(input_id_)),
+                          num_samples_(processor_->stage.num_samples),
+                          skip(processor_->stage.skip[input_id_]),
 
-                // CALC THE SAMPLE MIX
-                if (!wait_for_new_master_cycle)
-                {
-                    const float wave_form = smoothed_wave_buffer[sid];
+                          tmp_resonance_buffer(processor_->stage.resonance),
+                          tmp_cuttof_buffer(processor_->stage.cutoff),
+                          tmp_distortion_buffer(processor_->stage.distortion),
 
-                    // SINE - SQUARE
-                    if (wave_form <= 1)
+                          atan_accuracy(processor_->synth_data->atan_accuracy),
+                          coefficient_rate(processor_->stage.coefficient_rate),
+
+                          input_buffer(processor_->stage.inputs[input_id_]),
+                          out_buffer(processor_->stage.outputs[input_id_])
                     {
-                        const float multi = wave_form;
-                        const float sine_wave_powerd = sine_generator.lastOut() * (1.0f - multi);
-                        const float square_wave_powerd = square_generator.lastOut() * multi;
-                        sample = sine_wave_powerd + square_wave_powerd;
                     }
-                    // SQUARE - SAW
-                    else if (wave_form <= 2)
+                };
+                {
+                    if (id != FILTER_3)
                     {
-                        const float multi = wave_form - 1;
-                        const float square_wave_powerd =
-                            square_generator.lastOut() * (1.0f - multi);
-                        const float saw_wave_powerd = saw_generator.lastOut() * multi;
-                        sample = square_wave_powerd + saw_wave_powerd;
+#if JUCE_USE_SIMD
+                        if (process_inputs_in_lanes(BPF))
+                        {
+                            break;
+                        }
+#endif
+                        BandExecuter(this, 0).exec();
+                        BandExecuter(this, 1).exec();
+                        BandExecuter(this, 2).exec();
                     }
-                    // SAW - RAND
-                    else /*if( wave_form <= 3 )*/
+                    else
                     {
-                        const float multi = wave_form - 2;
-                        const float saw_wave_powerd = saw_generator.lastOut() * (1.0f - multi);
-                        const float noice_powerd = noise.tick() * multi;
-                        sample = saw_wave_powerd + noice_powerd;
+                        // 1, 2 and 3
+                        BandExecuter(this, 0).exec();
                     }
                 }
             }
-
-            // ADD FM TO THE OUTPUT
+            break;
+            default: //  PASS
             {
-                if (const float fm_amount = smoothed_fm_amount_buffer[sid])
-                {
-                    float modulator_sample = modulator_buffer[sid];
-                    const float phase_move =
-                        smoothed_fm_phaser[sid]; // * jmin(1.0f,smoothed_fm_swing_buffer[sid]*80);
-                    sample = (1.0f - fm_amount) * sample +
-                             fm_amount * ((1.0f - phase_move) * sample * modulator_sample +
-                                          phase_move * (modulator_sample * modulator_sample *
-                                                        modulator_sample * sample));
-                }
-
-                if (--sync_glide_samples_left > 0)
+                // PROCESSOR
+                struct PassExecuter
                 {
-                    const float power = 1.0f / sync_glide_samples * sync_glide_samples_left;
-                    sample = sample * (1.0f - power) + sync_value * power;
-                }
-
-                output_buffer[sid] = sample;
-            }
-        }
-
-        last_value = output_buffer[num_samples_ - 1];
-    }
-
-    //==============================================================================
-    inline void update(float root_note_, int sample_pos_) noexcept
-    {
-        root_note_ += synth_data->octave_offset * 12;
-        const float glide = synth_data->glide_smoother.get_smoothed_value_buffer()[sample_pos_];
-        if (glide != 0 && (root_note != root_note_ || freq_glide_samples_left > 0))
-        {
-            root_note_ = juce::jmax(1.0f, juce::jmin(127.0f, root_note_));
+                    DoubleAnalogFilter &filter;
+                    const int num_samples_;
+                    const bool skip;
 
-            const float rest_glide = freq_glide_delta * freq_glide_samples_left;
-            freq_glide_samples_left = (sample_rate * 0.5) * glide;
-            const float glide_notes_diverence = root_note - root_note_;
-            if (freq_glide_samples_left > 0)
-            {
-                freq_glide_delta = (glide_notes_diverence + rest_glide) / freq_glide_samples_left;
-            }
-            else
-            {
-                freq_glide_delta = 0;
-            }
-        }
+                    const float *const tmp_distortion_buffer;
 
-        root_note = root_note_;
-    }
-    inline void reset() noexcept
-    {
-        cycle_counter.reset();
-        saw_generator.reset();
-        square_generator.reset();
+                    const int atan_accuracy;
 
-        freq_glide_delta = 0;
-        freq_glide_samples_left = 0;
+                    float *const input_buffer;
+                    float *const out_buffer;
 
-        wait_for_new_master_cycle = false;
+                    inline void exec() noexcept
+                    {
+                        if (skip && !filter.is_changing_type(PASS))
+                        {
+                            juce::FloatVectorOperations::clear(out_buffer, num_samples_);
+                            return;
+                        }
+                        filter_distortion_block(input_buffer, tmp_distortion_buffer, input_buffer,
+                                                num_samples_, atan_accuracy);
 
-        sync_value = last_value;
-        sync_glide_samples = juce::jmax(10, msToSamplesFast(1, sample_rate));
-        sync_glide_samples_left = sync_glide_samples;
-    }
-    void sample_rate_or_block_changed() noexcept override {}
-
-  public:
-    //==============================================================================
-    COLD SecondOSC(RuntimeNotifyer *const notifyer_, const MoniqueSynthData *synth_data_, int id_,
-                   const float *const sine_lookup_) noexcept
-        : RuntimeListener(notifyer_),
-
-          id(id_),
-
-          freq_glide_samples_left(0), freq_glide_delta(0),
-
-          sync_glide_samples(0), sync_glide_samples_left(0), last_value(0), sync_value(0),
-
-          root_note(60), last_root_note(0), last_tune(-25), last_frequency(0),
-
-          wait_for_new_master_cycle(false), last_sync_was_to_tune(-25),
-
-          cycle_counter(notifyer_), saw_generator(), square_generator(),
-          sine_generator(sine_lookup_), noise(),
-
-          data_buffer(synth_data_->data_buffer), synth_data(synth_data_),
-          osc_data(synth_data_->osc_datas[id_]),
-          master_osc_data(synth_data_->osc_datas[MASTER_OSC]),
-          fm_osc_data(synth_data_->fm_osc_data.get())
-    {
-    }
-    COLD ~SecondOSC() noexcept {}
-
-    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(SecondOSC)
-};
-
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-class mono_ENVOsccilator : public RuntimeListener
-{
-    const float *const sine_lookup;
-    const float *const cos_lookup;
-    const float *const exp_lookup;
-
-    float start_amp;
-    float out_amp;
-    float target_amp;
-    enum TYPE
-    {
-        ATTACK,
-        RELEASE,
-        KEEP
-    };
-    TYPE type;
-
-    float delta;
-    float angle;
-    float sine_angle_start;
-
-    float shape;
-    float time_in_samples;
-    int sample_counter;
-    bool is_unlimited;
-
-  public:
-    //==========================================================================
-    // SHAPE 0 - sine-, 1 - linear, 2 - sine+
-    inline void set_process_values(float start_value_, float end_value_, float shape_,
-                                   float time_in_samples_) noexcept
-    {
-        start_amp = start_value_;
-        target_amp = end_value_;
-        shape = ((shape_ + 1) * 0.5f) * 0.9f + 0.1;
-        time_in_samples = time_in_samples_;
-    }
-    inline void calculate_attack_coeffecients() noexcept
-    {
-        sample_counter = time_in_samples;
-        angle = 0;
-        sine_angle_start = juce::MathConstants<float>::pi * 1.5f;
-        type = TYPE::ATTACK;
-        is_unlimited = false;
-        delta = juce::MathConstants<float>::pi / sample_counter;
-    }
-    inline void calculate_release_coeffecients() noexcept
-    {
-        sample_counter = time_in_samples;
-        angle = 0;
-        sine_angle_start = juce::MathConstants<float>::pi * 1.5f;
-        type = TYPE::RELEASE;
-        is_unlimited = false;
-        delta = juce::MathConstants<float>::pi / sample_counter;
-    }
-    inline void calculate_keep_coeffecients() noexcept
-    {
-        sample_counter = time_in_samples;
-        delta = 0;
-        angle = 0;
-        type = TYPE::KEEP;
-        is_unlimited = false;
-    }
-    inline void calculate_unlimited_coeffecients() noexcept
-    {
-        sample_counter = 0;
-        delta = 0;
-        angle = 0;
-        type = TYPE::KEEP;
-        is_unlimited = true;
-    }
-    inline void only_calculate_new_target(float target_) noexcept
-    {
-        // start_amp = out_amp;
-        target_amp = target_;
-        // sample_counter = time_in_samples;
-        // delta = (juce::MathConstants<float>::pi) / sample_counter;
-        // angle = 0;
-    }
-
-    //==========================================================================
-    void sample_rate_or_block_changed() noexcept override
-    {
-        // AUTO RESET ON NEXT CYCLE
-    }
-
-  public:
-    //==========================================================================
-    inline float tick() noexcept
-    {
-        if (--sample_counter > 0)
-        {
-            if (delta != 0)
-            {
-                angle += delta;
-                /*shape*(angle-cos_for_angle)*/
-                const float angle_drift =
-                    lookup(exp_lookup, angle) * angle * shape +
-                    (angle + lookup(cos_lookup, angle + sine_angle_start)) * (1.0f - shape);
-                if (type == TYPE::ATTACK)
-                {
-                    out_amp = start_amp +
-                              ((lookup(sine_lookup, angle_drift + sine_angle_start) + 1) * 0.5f) *
-                                  (target_amp - start_amp);
-                }
-                else if (type == TYPE::RELEASE)
-                {
-                    out_amp = start_amp -
-                              ((lookup(sine_lookup, angle_drift + sine_angle_start) + 1) * 0.5f) *
-                                  (start_amp - target_amp);
-                }
-            }
-        }
-        else
-        {
-            out_amp = target_amp;
-        }
-
-        return out_amp;
-    }
-
-  public:
-    //==========================================================================
-    inline float last_out() const noexcept { return out_amp; }
-    inline void overwrite_current_value(float amp_) noexcept { out_amp = amp_; }
-
-    //==========================================================================
-    inline bool is_finished() const noexcept { return is_endless() && sample_counter <= 0; }
-    inline bool is_endless() const noexcept { return !is_unlimited; }
-
-    //==========================================================================
-    inline void reset() noexcept
-    {
-        sample_counter = 0;
-        start_amp = 0;
-        out_amp = 0;
-        type = KEEP;
-        target_amp = 0;
-        delta = 0;
-        angle = 0;
-        time_in_samples = 0;
-        sample_counter = 0;
-        is_unlimited = false;
-    }
-
-  public:
-    //==========================================================================
-    COLD mono_ENVOsccilator(RuntimeNotifyer *const notifyer_, const float *const sine_lookup_,
-                            const float *const cos_lookup_, const float *const exp_lookup_) noexcept
-
-        : RuntimeListener(notifyer_), sine_lookup(sine_lookup_), cos_lookup(cos_lookup_),
-          exp_lookup(exp_lookup_),
-
-          start_amp(0), out_amp(0), target_amp(0), type(KEEP),
-
-          delta(0), angle(0), sine_angle_start(0),
-
-          shape(0),
-
-          time_in_samples(0), sample_counter(0), is_unlimited(false)
-    {
-    }
-    COLD ~mono_ENVOsccilator() noexcept {}
-
-    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(mono_ENVOsccilator)
-};
-
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-enum STAGES
-{
-    END_ENV = false,
-    ATTACK = true,
-    DECAY,
-    SUSTAIN,
-    RELEASE,
-    TRIGGER_START
-};
-class ENV : RuntimeListener
-{
-    mono_ENVOsccilator env_osc;
-
-    STAGES current_stage;
-
-    const MoniqueSynthData *const synth_data;
-    float last_sustain;
-    bool goes_to_sustain;
-    bool is_sustain;
-
-  public:
-    ENVData *const env_data;
-
-  public:
-    //==========================================================================
-    inline void process(float *dest_, const int num_samples_) noexcept
-    {
-        const float *smoothed_sustain_buffer =
-            env_data->sustain_smoother.get_smoothed_value_buffer();
-        for (int sid = 0; sid < num_samples_; ++sid)
-        {
-            const float sustain = smoothed_sustain_buffer[sid];
-            if (last_sustain != sustain)
-            {
-                last_sustain = sustain;
-                if (goes_to_sustain)
-                {
-                    env_osc.only_calculate_new_target(last_sustain);
-                }
-                else if (is_sustain)
-                {
-                    env_osc.overwrite_current_value(last_sustain);
-                }
-            }
-            dest_[sid] = env_osc.tick();
-
-            if (env_osc.is_finished())
-            {
-                update_stage(sid);
-            }
-        }
-    }
-
-  private:
-    inline void update_stage(int sid_, bool force_relese_ = false) noexcept
-    {
-        const float *smoothed_sustain_buffer =
-            env_data->sustain_smoother.get_smoothed_value_buffer();
-        const float *smoothed_shape_buffer = env_data->shape_smoother.get_smoothed_value_buffer();
-        switch (current_stage)
-        {
-        case TRIGGER_START: // --> ATTACK
-        {
-            if (env_data->decay > 0)
-            {
-                env_osc.set_process_values(env_osc.last_out(), 1, smoothed_shape_buffer[sid_],
-                                           get_env_samples(env_data->attack, sample_rate));
-                goes_to_sustain = false;
-                is_sustain = false;
-            }
-            else
-            {
-                env_osc.set_process_values(env_osc.last_out(), smoothed_sustain_buffer[sid_],
-                                           smoothed_shape_buffer[sid_],
-                                           get_env_samples(env_data->attack, sample_rate));
-                goes_to_sustain = true;
-                is_sustain = false;
-            }
-
-            env_osc.calculate_attack_coeffecients();
-            current_stage = ATTACK;
-
-            break;
-        }
-        case ATTACK: // --> DECAY
-        {
-            const float decay = env_data->decay;
-            if (decay > 0)
-            {
-                env_osc.set_process_values(env_osc.last_out(), smoothed_sustain_buffer[sid_],
-                                           smoothed_shape_buffer[sid_],
-                                           get_env_samples(decay, sample_rate));
-                goes_to_sustain = true;
-                is_sustain = false;
-                env_osc.calculate_release_coeffecients();
-
-                current_stage = DECAY;
-
-                break;
-            }
-            // ELSE FALL TO DECAY AND START SUSTAIN LEVEL
-            [[fallthrough]];
-        }
-        case DECAY: // --> SUSTAIN
-        {
-            const float sustain_time = env_data->sustain_time;
-            const float sustain_level = smoothed_sustain_buffer[sid_];
-            if (sustain_time >= 1)
-            {
-                env_osc.set_process_values(env_osc.last_out(), sustain_level,
-                                           smoothed_shape_buffer[sid_],
-                                           get_env_samples(sustain_time, sample_rate));
-                env_osc.calculate_unlimited_coeffecients();
-                is_sustain = true;
-                goes_to_sustain = false;
-            }
-            else
-            {
-                env_osc.set_process_values(
-                    env_osc.last_out(), sustain_level, smoothed_shape_buffer[sid_],
-                    juce::jmax(20.0f, get_env_samples(sustain_time, sample_rate)));
-                env_osc.calculate_release_coeffecients();
-                is_sustain = true;
-                goes_to_sustain = false;
-            }
-            current_stage = SUSTAIN;
-
-            break;
-        }
-        case SUSTAIN: // --> RELEASE or RETRIGGER
-        {
-            const float sustain_time = env_data->sustain_time;
-            if (force_relese_)
-            {
-                env_osc.set_process_values(env_osc.last_out(), 0, smoothed_shape_buffer[sid_],
-                                           get_env_samples(env_data->release, sample_rate));
-                goes_to_sustain = false;
-                is_sustain = false;
-                env_osc.calculate_release_coeffecients();
-
-                current_stage = RELEASE;
-            }
-            // RETRIGGER
-            else
-            {
-                start_attack();
-            }
-
-            break;
-        }
-        case RELEASE: // --> RELEASE
-        {
-            goes_to_sustain = false;
-            is_sustain = false;
-            current_stage = END_ENV;
-
-            break;
-        }
-        default:
-        {
-            goes_to_sustain = false;
-            is_sustain = false;
-            current_stage = END_ENV;
-        }
-        }
-    }
-
-  public:
-    //==========================================================================
-    inline void start_attack() noexcept
-    {
-        current_stage = TRIGGER_START;
-        update_stage(0);
-    }
-    inline void set_to_release() noexcept
-    {
-        current_stage = SUSTAIN;
-        update_stage(0, true);
-    }
-    inline void reset() noexcept
-    {
-        current_stage = END_ENV;
-
-        last_sustain = 0;
-        goes_to_sustain = false;
-        is_sustain = false;
-        env_osc.reset();
-    }
-
-    //==============================================================================
-    inline STAGES get_current_stage() const noexcept { return current_stage; }
-    inline void set_current_stage(STAGES current_stage_) noexcept
-    {
-        current_stage = current_stage_;
-    }
-    inline void overwrite_current_value(float amp_) noexcept
-    {
-        env_osc.overwrite_current_value(amp_);
-        last_sustain = amp_;
-    }
-    inline bool is_endless() noexcept { return env_osc.is_endless(); }
-
-    //==============================================================================
-    inline float get_amp() const noexcept { return env_osc.last_out(); }
-
-    //==============================================================================
-    void sample_rate_or_block_changed() noexcept override {}
-
-  public:
-    //==============================================================================
-    inline ENV(RuntimeNotifyer *const notifyer_, const MoniqueSynthData *synth_data_,
-               ENVData *env_data_, const float *const sine_lookup_, const float *const cos_lookup_,
-               const float *const exp_lookup_) noexcept
-        : RuntimeListener(notifyer_), env_osc(notifyer_, sine_lookup_, cos_lookup_, exp_lookup_),
-
-          current_stage(END_ENV),
-
-          synth_data(synth_data_),
-
-          last_sustain(0), goes_to_sustain(false), is_sustain(false),
-
-          env_data(env_data_)
-    {
-    }
-    inline ~ENV() noexcept {}
-
-    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ENV)
-};
-
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-template <int smooth_samples> class AmpSmoother
-{
-    float current_value;
-    float target_value;
-    float delta;
-    int counter;
-
-  private:
-    inline void glide_tick() noexcept;
-
-  public:
-    inline float add_get(float in_) noexcept;
-    bool is_up_to_date() const noexcept;
-    inline float add_get_and_keep_current_time(float in_) noexcept;
-    inline void reset(float value_ = 0) noexcept;
-    inline float get_current_value() const noexcept;
-
-    COLD AmpSmoother(float start_value_ = 0) noexcept;
-    COLD ~AmpSmoother() noexcept;
-
-    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(AmpSmoother)
-};
-
-//==============================================================================
-template <int smooth_samples>
-COLD AmpSmoother<smooth_samples>::AmpSmoother(float start_value_) noexcept
-    : current_value(0), target_value(start_value_), delta(0), counter(0)
-{
-}
-template <int smooth_samples> COLD AmpSmoother<smooth_samples>::~AmpSmoother() noexcept {}
-
-//==============================================================================
-template <int smooth_samples> inline float AmpSmoother<smooth_samples>::add_get(float in_) noexcept
-{
-    if (current_value != in_ || target_value != in_)
-    {
-        // ONLY UPDATE IF WE HAVE A NEW VALUE
-        if (target_value != in_)
-        {
-            counter = smooth_samples;
-            delta = (in_ - current_value) / smooth_samples;
-            target_value = in_;
-        }
-
-        glide_tick();
-    }
-
-    return current_value;
-}
-template <int smooth_samples> bool AmpSmoother<smooth_samples>::is_up_to_date() const noexcept
-{
-    return target_value == current_value;
-}
-template <int smooth_samples> inline void AmpSmoother<smooth_samples>::reset(float value_) noexcept
-{
-    current_value = value_;
-    delta = 0;
-    counter = 0;
-}
-template <int smooth_samples>
-inline float AmpSmoother<smooth_samples>::add_get_and_keep_current_time(float in_) noexcept
-{
-    if (current_value != in_ || target_value != in_)
-    {
-        // ONLY UPDATE IF WE HAVE A NEW VALUE
-        if (target_value != in_)
-        {
-            delta = (in_ - current_value) / counter;
-            target_value = in_;
-        }
-
-        glide_tick();
-    }
-
-    return current_value;
-}
-template <int smooth_samples> inline void AmpSmoother<smooth_samples>::glide_tick() noexcept
-{
-    if (--counter <= 0)
-        current_value = target_value;
-    else
-    {
-        current_value += delta;
-        if (current_value > 1 || current_value < 0)
-        {
-            current_value = target_value;
-            counter = 0;
-        }
-    }
-}
-template <int smooth_samples>
-inline float AmpSmoother<smooth_samples>::get_current_value() const noexcept
-{
-    return current_value;
-}
-
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-class AnalogFilter : public RuntimeListener
-{
-    friend class DoubleAnalogFilter;
-    float p, k, r;
-    float y1, y2, y3, y4;
-    float oldx;
-    float oldy1, oldy2, oldy3;
-
-    float cutoff, res, res_original;
-
-    bool force_update;
-    int zero_counter;
-
-  public:
-    //==========================================================================
-    // RETURNS TRUE ON COFF CHANGED
-    inline bool update(float resonance_, float cutoff_) noexcept
-    {
-        bool success = false;
-        if (force_update || (cutoff != cutoff_ || res_original != resonance_))
-        {
-            cutoff = cutoff_;
-            res_original = resonance_;
-            res = juce::jmax(0.00001f, resonance_ *= 0.99999);
-            success = true;
-
-            force_update = false;
-        }
-        return success;
-    }
-    inline void update_with_fixed_cutoff(float resonance_, float cutoff_) noexcept
-    {
-        if (force_update || (cutoff != cutoff_ || res_original != resonance_))
-        {
-            cutoff = cutoff_;
-            res_original = resonance_;
-            res = resonance_;
-            calc_coefficients(cutoff);
-
-            force_update = false;
-        }
-    }
-    //==========================================================================
-    inline void copy_coefficient_from(const AnalogFilter &other_) noexcept
-    {
-        cutoff = other_.cutoff;
-        res = other_.res;
-
-        p = other_.p;
-        k = other_.k;
-        r = other_.r;
-    }
-    inline void copy_state_from(const AnalogFilter &other_) noexcept
-    {
-        oldx = other_.oldx;
-        oldy1 = other_.oldy1;
-        oldy2 = other_.oldy2;
-        oldy3 = other_.oldy3;
-        y1 = other_.y1;
-        y2 = other_.y2;
-        y3 = other_.y3;
-        y4 = other_.y4;
-    }
-#define MONO_UNDENORMALISE(n)                                                                      \
-    if (!(n < -1.0e-8f || n > 1.0e-8f))                                                            \
-        n = 0;
-    //==========================================================================
-    inline float processLow(float input_and_worker_) noexcept
-    {
-        MONO_UNDENORMALISE(input_and_worker_);
-        if (input_and_worker_ != 0)
-        {
-            zero_counter = 0;
-        }
-        else if (y4 == 0)
-        {
-            ++zero_counter;
-        }
-        else
-        {
-            zero_counter = 0;
-        }
-
-        if (zero_counter < 50)
-        {
-            input_and_worker_ -= r * y4;
-            MONO_UNDENORMALISE(input_and_worker_);
-
-            // Four cascaded onepole filters (bilinear transform)
-            y1 = input_and_worker_ * p + oldx * p - k * y1;
-            y2 = y1 * p + oldy1 * p - k * y2;
-            y3 = y2 * p + oldy2 * p - k * y3;
-            y4 = y3 * p + oldy3 * p - k * y4;
-
-            // Clipper band limited sigmoid
-            y4 -= (y4 * y4 * y4) / 6;
-            MONO_UNDENORMALISE(y4);
-
-            oldx = input_and_worker_;
-            oldy1 = y1;
-            oldy2 = y2;
-            oldy3 = y3;
-
-            input_and_worker_ = soft_clipp_greater_1_2(y4);
-            MONO_UNDENORMALISE(input_and_worker_);
-        }
-
-        return input_and_worker_;
-    }
-    inline float processLowResonance(float input_and_worker_) noexcept
-    {
-        MONO_UNDENORMALISE(input_and_worker_);
-        if (input_and_worker_ != 0)
-        {
-            zero_counter = 0;
-        }
-        else if (y4 == 0)
-        {
-            ++zero_counter;
-        }
-        else
-        {
-            zero_counter = 0;
-        }
-
-        if (zero_counter < 50)
-        {
-            // process input
-            input_and_worker_ -= r * y4;
-            MONO_UNDENORMALISE(y1);
-
-            // Four cascaded onepole filters (bilinear transform)
-            y1 = input_and_worker_ * p + oldx * p - k * y1;
-            y2 = y1 * p + oldy1 * p - k * y2;
-            y3 = y2 * p + oldy2 * p - k * y3;
-            y4 = y3 * p + oldy3 * p - k * y4;
-
-            // Clipper band limited sigmoid
-            y4 -= (y4 * y4 * y4) / 6;
-            MONO_UNDENORMALISE(y4);
-
-            oldx = input_and_worker_;
-            oldy1 = y1;
-            oldy2 = y2;
-            oldy3 = y3;
-
-            input_and_worker_ = soft_clipp_greater_1_2(sample_mix(y4, y3 * res));
-            MONO_UNDENORMALISE(input_and_worker_);
-        }
-
-        return input_and_worker_;
-    }
-    inline float processHighResonance(float input_and_worker_) noexcept
-    {
-        MONO_UNDENORMALISE(input_and_worker_);
-        if (input_and_worker_ != 0)
-        {
-            zero_counter = 0;
-        }
-        else if (y4 == 0)
-        {
-            ++zero_counter;
-        }
-        else
-        {
-            zero_counter = 0;
-        }
-
-        if (zero_counter < 50)
-        {
-            // process input
-            input_and_worker_ -= r * y4;
-            MONO_UNDENORMALISE(input_and_worker_);
-
-            // Four cascaded onepole filters (bilinear transform)
-            y1 = input_and_worker_ * p + oldx * p - k * y1;
-            y2 = y1 * p + oldy1 * p - k * y2;
-            y3 = y2 * p + oldy2 * p - k * y3;
-            y4 = y3 * p + oldy3 * p - k * y4;
-
-            // Clipper band limited sigmoid
-            y4 -= (y4 * y4 * y4) / 6;
-            MONO_UNDENORMALISE(y4);
-
-            oldx = input_and_worker_;
-            oldy1 = y1;
-            oldy2 = y2;
-            oldy3 = y3;
-
-            input_and_worker_ = hard_clipper_1(input_and_worker_ - y4);
-            MONO_UNDENORMALISE(input_and_worker_);
-        }
-
-        return input_and_worker_;
-    }
-
-    //==========================================================================
-    inline void reset() noexcept
-    {
-        y1 = y2 = y3 = y4 = oldx = oldy1 = oldy2 = oldy3 = 0;
-        zero_counter = 0;
-    }
-
-    //==========================================================================
-    inline void calc_coefficients(float cutoff_) noexcept
-    {
-        {
-            float f = cutoff_ / sample_rate;
-
-            // float agressive = 0.98f *( 1.0f - res );
-            // float agressive = 0.98f * jmax(0.0f,( 1.0f/8000.0f*cutoff ));
-            // p=f*((1.99f-agressive)-((0.99f-agressive)*f));
-            p = f * (1.8f - 0.8f * f);
-            k = p * 2 - 1;
-        }
-        {
-            // const float cutoff_power = 1.0f - (0.5f * jmin(1.0f,1.0f/(8000.0f*cutoff_)));
-            float t =
-                (1.0f - p) * 1.386249f; // + ( 0.2f * (1.0f-1.0f/(1000.0f*jmax(0.00001f,cutoff))) );
-            const float t2 = 12.0f + t * t;
-            r = res * (t2 + 6.0f * t) / (t2 - 6.0f * t); // * cutoff_power;
-        }
-    }
-
-  private:
-    //==========================================================================
-    COLD void sample_rate_or_block_changed() noexcept override
-    {
-        reset();
-        force_update = true;
-    }
-
-  public:
-    //==========================================================================
-    COLD AnalogFilter(RuntimeNotifyer *const notifyer_) noexcept
-        : RuntimeListener(notifyer_),
-
-          p(1), k(1), r(1), y1(0), y2(0), y3(0), y4(0), oldx(0), oldy1(0), oldy2(0), oldy3(0),
-
-          cutoff(1000), res(1), res_original(0.99999),
-
-          force_update(true), zero_counter(0)
-    {
-        sample_rate_or_block_changed();
-    }
-    COLD ~AnalogFilter() noexcept {}
-
-    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(AnalogFilter)
-};
-
-//==============================================================================
-//==============================================================================
-//==============================================================================
-#define FILTER_CHANGE_GLIDE_TIME_MS (msToSamplesFast(200, flt_1.sample_rate) + 50)
-class DoubleAnalogFilter
-{
-    AnalogFilter flt_1;
-    AnalogFilter flt_2;
-
-    DoubleAnalogFilter *smooth_filter;
-
-    FILTER_TYPS last_filter_type;
-    FILTER_TYPS smooth_filter_type;
-    int glide_time_4_filters;
-
-  public:
-    // LP
-    //==========================================================================
-    inline void updateLow2Pass(float resonance_, float cutoff_) noexcept
-    {
-        if (flt_2.update(resonance_, cutoff_))
-        {
-            flt_2.calc_coefficients(get_cutoff(cutoff_));
-            flt_1.copy_coefficient_from(flt_2);
-        }
-    }
-    inline float processLow2Pass(float in_) noexcept
-    {
-        const float out = flt_2.processLowResonance(in_);
-        const float low = flt_1.processLowResonance(out);
-
-        return process_filter_change(in_,
-                                     //(out+low)*(1.0f-gain) + resonance_clipping(out+low)*gain
-                                     sample_mix(out, low));
-    }
-
-    // 1 PASS HP
-    //==========================================================================
-    inline void updateHigh2Pass(float resonance_, float cutoff_) noexcept
-    {
-        if (flt_1.update(resonance_, cutoff_))
-        {
-            flt_1.calc_coefficients(get_cutoff(cutoff_));
-        }
-    }
-    inline float processHigh2Pass(float in_) noexcept
-    {
-        in_ = soft_clipp_greater_1_2(in_);
-        const float out = flt_1.processHighResonance(in_);
-        return process_filter_change(in_, out);
-    }
-
-    // BAND
-    //==========================================================================
-    inline void updateBand(float resonance_, float cutoff_) noexcept
-    {
-        float cutoff_2 = cutoff_ + cutoff_ * 0.02;
-        if (flt_1.update(resonance_, cutoff_2))
-        {
-            flt_1.calc_coefficients(get_cutoff(cutoff_));
-            flt_2.update(resonance_, cutoff_);
-            flt_2.calc_coefficients(get_cutoff(cutoff_));
-        }
-    }
-    inline float processBand(float in_) noexcept
-    {
-        return process_filter_change(
-            in_, flt_1.processLowResonance(flt_2.processHighResonance(in_)) * 2);
-    }
-
-    // PASS
-    //==========================================================================
-    inline float processPass(float in_) noexcept { return process_filter_change(in_, in_); }
-
-    // BY TYPE
-    //==========================================================================
-    inline void update_filter_to(FILTER_TYPS type_) noexcept
-    {
-        if (last_filter_type != type_)
-        {
-            if (smooth_filter)
-            {
-                // SET THE SECOND FILTER TO THE OLD COMPLETE STATE
-                if (last_filter_type != PASS)
-                {
-                    smooth_filter->flt_1.copy_coefficient_from(flt_1);
-                    smooth_filter->flt_1.copy_state_from(flt_1);
-                    flt_1.force_update = true;
-
-                    smooth_filter->flt_2.copy_coefficient_from(flt_2);
-                    smooth_filter->flt_2.copy_state_from(flt_2);
-                    flt_2.force_update = true;
-                }
-                else
-                {
-                    flt_1.reset();
-                    flt_2.reset();
-                }
-                flt_1.force_update = true;
-                flt_2.force_update = true;
-
-                glide_time_4_filters = FILTER_CHANGE_GLIDE_TIME_MS;
-
-                smooth_filter->last_filter_type = last_filter_type;
-                smooth_filter_type = last_filter_type;
-            }
-
-            last_filter_type = type_;
-        }
-    }
-    inline float process_filter_change(float original_in_, float result_in_) noexcept
-    {
-        if (glide_time_4_filters > 0)
-        {
-            // if( smooth_filter ) IS TRUE IF glide_time_4_filters != 0
-            {
-                const float smooth_out =
-                    smooth_filter->processByType(original_in_, smooth_filter_type);
-
-                float mix = 1.0f / float(FILTER_CHANGE_GLIDE_TIME_MS) * glide_time_4_filters;
-                result_in_ = result_in_ * (1.0f - mix) + smooth_out * mix;
-            }
-            --glide_time_4_filters;
-        }
-
-        return result_in_;
-    }
-    inline float processByType(float io_, FILTER_TYPS type_) noexcept
-    {
-        switch (type_)
-        {
-        case LPF:
-        case LPF_2_PASS:
-            io_ = processLow2Pass(io_);
-            break;
-        case HPF:
-        case HIGH_2_PASS:
-            io_ = processHigh2Pass(io_);
-            break;
-        case BPF:
-            io_ = processBand(io_);
-            break;
-        default /* PASS & UNKNOWN */:; // io_ = filter_hard_clipper(io_);
-        }
-
-        return io_;
-    }
-
-    //==========================================================================
-    inline void reset() noexcept
-    {
-        last_filter_type = UNKNOWN;
-        smooth_filter_type = UNKNOWN;
-        glide_time_4_filters = 0;
-        if (smooth_filter)
-        {
-            smooth_filter->reset();
-        }
-        flt_1.reset();
-        flt_2.reset();
-    }
-
-  public:
-    //==============================================================================
-    COLD DoubleAnalogFilter(RuntimeNotifyer *const notifyer_,
-                            bool create_smooth_filter = true) noexcept
-        : flt_1(notifyer_), flt_2(notifyer_),
-
-          smooth_filter(nullptr),
-
-          last_filter_type(UNKNOWN), smooth_filter_type(UNKNOWN),
-
-          glide_time_4_filters(0)
-    {
-        if (create_smooth_filter)
-        {
-            smooth_filter = new DoubleAnalogFilter(notifyer_, false);
-        }
-    }
-    COLD ~DoubleAnalogFilter() noexcept
-    {
-        if (smooth_filter)
-        {
-            delete smooth_filter;
-        }
-    }
-
-    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(DoubleAnalogFilter)
-};
-
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-class FilterProcessor
-{
-    juce::OwnedArray<DoubleAnalogFilter> double_filter;
-    friend class mono_ParameterOwnerStore;
-
-  public:
-    std::unique_ptr<ENV> env;
-    juce::Array<ENVData *> input_env_datas;
-    juce::OwnedArray<ENV> input_envs;
-
-  private:
-    const int id;
-
-    const MoniqueSynthData *const synth_data;
-    FilterData *const filter_data;
-    DataBuffer *const data_buffer;
-
-    const float *const sin_lookup;
-    const float *const cos_lookup;
-
-  public:
-    //==========================================================================
-    inline void start_attack() noexcept
-    {
-        start_env();
-        start_input_env(0);
-        start_input_env(1);
-        start_input_env(2);
-    }
-    inline void start_env() noexcept { env->start_attack(); }
-    inline void start_input_env(int id_) noexcept { input_envs.getUnchecked(id_)->start_attack(); }
-    inline void start_release() noexcept
-    {
-        start_env_release();
-        start_input_env_release(0);
-        start_input_env_release(1);
-        start_input_env_release(2);
-    }
-    inline void start_env_release() noexcept { env->set_to_release(); }
-    inline void start_input_env_release(int id_) noexcept
-    {
-        input_envs.getUnchecked(id_)->set_to_release();
-    }
-
-    //==========================================================================
-    inline void reset() noexcept
-    {
-        env->reset();
-        for (int input_id = 0; input_id != SUM_INPUTS_PER_FILTER; ++input_id)
-        {
-            input_envs.getUnchecked(input_id)->reset();
-        }
-
-        // double_filter[0]->reset();
-        // double_filter[1]->reset();
-        // double_filter[2]->reset();
-    }
-
-  private:
-    //==========================================================================
-    inline void pre_process(const int input_id, const int num_samples) noexcept
-    {
-        // CALCULATE INPUTS AND ENVELOPS
-        {
-            {
-                const int glide_modotr_time = synth_data->glide_motor_time;
-                if (id == FILTER_1)
-                {
-                    float *tmp_input_amp = data_buffer->filter_input_env_amps.getWritePointer(
-                        input_id + SUM_INPUTS_PER_FILTER * FILTER_1);
-                    ENV *const input_env(input_envs.getUnchecked(input_id));
-                    filter_data->input_smoothers[input_id]->process_amp(
-                        !filter_data->input_holds[input_id], glide_modotr_time, input_env,
-                        tmp_input_amp, num_samples);
-
-                    float *filter_input_buffer =
-                        data_buffer->filter_input_samples.getWritePointer(input_id);
-                    const float *const osc_input_buffer =
-                        data_buffer->osc_samples.getReadPointer(input_id);
-                    for (int sid = 0; sid != num_samples; ++sid)
-                    {
-                        filter_input_buffer[sid] = osc_input_buffer[sid] * tmp_input_amp[sid];
-                    }
-                }
-                else if (id == FILTER_2)
-                {
-                    float *tmp_input_amp = data_buffer->filter_input_env_amps.getWritePointer(
-                        input_id + SUM_INPUTS_PER_FILTER * FILTER_2);
-                    ENV *const input_env(input_envs.getUnchecked(input_id));
-                    filter_data->input_smoothers[input_id]->process_amp(
-                        !filter_data->input_holds[input_id], glide_modotr_time, input_env,
-                        tmp_input_amp, num_samples);
-
-                    float *const filter_input_buffer =
-                        data_buffer->filter_input_samples.getWritePointer(
-                            input_id + SUM_INPUTS_PER_FILTER * FILTER_2);
-                    const float *const filter_before_buffer =
-                        data_buffer->filter_output_samples.getReadPointer(
-                            input_id + SUM_INPUTS_PER_FILTER * FILTER_1);
-                    const float *const osc_input_buffer =
-                        data_buffer->osc_samples.getReadPointer(input_id);
-                    for (int sid = 0; sid != num_samples; ++sid)
-                    {
-                        filter_input_buffer[sid] =
-                            tmp_input_amp[sid] < 0 ? osc_input_buffer[sid] * tmp_input_amp[sid] * -1
-                                                   : filter_before_buffer[sid] * tmp_input_amp[sid];
-                    }
-                }
-                else
-                {
-                    float *tmp_input_amp_1 = data_buffer->filter_input_env_amps.getWritePointer(
-                        0 + SUM_INPUTS_PER_FILTER * FILTER_3);
-                    float *tmp_input_amp_2 = data_buffer->filter_input_env_amps.getWritePointer(
-                        1 + SUM_INPUTS_PER_FILTER * FILTER_3);
-                    float *tmp_input_amp_3 = data_buffer->filter_input_env_amps.getWritePointer(
-                        2 + SUM_INPUTS_PER_FILTER * FILTER_3);
-                    {
-                        ENV *const input_env(input_envs.getUnchecked(0));
-                        filter_data->input_smoothers[0]->process_amp(!filter_data->input_holds[0],
-                                                                     glide_modotr_time, input_env,
-                                                                     tmp_input_amp_1, num_samples);
-                    }
-                    {
-                        ENV *const input_env(input_envs.getUnchecked(1));
-                        filter_data->input_smoothers[1]->process_amp(!filter_data->input_holds[1],
-                                                                     glide_modotr_time, input_env,
-                                                                     tmp_input_amp_2, num_samples);
-                    }
-                    {
-                        ENV *const input_env(input_envs.getUnchecked(2));
-                        filter_data->input_smoothers[2]->process_amp(!filter_data->input_holds[2],
-                                                                     glide_modotr_time, input_env,
-                                                                     tmp_input_amp_3, num_samples);
-                    }
-
-                    float *const filter_input_buffer =
-                        data_buffer->filter_input_samples.getWritePointer(
-                            0 + SUM_INPUTS_PER_FILTER * FILTER_3);
-                    const float *const filter_before_buffer_1 =
-                        data_buffer->filter_output_samples.getReadPointer(
-                            0 + SUM_INPUTS_PER_FILTER * FILTER_2);
-                    const float *const filter_before_buffer_2 =
-                        data_buffer->filter_output_samples.getReadPointer(
-                            1 + SUM_INPUTS_PER_FILTER * FILTER_2);
-                    const float *const filter_before_buffer_3 =
-                        data_buffer->filter_output_samples.getReadPointer(
-                            2 + SUM_INPUTS_PER_FILTER * FILTER_2);
-                    const float *const osc_input_buffer_1 =
-                        data_buffer->osc_samples.getReadPointer(0);
-                    const float *const osc_input_buffer_2 =
-                        data_buffer->osc_samples.getReadPointer(1);
-                    const float *const osc_input_buffer_3 =
-                        data_buffer->osc_samples.getReadPointer(2);
-
-                    juce::FloatVectorOperations::clear(filter_input_buffer, num_samples);
-                    for (int sid = 0; sid != num_samples; ++sid)
-                    {
-                        filter_input_buffer[sid] = sample_mix(
-                            sample_mix(tmp_input_amp_1[sid] < 0
-                                           ? osc_input_buffer_1[sid] * tmp_input_amp_1[sid] * -1
-                                           : filter_before_buffer_1[sid] * tmp_input_amp_1[sid],
-                                       tmp_input_amp_2[sid] < 0
-                                           ? osc_input_buffer_2[sid] * tmp_input_amp_2[sid] * -1
-                                           : filter_before_buffer_2[sid] * tmp_input_amp_2[sid]),
-                            tmp_input_amp_3[sid] < 0
-                                ? osc_input_buffer_3[sid] * tmp_input_amp_3[sid] * -1
-                                : filter_before_buffer_3[sid] * tmp_input_amp_3[sid]);
-                    }
-                }
-            }
-        }
-    }
-    inline void process_amp_mix(const int num_samples) noexcept
-    {
-        // ADSTR - LFO MIX
-        float *amp_mix = data_buffer->lfo_amplitudes.getWritePointer(id);
-        const float *smoothed_mix_buffer(
-            filter_data->adsr_lfo_mix_smoother.get_smoothed_value_buffer());
-        {
-            const float *env_amps = data_buffer->filter_env_amps.getReadPointer(id);
-            const float *lfo_amplitudes = data_buffer->lfo_amplitudes.getReadPointer(id);
-            for (int sid = 0; sid != num_samples; ++sid)
-            {
-                // LFO ADSR MIX - HERE TO SAVE ONE LOOP
-                const float mix = (1.0f + smoothed_mix_buffer[sid]) * 0.5f;
-                amp_mix[sid] = env_amps[sid] * (1.0f - mix) + lfo_amplitudes[sid] * mix;
-            }
-        }
-    }
-
-    static float distortion__(float x_, float distortion_power_) noexcept
-    {
-        if (distortion_power_ != 0)
-        {
-            // const float distortion_add_on = distortion_power_*0.9f;
-            // x_ = ((1.0f+distortion_add_on)*x_) - (x_*x_*x_)*distortion_add_on;
-            // (std::atan(input_and_worker_)*(1.0f/juce::MathConstants<float>::pi))*
-            // x_ = x_*(1.0f-distortion_power_) + 0.5f*soft_clipping( x_*10 )*(distortion_power_);
-
-            x_ = x_ * (1.0f - distortion_power_) + (std::atan(x_ * 20) / 6.66) * distortion_power_;
-
-            // x_ = x_*(1.0f-distortion_power_) + std::atan( x_*150 )*(1.0f/1.55)*distortion_power_;
-        }
-
-        return x_;
-    }
-
-  public:
-    //==========================================================================
-    inline void process(const int num_samples) noexcept
-    {
-        float *amp_mix = data_buffer->lfo_amplitudes.getWritePointer(id);
-        // PROCESS FILTER
-        {
-#define DISTORTION_IN(x) distortion__(x, filter_distortion)
-#define DISTORTION_OUT(x) distortion__(x, filter_distortion)
-
-            // PREPARE
-            {
-                process_amp_mix(num_samples);
-
-                filter_data->resonance_smoother.process_modulation(filter_data->modulate_resonance,
-                                                                   amp_mix, num_samples);
-                filter_data->cutoff_smoother.process_modulation(filter_data->modulate_cutoff,
-                                                                amp_mix, num_samples);
-                filter_data->distortion_smoother.process_modulation(
-                    filter_data->modulate_distortion, amp_mix, num_samples);
-                if (synth_data->is_stereo)
-                    filter_data->pan_smoother.process_modulation(filter_data->modulate_pan, amp_mix,
-                                                                 num_samples);
-            }
-
-            switch (filter_data->filter_type)
-            {
-            case LPF:
-            case LPF_2_PASS:
-            case MOOG_AND_LPF:
-            {
-                // PROCESSOR
-                struct LP2PassExecuter
-                {
-                    FilterProcessor *const processor;
-                    DoubleAnalogFilter &filter;
-                    const int input_id;
-                    const int num_samples_;
-
-                    const float *const tmp_resonance_buffer;
-                    const float *const tmp_cuttof_buffer;
-                    const float *const tmp_distortion_buffer;
-
-                    const float *const input_buffer;
-                    float *const out_buffer;
-
-                    inline void exec() noexcept
-                    {
-                        processor->pre_process(input_id, num_samples_);
-
-                        filter.update_filter_to(LPF_2_PASS);
-                        for (int sid = 0; sid != num_samples_; ++sid)
-                        {
-                            const float filter_distortion = tmp_distortion_buffer[sid];
-
-                            /*
-                                        filter.updateLow2Pass
-                                        (
-                                            tmp_resonance_buffer[sid],
-                                            ( (10180.0f * tmp_cuttof_buffer[sid]) +20 ),
-                                            tmp_gain_buffer[sid]
-                                        );
-                                        */
-
-                            filter.updateLow2Pass(tmp_resonance_buffer[sid],
-                                                  tmp_cuttof_buffer[sid]);
-                            out_buffer[sid] = DISTORTION_OUT(
-                                filter.processLow2Pass(DISTORTION_IN(input_buffer[sid])));
-                        }
-                    }
-                    LP2PassExecuter(FilterProcessor *const processor_, int num_samples__,
-                                    int input_id_) noexcept
-                        : processor(processor_),
-                          filter(*processor_->double_filter.getUnchecked(input_id_)),
-                          input_id(input_id_), num_samples_(num_samples__),
-
-                          tmp_resonance_buffer(processor_->filter_data->resonance_smoother
-                                                   .get_smoothed_value_buffer()),
-                          tmp_cuttof_buffer(
-                              processor_->filter_data->cutoff_smoother.get_smoothed_value_buffer()),
-                          tmp_distortion_buffer(processor_->filter_data->distortion_smoother
-                                                    .get_smoothed_value_buffer()),
-
-                          input_buffer(processor_->data_buffer->filter_input_samples.getReadPointer(
-                              input_id_ + SUM_INPUTS_PER_FILTER * processor_->id)),
-                          out_buffer(processor_->data_buffer->filter_output_samples.getWritePointer(
-                              input_id_ + SUM_INPUTS_PER_FILTER * processor_->id))
-                    {
-                    }
-                };
-                {
-                    if (id != FILTER_3)
-                    {
-                        LP2PassExecuter(this, num_samples, 0).exec();
-                        LP2PassExecuter(this, num_samples, 1).exec();
-                        LP2PassExecuter(this, num_samples, 2).exec();
-                    }
-                    else
-                    {
-                        // 1, 2 and 3
-                        LP2PassExecuter(this, num_samples, 0).exec();
-                    }
-                }
-            }
-            break;
-            case HPF:
-            case HIGH_2_PASS:
-            {
-                // PROCESSOR
-                struct HP2PassExecuter
-                {
-                    FilterProcessor *const processor;
-                    DoubleAnalogFilter &filter;
-                    const int input_id;
-                    const int num_samples_;
-
-                    const float *const tmp_resonance_buffer;
-                    const float *const tmp_cuttof_buffer;
-                    const float *const tmp_distortion_buffer;
-
-                    const float *const input_buffer;
-                    float *const out_buffer;
-
-                    inline void exec() noexcept
-                    {
-                        processor->pre_process(input_id, num_samples_);
-
-                        filter.update_filter_to(HIGH_2_PASS);
-                        for (int sid = 0; sid != num_samples_; ++sid)
-                        {
-                            const float filter_distortion = tmp_distortion_buffer[sid];
-                            filter.updateHigh2Pass(tmp_resonance_buffer[sid],
-                                                   tmp_cuttof_buffer[sid]);
-                            out_buffer[sid] = DISTORTION_OUT(
-                                filter.processHigh2Pass(DISTORTION_IN(input_buffer[sid])));
-                        }
-                    }
-                    HP2PassExecuter(FilterProcessor *const processor_, int num_samples__,
-                                    int input_id_) noexcept
-                        : processor(processor_),
-                          filter(*processor_->double_filter.getUnchecked(input_id_)),
-                          input_id(input_id_), num_samples_(num_samples__),
-
-                          tmp_resonance_buffer(processor_->filter_data->resonance_smoother
-                                                   .get_smoothed_value_buffer()),
-                          tmp_cuttof_buffer(
-                              processor_->filter_data->cutoff_smoother.get_smoothed_value_buffer()),
-                          tmp_distortion_buffer(processor_->filter_data->distortion_smoother
-                                                    .get_smoothed_value_buffer()),
-
-                          input_buffer(processor_->data_buffer->filter_input_samples.getReadPointer(
-                              input_id_ + SUM_INPUTS_PER_FILTER * processor_->id)),
-                          out_buffer(processor_->data_buffer->filter_output_samples.getWritePointer(
-                              input_id_ + SUM_INPUTS_PER_FILTER * processor_->id))
-                    {
-                    }
-                };
-                {
-                    if (id != FILTER_3)
-                    {
-                        HP2PassExecuter(this, num_samples, 0).exec();
-                        HP2PassExecuter(this, num_samples, 1).exec();
-                        HP2PassExecuter(this, num_samples, 2).exec();
-                    }
-                    else
-                    {
-                        // 1, 2 and 3
-                        HP2PassExecuter(this, num_samples, 0).exec();
-                    }
-                }
-            }
-            break;
-            case BPF:
-            {
-                // PROCESSOR
-                struct BandExecuter
-                {
-                    FilterProcessor *const processor;
-                    DoubleAnalogFilter &filter;
-                    const int input_id;
-                    const int num_samples_;
-
-                    const float *const tmp_resonance_buffer;
-                    const float *const tmp_cuttof_buffer;
-                    const float *const tmp_distortion_buffer;
-
-                    const float *const input_buffer;
-                    float *const out_buffer;
-
-                    inline void exec() noexcept
-                    {
-                        processor->pre_process(input_id, num_samples_);
-
-                        filter.update_filter_to(BPF);
-
-                        for (int sid = 0; sid != num_samples_; ++sid)
-                        {
-                            const float filter_distortion = tmp_distortion_buffer[sid];
-                            filter.updateBand(tmp_resonance_buffer[sid], tmp_cuttof_buffer[sid]);
-                            out_buffer[sid] = DISTORTION_OUT(
-                                filter.processBand(DISTORTION_IN(input_buffer[sid])));
-                        }
-                    }
-                    BandExecuter(FilterProcessor *const processor_, int num_samples__,
-                                 int input_id_) noexcept
-                        : processor(processor_),
-                          filter(*processor_->double_filter.getUnchecked(input_id_)),
-                          input_id(input_id_), num_samples_(num_samples__),
-
-                          tmp_resonance_buffer(processor_->filter_data->resonance_smoother
-                                                   .get_smoothed_value_buffer()),
-                          tmp_cuttof_buffer(
-                              processor_->filter_data->cutoff_smoother.get_smoothed_value_buffer()),
-                          tmp_distortion_buffer(processor_->filter_data->distortion_smoother
-                                                    .get_smoothed_value_buffer()),
-
-                          input_buffer(processor_->data_buffer->filter_input_samples.getReadPointer(
-                              input_id_ + SUM_INPUTS_PER_FILTER * processor_->id)),
-                          out_buffer(processor_->data_buffer->filter_output_samples.getWritePointer(
-                              input_id_ + SUM_INPUTS_PER_FILTER * processor_->id))
-                    {
-                    }
-                };
-                {
-                    if (id != FILTER_3)
-                    {
-                        BandExecuter(this, num_samples, 0).exec();
-                        BandExecuter(this, num_samples, 1).exec();
-                        BandExecuter(this, num_samples, 2).exec();
-                    }
-                    else
-                    {
-                        // 1, 2 and 3
-                        BandExecuter(this, num_samples, 0).exec();
-                    }
-                }
-            }
-            break;
-            default: //  PASS
-            {
-                // PROCESSOR
-                struct PassExecuter
-                {
-                    FilterProcessor *const processor;
-                    DoubleAnalogFilter &filter;
-                    const int input_id;
-                    const int num_samples_;
-
-                    const float *const tmp_distortion_buffer;
-
-                    const float *const input_buffer;
-                    float *const out_buffer;
-
-                    inline void exec() noexcept
-                    {
-                        processor->pre_process(input_id, num_samples_);
-
-                        filter.update_filter_to(PASS);
-
-                        for (int sid = 0; sid != num_samples_; ++sid)
-                        {
-                            const float filter_distortion = tmp_distortion_buffer[sid];
-                            out_buffer[sid] = DISTORTION_OUT(
-                                filter.processPass(DISTORTION_IN(input_buffer[sid])));
-                        }
-                    }
-                    PassExecuter(FilterProcessor *const processor_, int num_samples__,
-                                 int input_id_) noexcept
-                        : processor(processor_),
-                          filter(*processor_->double_filter.getUnchecked(input_id_)),
-                          input_id(input_id_), num_samples_(num_samples__),
-
-                          tmp_distortion_buffer(processor_->filter_data->distortion_smoother
-                                                    .get_smoothed_value_buffer()),
-
-                          input_buffer(processor_->data_buffer->filter_input_samples.getReadPointer(
-                              input_id_ + SUM_INPUTS_PER_FILTER * processor_->id)),
-                          out_buffer(processor_->data_buffer->filter_output_samples.getWritePointer(
-                              input_id_ + SUM_INPUTS_PER_FILTER * processor_->id))
-                    {
-                    }
-                };
-                {
-                    if (id != FILTER_3)
-                    {
-                        PassExecuter(this, num_samples, 0).exec();
-                        PassExecuter(this, num_samples, 1).exec();
-                        PassExecuter(this, num_samples, 2).exec();
-                    }
-                    else
-                    {
-                        // 1, 2 and 3
-                        PassExecuter(this, num_samples, 0).exec();
-                        ;
-                    }
-                }
-            }
-            break;
-            }
-        }
-
-        // COLLECT RESULTS
-        float *const this_filter_output_buffer =
-            data_buffer->filter_output_samples_l_r.getWritePointer(id);
-        {
-            const float *const smoothed_distortion_buffer(
-                filter_data->distortion_smoother.get_smoothed_value_buffer());
-            {
-                filter_data->output_smoother.process_modulation(filter_data->modulate_output,
-                                                                amp_mix, num_samples);
-                const float *const smoothed_output_buffer =
-                    filter_data->output_smoother.get_smoothed_value_buffer();
-                if (id != FILTER_3)
-                {
-                    float *const out_buffer_1(data_buffer->filter_output_samples.getWritePointer(
-                        0 + SUM_INPUTS_PER_FILTER * id));
-                    float *const out_buffer_2(data_buffer->filter_output_samples.getWritePointer(
-                        1 + SUM_INPUTS_PER_FILTER * id));
-                    float *const out_buffer_3(data_buffer->filter_output_samples.getWritePointer(
-                        2 + SUM_INPUTS_PER_FILTER * id));
-                    for (int sid = 0; sid != num_samples; ++sid)
-                    {
-                        // OUTPUT MIX AND DISTORTION
-                        {
-                            const float amp = smoothed_output_buffer[sid];
-                            float shape_power = smoothed_distortion_buffer[sid];
-                            const float result =
-                                sample_mix(sample_mix(out_buffer_1[sid], out_buffer_2[sid]),
-                                           out_buffer_3[sid]) *
-                                amp * 2;
-
-                            this_filter_output_buffer[sid] =
-                                sample_mix(result * (1.0f - shape_power),
-                                           soft_clipping(result * 5) * 1.5 * (shape_power));
-                        }
-                    }
-                }
-                else
-                {
-                    float *const out_buffer(data_buffer->filter_output_samples.getWritePointer(
-                        0 + SUM_INPUTS_PER_FILTER * FILTER_3));
-                    for (int sid = 0; sid != num_samples; ++sid)
-                    {
-                        // OUTPUT MIX AND DISTORTION
-                        {
-                            const float amp = smoothed_output_buffer[sid];
-                            float shape_power = smoothed_distortion_buffer[sid];
-                            const float result = out_buffer[sid] * amp * 2;
-
-                            this_filter_output_buffer[sid] =
-                                sample_mix(result * (1.0f - shape_power),
-                                           soft_clipping(result * 5) * 1.5 * (shape_power));
-                        }
-                    }
-                }
-            }
-        }
-
-// PAN & MIX
-#ifdef POLY
-        if (synth_data->is_stereo)
-#endif
-        {
-            const float *const pan_buffer = filter_data->pan_smoother.get_smoothed_value_buffer();
-            float *const left_and_input_output_buffer =
-                data_buffer->filter_output_samples_l_r.getWritePointer(id);
-            float *const right_output_buffer =
-                data_buffer->filter_output_samples_l_r.getWritePointer(SUM_FILTERS + id);
-#ifdef POLY
-            const bool calculate_tracking[SUM_FILTERS] = {synth_data->keytrack_filter_volume[0],
-                                                          synth_data->keytrack_filter_volume[1],
-                                                          synth_data->keytrack_filter_volume[2]};
-            const float *const env_tracking_buffer =
-                data_buffer->filter_env_tracking.getReadPointer(id);
-#endif
-            // const float multiplyer = id == FILTER_3 ? 1.5f : 1;
-            for (int sid = 0; sid != num_samples; ++sid)
-            {
-                const float pan = pan_buffer[sid];
-                const float output_sample = left_and_input_output_buffer[sid];
-#ifdef POLY
-                right_output_buffer[sid] =
-                    output_sample * left_pan(pan, sin_lookup) *
-                    (calculate_tracking[id]
-                         ? env_tracking_buffer[sid] *
-                                   (1.0f - synth_data->keytrack_filter_volume_offset[id]) +
-                               synth_data->keytrack_filter_volume_offset[id]
-                         : 1);
-                left_and_input_output_buffer[sid] =
-                    output_sample * right_pan(pan, cos_lookup) *
-                    (calculate_tracking[id]
-                         ? env_tracking_buffer[sid] *
-                                   (1.0f - synth_data->keytrack_filter_volume_offset[id]) +
-                               synth_data->keytrack_filter_volume_offset[id]
-                         : 1);
-#else
-                right_output_buffer[sid] = output_sample * left_pan(pan, sin_lookup);
-                left_and_input_output_buffer[sid] = output_sample * right_pan(pan, cos_lookup);
-#endif
-            }
-
-            // VISUALIZE
-            if (Monique_Ui_AmpPainter *const amp_painter = synth_data->audio_processor->amp_painter)
-            {
-                amp_painter->add_filter_env(id, amp_mix, num_samples);
-                amp_painter->add_filter(id, right_output_buffer, left_and_input_output_buffer,
-                                        num_samples);
-            }
-        }
-#ifdef POLY
-        else // NOTE just a reduced copy of the function before
-        {
-            float *const left_and_input_output_buffer =
-                data_buffer->filter_output_samples_l_r.getWritePointer(id);
-            const bool calculate_tracking[SUM_FILTERS] = {synth_data->keytrack_filter_volume[0],
-                                                          synth_data->keytrack_filter_volume[1],
-                                                          synth_data->keytrack_filter_volume[2]};
-            const float *const env_tracking_buffer =
-                data_buffer->filter_env_tracking.getReadPointer(id);
-            // const float multiplyer = id == FILTER_3 ? 1.5f : 1;
-            for (int sid = 0; sid != num_samples; ++sid)
-            {
-                const float output_sample = left_and_input_output_buffer[sid];
-                left_and_input_output_buffer[sid] =
-                    output_sample *
-                    (calculate_tracking[id]
-                         ? env_tracking_buffer[sid] *
-                                   (1.0f - synth_data->keytrack_filter_volume_offset[id]) +
-                               synth_data->keytrack_filter_volume_offset[id]
-                         : 1);
-            }
-
-            // VISUALIZE
-            if (Monique_Ui_AmpPainter *const amp_painter = synth_data->audio_processor->amp_painter)
-            {
-                amp_painter->add_filter_env(id, amp_mix, num_samples);
-                amp_painter->add_filter(id, left_and_input_output_buffer,
-                                        left_and_input_output_buffer, num_samples);
-            }
-        }
-#endif
-
-        // COLLECT THE FINAL OUTPUT
-        if (id == FILTER_3)
-        {
-            if (synth_data->is_stereo)
-            {
-                float *const master_left_output_buffer =
-                    data_buffer->filter_stereo_output_samples.getWritePointer(LEFT);
-                float *const master_right_output_buffer =
-                    data_buffer->filter_stereo_output_samples.getWritePointer(RIGHT);
-                const float *const left_output_buffer_flt1 =
-                    data_buffer->filter_output_samples_l_r.getReadPointer(0);
-                const float *const right_output_buffer_flt1 =
-                    data_buffer->filter_output_samples_l_r.getReadPointer(SUM_FILTERS);
-                const float *const left_output_buffer_flt2 =
-                    data_buffer->filter_output_samples_l_r.getReadPointer(1);
-                const float *const right_output_buffer_flt2 =
-                    data_buffer->filter_output_samples_l_r.getReadPointer(SUM_FILTERS + 1);
-                const float *const left_output_buffer_flt3 =
-                    data_buffer->filter_output_samples_l_r.getReadPointer(2);
-                const float *const right_output_buffer_flt3 =
-                    data_buffer->filter_output_samples_l_r.getReadPointer(SUM_FILTERS + 2);
-                const float *const smoothed_distortion =
-                    synth_data->distortion_smoother.get_smoothed_value_buffer();
-                const float *const smoothed_fx_bypass_buffer =
-                    synth_data->effect_bypass_smoother.get_smoothed_value_buffer();
-
-                for (int sid = 0; sid != num_samples; ++sid)
-                {
-                    const float left = sample_mix(
-                        sample_mix(left_output_buffer_flt1[sid], left_output_buffer_flt2[sid]),
-                        left_output_buffer_flt3[sid]);
-                    const float right = sample_mix(
-                        sample_mix(right_output_buffer_flt1[sid], right_output_buffer_flt2[sid]),
-                        right_output_buffer_flt3[sid]);
-                    const float left_add = left_output_buffer_flt1[sid] +
-                                           left_output_buffer_flt2[sid] +
-                                           left_output_buffer_flt3[sid];
-                    const float right_add = right_output_buffer_flt1[sid] +
-                                            right_output_buffer_flt2[sid] +
-                                            right_output_buffer_flt3[sid];
-                    const float distortion =
-                        smoothed_distortion[sid] * smoothed_fx_bypass_buffer[sid];
-
-                    master_left_output_buffer[sid] =
-                        left * (1.0f - distortion) +
-                        1.33f * soft_clipping(left_add * 10) * (distortion);
-                    master_right_output_buffer[sid] =
-                        right * (1.0f - distortion) +
-                        1.33f * soft_clipping(right_add * 10) * (distortion);
-                }
-            }
-            else // NOTE just a reduced copy of the function before
-            {
-                float *const master_left_output_buffer =
-                    data_buffer->filter_stereo_output_samples.getWritePointer(LEFT);
-                const float *const left_output_buffer_flt1 =
-                    data_buffer->filter_output_samples_l_r.getReadPointer(0);
-                const float *const left_output_buffer_flt2 =
-                    data_buffer->filter_output_samples_l_r.getReadPointer(1);
-                const float *const left_output_buffer_flt3 =
-                    data_buffer->filter_output_samples_l_r.getReadPointer(2);
-                const float *const smoothed_distortion =
-                    synth_data->distortion_smoother.get_smoothed_value_buffer();
-                const float *const smoothed_fx_bypass_buffer =
-                    synth_data->effect_bypass_smoother.get_smoothed_value_buffer();
-
-                for (int sid = 0; sid != num_samples; ++sid)
-                {
-                    const float left = sample_mix(
-                        sample_mix(left_output_buffer_flt1[sid], left_output_buffer_flt2[sid]),
-                        left_output_buffer_flt3[sid]);
-                    const float left_add = left_output_buffer_flt1[sid] +
-                                           left_output_buffer_flt2[sid] +
-                                           left_output_buffer_flt3[sid];
-                    const float distortion =
-                        smoothed_distortion[sid] * smoothed_fx_bypass_buffer[sid];
-
-                    master_left_output_buffer[sid] =
-                        left * (1.0f - distortion) +
-                        1.33f * soft_clipping(left_add * 10) * (distortion);
-                }
-            }
-        }
-    }
-
-  public:
-    //==============================================================================
-    COLD FilterProcessor(RuntimeNotifyer *const notifyer_, const MoniqueSynthData *synth_data_,
-                         int id_, const float *const sine_lookup_, const float *const cos_lookup_,
-                         const float *const exp_lookup_) noexcept
-        : env(new ENV(notifyer_, synth_data_, synth_data_->filter_datas[id_]->env_data,
-                      sine_lookup_, cos_lookup_, exp_lookup_)),
-          input_envs(),
-
-          id(id_),
-
-          synth_data(synth_data_), filter_data(synth_data_->filter_datas[id_]),
-          data_buffer(synth_data_->data_buffer),
-
-          sin_lookup(synth_data->sine_lookup), cos_lookup(synth_data->cos_lookup)
-    {
-        for (int i = 0; i != SUM_INPUTS_PER_FILTER; ++i)
-        {
-            double_filter.add(new DoubleAnalogFilter(notifyer_));
-
-            ENVData *input_env_data(synth_data_->filter_datas[id_]->input_envs[i]);
-            input_env_datas.add(input_env_data);
-            input_envs.add(new ENV(notifyer_, synth_data_, input_env_data, sine_lookup_,
-                                   cos_lookup_, exp_lookup_));
-        }
-    }
-    COLD ~FilterProcessor() noexcept {}
-
-    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(FilterProcessor)
-};
-
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-static inline float get_low_pass_band_frequency(int band_id_, double sample_rate_) noexcept
-{
-    switch (band_id_)
-    {
-    case 0:
-        return 82.41;
-    case 1:
-        return 164.81;
-    case 2:
-        return 329.63;
-    case 3:
-        return 659.25;
-    case 4:
-        return 1318.51;
-    case 5:
-        return 2637.02;
-    default:
-        // return 2637.02;
-        return sample_rate_ / 2;
-    }
-}
-static inline float get_high_pass_band_frequency(int band_id_) noexcept
-{
-    switch (band_id_)
-    {
-    case 0:
-        return 20.60;
-    case 1:
-        return 82.41;
-    case 2:
-        return 164.81;
-    case 3:
-        return 329.63;
-    case 4:
-        return 659.25;
-    case 5:
-        return 1318.51;
-    default:
-        return 2637.02;
-    }
-}
-class EQProcessor : public RuntimeListener
-{
-    friend class EQProcessorStereo;
-
-    float frequency_low_pass[SUM_EQ_BANDS];
-    float frequency_high_pass[SUM_EQ_BANDS];
-
-    juce::OwnedArray<AnalogFilter> filters;
-    juce::IIRFilter high_pass_filters[SUM_EQ_BANDS];
-
-    friend class mono_ParameterOwnerStore;
-
-    const MoniqueSynthData *const synth_data;
-    const EQData *const eq_data;
-    DataBuffer *const data_buffer;
-
-  public:
-    //==============================================================================
-    inline void reset() noexcept
-    {
-        for (int band_id = 0; band_id != SUM_EQ_BANDS; ++band_id)
-        {
-            filters[band_id]->reset();
-            high_pass_filters[band_id].reset();
-        }
-    }
-
-    void sample_rate_or_block_changed() noexcept override
-    {
-        reset();
-        for (int band_id = 0; band_id != SUM_EQ_BANDS; ++band_id)
-        {
-            frequency_low_pass[band_id] = get_low_pass_band_frequency(band_id, sample_rate);
-            high_pass_filters[band_id].setCoefficients(
-                juce::IIRCoefficients::makeHighPass(sample_rate, frequency_high_pass[band_id]));
-        }
-    }
-
-    //==============================================================================
-    inline void process(float *io_buffer_, int num_samples_) noexcept
-    {
-        {
-            struct BandExecuter
-            {
-                const int band_id;
-
-                const int num_samples_;
-                const float *const smoothed_shape_buffer;
-
-                const float filter_frequency;
-                juce::IIRFilter &high_pass_filter;
-                AnalogFilter &filter;
-
-                const float *const filter_in_samples;
-                float *const band_out_buffer;
-                const float *const env_buffer;
-
-                inline void exec() noexcept { exec_default(); }
-                /*
-inline void exec_first() noexcept
-{
-    // PROCESS
-    for( int sid = 0 ; sid != num_samples_ ; ++sid )
-    {
-        const float shape = smoothed_shape_buffer[sid];
-        const float amp = env_buffer[sid];
-        const float in = filter_in_samples[sid] * amp;
-        filter.update_with_fixed_cutoff( shape*0.8f, filter_frequency );
-        float output = filter.processLowResonance(in);
-        band_out_buffer[sid] = output*4;
-    }
-}
-                */
-                inline void exec_default() noexcept
-                {
-                    // PROCESS
-                    for (int sid = 0; sid != num_samples_; ++sid)
-                    {
-                        const float shape = smoothed_shape_buffer[sid];
-                        const float amp = env_buffer[sid];
-                        const float in = filter_in_samples[sid] * amp;
-                        filter.update_with_fixed_cutoff(shape * 0.8f, filter_frequency);
-                        float output =
-                            high_pass_filter.processSingleSampleRaw(filter.processLowResonance(in));
-                        band_out_buffer[sid] = output * 4;
-                    }
-                }
-                /*
-inline void exec_last() noexcept
-{
-    // PROCESS
-    for( int sid = 0 ; sid != num_samples_ ; ++sid )
-    {
-        const float shape = smoothed_shape_buffer[sid];
-        const float amp = env_buffer[sid];
-        const float in = filter_in_samples[sid] * amp;
-        filter.update_with_fixed_cutoff( shape*0.8f, filter_frequency );
-        float output = high_pass_filter.processSingleSampleRaw ( filter.processHighResonance(in) );
-        band_out_buffer[sid] = output*1.5;
-    }
-}
-                */
-                BandExecuter(EQProcessor *const processor_, float *in_buffer_, int num_samples__,
-                             int band_id_) noexcept
-                    : band_id(band_id_),
-
-                      num_samples_(num_samples__),
-                      smoothed_shape_buffer(
-                          processor_->synth_data->shape_smoother.get_smoothed_value_buffer()),
-
-                      filter_frequency(processor_->frequency_low_pass[band_id_]),
-                      high_pass_filter(processor_->high_pass_filters[band_id_]),
-                      filter(*processor_->filters.getUnchecked(band_id_)),
-
-                      filter_in_samples(in_buffer_),
-                      band_out_buffer(
-                          processor_->data_buffer->band_out_buffers.getWritePointer(band_id_)),
-                      env_buffer(
-                          processor_->data_buffer->band_env_buffers.getWritePointer(band_id_))
-                {
-                }
-            };
-
-            for (int band_id = 0; band_id != SUM_EQ_BANDS; ++band_id)
-            {
-                BandExecuter(this, io_buffer_, num_samples_, band_id).exec();
-            }
-        }
-        // EO MULTITHREADED
-
-        // FINAL MIX - SINGLE THREADED ( NOT REALLY OPTIMIZED )
-        {
-            const float *const buffer_1(data_buffer->band_out_buffers.getReadPointer(0));
-            const float *const buffer_2(data_buffer->band_out_buffers.getReadPointer(1));
-            const float *const buffer_3(data_buffer->band_out_buffers.getReadPointer(2));
-            const float *const buffer_4(data_buffer->band_out_buffers.getReadPointer(3));
-            const float *const buffer_5(data_buffer->band_out_buffers.getReadPointer(4));
-            const float *const buffer_6(data_buffer->band_out_buffers.getReadPointer(5));
-            const float *const buffer_7(data_buffer->band_out_buffers.getReadPointer(6));
-
-            // const float* const smoothed_distortion =
-            // synth_data->final_clipping_smoother.get_smoothed_modulated_value_buffer() ;
-            const float *const smoothed_distortion =
-                synth_data->distortion_smoother.get_smoothed_value_buffer();
-            const float *const smoothed_fx_bypass_buffer =
-                synth_data->effect_bypass_smoother.get_smoothed_value_buffer();
-            const float *const smoothed_bypass =
-                eq_data->bypass_smoother.get_smoothed_value_buffer();
-            for (int sid = 0; sid != num_samples_; ++sid)
-            {
-                const float distortion = smoothed_distortion[sid] * smoothed_fx_bypass_buffer[sid];
-                const float bypass = smoothed_bypass[sid];
-                if (bypass > 0)
-                {
-                    float sum = sample_mix(
-                        sample_mix(sample_mix(sample_mix(sample_mix(sample_mix(buffer_7[sid],
-                                                                               buffer_6[sid]),
-                                                                    buffer_5[sid]),
-                                                         buffer_4[sid]),
-                                              buffer_3[sid]),
-                                   buffer_2[sid]),
-                        buffer_1[sid] * -1);
-
-                    // MONO_SNAP_TO_ZERO(sum)
-                    float mix = sum * bypass + io_buffer_[sid] * (1.0f - bypass);
-                    io_buffer_[sid] = soft_clipp_greater_1_2(
-                        mix * (1.0f - distortion) + (std::atan(mix * 10) * 0.7f) * distortion);
-                    // io_buffer_[sid] = soft_clipp_greater_1_2(sample_mix(mix*(1.0f-distortion),
-                    // sample_mix( mix, mix )*distortion));
-                }
-                else
-                {
-                    io_buffer_[sid] = soft_clipp_greater_1_2(
-                        io_buffer_[sid] * (1.0f - distortion) +
-                        (std::atan(io_buffer_[sid] * 10) * 0.7f) * distortion);
-                }
-            }
-        }
-    }
-
-  public:
-    //==============================================================================
-    COLD EQProcessor(RuntimeNotifyer *const notifyer_, MoniqueSynthData *synth_data_) noexcept
-        : RuntimeListener(notifyer_),
-
-          synth_data(synth_data_), eq_data(synth_data_->eq_data.get()),
-          data_buffer(synth_data_->data_buffer)
-    {
-#ifdef JUCE_DEBUG
-        std::cout << "MONIQUE: init EQ L OR R" << std::endl;
-#endif
-
-        for (int band_id = 0; band_id != SUM_EQ_BANDS; ++band_id)
-        {
-            filters.add(new AnalogFilter(notifyer_));
-
-            frequency_low_pass[band_id] = get_low_pass_band_frequency(band_id, sample_rate);
-            frequency_high_pass[band_id] = get_high_pass_band_frequency(band_id);
-        }
-        sample_rate_or_block_changed();
-    }
-    COLD ~EQProcessor() noexcept {}
-
-    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(EQProcessor)
-};
-
-//==============================================================================
-//==============================================================================
-//==============================================================================
-class EQProcessorStereo
-{
-    MoniqueSynthData *const synth_data;
-
-    EQProcessor *const left_processor;
-    EQProcessor *const right_processor;
-
-    EQData *const eq_data;
-    DataBuffer *const data_buffer;
-
-  public:
-    juce::OwnedArray<ENV> envs;
-
-  public:
-    //==============================================================================
-    inline void start_attack() noexcept
-    {
-        for (int band_id = 0; band_id != SUM_EQ_BANDS; ++band_id)
-        {
-            envs.getUnchecked(band_id)->start_attack();
-        }
-    }
-    inline void start_release() noexcept
-    {
-        for (int band_id = 0; band_id != SUM_EQ_BANDS; ++band_id)
-        {
-            envs.getUnchecked(band_id)->set_to_release();
-        }
-    }
-    inline void reset() noexcept
-    {
-        for (int band_id = 0; band_id != SUM_EQ_BANDS; ++band_id)
-        {
-            envs.getUnchecked(band_id)->reset();
-        }
-        left_processor->reset();
-        if (synth_data->is_stereo)
-            right_processor->reset();
-    }
-
-    //==============================================================================
-    inline void process(int num_samples_) noexcept
-    {
-        for (int band_id = 0; band_id != SUM_EQ_BANDS; ++band_id)
-        {
-            ENV *env(envs.getUnchecked(band_id));
-            eq_data->velocity_smoothers[band_id]->process_amp(
-                !eq_data->hold[band_id], synth_data->glide_motor_time, env,
-                data_buffer->band_env_buffers.getWritePointer(band_id), num_samples_);
-        }
-
-        left_processor->process(data_buffer->filter_stereo_output_samples.getWritePointer(LEFT),
-                                num_samples_);
-        if (synth_data->is_stereo)
-            right_processor->process(
-                data_buffer->filter_stereo_output_samples.getWritePointer(RIGHT), num_samples_);
-
-        if (Monique_Ui_AmpPainter *const amp_painter = synth_data->audio_processor->amp_painter)
-        {
-            amp_painter->add_eq(data_buffer->filter_stereo_output_samples.getWritePointer(LEFT),
-                                num_samples_);
-        }
-    }
-
-  public:
-    //==========================================================================
-    COLD EQProcessorStereo(RuntimeNotifyer *const notifyer_, MoniqueSynthData *synth_data_,
-                           const float *const sine_lookup_, const float *const cos_lookup_,
-                           const float *const exp_lookup_) noexcept
-        : synth_data(synth_data_), left_processor(new EQProcessor(notifyer_, synth_data_)),
-          right_processor(new EQProcessor(notifyer_, synth_data_)),
-          eq_data(synth_data_->eq_data.get()), data_buffer(synth_data_->data_buffer)
-    {
-#ifdef JUCE_DEBUG
-        std::cout << "MONIQUE: init EQ" << std::endl;
-#endif
-
-        for (int band_id = 0; band_id != SUM_EQ_BANDS; ++band_id)
-        {
-            envs.add(new ENV(notifyer_, synth_data_,
-                             synth_data_->eq_data->envs.getUnchecked(band_id), sine_lookup_,
-                             cos_lookup_, exp_lookup_));
-        }
-    }
-    COLD ~EQProcessorStereo() noexcept
-    {
-        delete right_processor;
-        delete left_processor;
-    }
-
-    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(EQProcessorStereo)
-};
-
-//==============================================================================
-//==============================================================================
-//==============================================================================
-class AllPassFilter
-{
-    juce::HeapBlock<float> buffer;
-    int bufferSize, bufferIndex;
-
-  public:
-    //==============================================================================
-    inline float process(const float input) noexcept
-    {
-        const float bufferedValue = buffer[bufferIndex];
-        float temp = input + (bufferedValue * 0.5f);
-        JUCE_UNDENORMALISE(temp);
-        buffer[bufferIndex] = temp;
-        bufferIndex = (bufferIndex + 1) % bufferSize;
-
-        return bufferedValue - input;
-    }
-
-    //==============================================================================
-    COLD void setSize(const int size)
-    {
-        if (size != bufferSize)
-        {
-            bufferIndex = 0;
-            buffer.malloc((size_t)size);
-            bufferSize = size;
-        }
-
-        clear();
-    }
-    COLD void clear() noexcept { buffer.clear((size_t)bufferSize); }
-
-  public:
-    //==============================================================================
-    COLD AllPassFilter() noexcept : bufferSize(0), bufferIndex(0) {}
-    COLD ~AllPassFilter() noexcept {}
-
-    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(AllPassFilter)
-};
-
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-class mono_Chorus : public RuntimeListener
-{
-    MoniqueSynthData *const synth_data;
-    ChorusData *const chorus_data;
+                        filter.update_filter_to(PASS);
 
-    mono_SineWaveAutonom osc_1;
-    mono_SineWaveAutonom osc_2;
-    mono_SineWaveAutonom osc_3;
-    mono_SineWaveAutonom osc_4;
-    mono_SineWaveAutonom osc_5;
+                        for (int sid = 0; sid != num_samples_; ++sid)
+                        {
+                            out_buffer[sid] = filter.processPass(input_buffer[sid]);
+                        }
+                        filter_distortion_block(out_buffer, tmp_distortion_buffer, out_buffer,
+                                                num_samples_, atan_accuracy);
+                    }
+                    PassExecuter(FilterProcessor *const processor_, int input_id_) noexcept
+                        : filter(*processor_->double_filter.getUnchecked(input_id_)),
+                          num_samples_(processor_->stage.num_samples),
+                          skip(processor_->stage.skip[input_id_]),
 
-    int buffer_size;
-    int index;
-    mono_AudioSampleBuffer<2> data_buffer;
-    float *current_left_buffer;
-    float *current_right_buffer;
+                          tmp_distortion_buffer(processor_->stage.distortion),
 
-    const float *const sin_lookup;
-    const float *const cos_lookup;
+                          atan_accuracy(processor_->synth_data->atan_accuracy),
 
-  public:
-#define SUM_DELAY_LINES 4
-    inline void process(float *left_in_, float *right_in_, float *left_out_, float *right_out_,
-                        int num_samples_) noexcept
-    {
-        const float *const chorus_env_buffer(
-            chorus_data->modulation_smoother.get_smoothed_value_buffer());
-        const float *const smoothed_pan_buffer(
-            chorus_data->pan_smoother.get_smoothed_value_buffer());
+                          input_buffer(processor_->stage.inputs[input_id_]),
+                          out_buffer(processor_->stage.outputs[input_id_])
+                    {
+                    }
+                };
+                {
+                    if (id != FILTER_3)
+                    {
+                        PassExecuter(this, 0).exec();
+                        PassExecuter(this, 1).exec();
+                        PassExecuter(this, 2).exec();
+                    }
+                    else
+                    {
+                        // 1, 2 and 3
+                        PassExecuter(this, 0).exec();
+                        ;
+                    }
+                }
+            }
+            break;
+            }
+            end_stage(num_samples);
+        }
 
-        const float e_samples = sample_rate / 164.81; // 82.41;
-        const float e2_samples = sample_rate / 165.91;
-        for (int sid = 0; sid != num_samples_; ++sid)
+        // COLLECT RESULTS
+        float *const this_filter_output_buffer =
+            data_buffer->filter_output_samples_l_r.getWritePointer(id);
         {
-            // const float power = (exp( (chorus_env_buffer[sid] *0.85f) *2)-1)/6.38906;
-            const float power = chorus_env_buffer[sid] * 0.8f;
-            const float amps[SUM_DELAY_LINES] = {
-                ((osc_1.tick() * 0.7f + osc_2.tick() * 0.3f) + 1) * 0.5f,
-                ((osc_1.lastOut_with_phase_offset(0.25f) * 0.3f + osc_3.tick() * 0.6f) + 1) * 0.5f,
-                ((osc_1.lastOut_with_phase_offset(0.5f) * 0.4f + osc_4.tick() * 0.5f) + 1) * 0.5f,
-                ((osc_1.lastOut_with_phase_offset(0.75f) * 0.6f + osc_5.tick() * 0.4f) + 1) * 0.5f};
-            const float pan = smoothed_pan_buffer[sid];
-
-#define CHECK_MAKE_INDEX_VALID(floated_index_, size_)                                              \
-    if (floated_index_ >= size_)                                                                   \
-    {                                                                                              \
-        floated_index_ -= size_;                                                                   \
-    }                                                                                              \
-    else if (floated_index_ < 0)                                                                   \
-    {                                                                                              \
-        floated_index_ += size_;                                                                   \
-    }
-#define CHECK_MAKE_INDEX_VALID_upper_only(floated_index_, size_)                                   \
-    if (floated_index_ >= size_)                                                                   \
-    {                                                                                              \
-        floated_index_ -= size_;                                                                   \
-    }
-            // L
-            const float fade_in = 1.0f - (juce::jmin(1.0f, power * 2));
-            const float fade_effect = (juce::jmin(1.0f, power * 2));
+            const float *const smoothed_distortion_buffer(
+                filter_data->distortion_smoother.get_smoothed_value_buffer());
             {
-                float result_l = 0;
-                for (int i = 0; i != SUM_DELAY_LINES; ++i)
+                filter_data->output_smoother.process_modulation(filter_data->modulate_output,
+                                                                amp_mix, num_samples);
+                const float *const smoothed_output_buffer =
+                    filter_data->output_smoother.get_smoothed_value_buffer();
+                if (id != FILTER_3)
                 {
-                    float delay = (power * 0.9 + 0.1) * e_samples * amps[i];
-                    float float_index = float(index) - delay + 1;
-                    CHECK_MAKE_INDEX_VALID(float_index, buffer_size)
-
-                    const int index_1 = std::floor(float_index);
-                    int index_2 = index_1 + 1;
-                    CHECK_MAKE_INDEX_VALID_upper_only(index_2, buffer_size) const float delta =
-                        float_index - index_1;
-
-                    result_l += (current_left_buffer[index_1] * (1.0f - delta) +
-                                 current_left_buffer[index_2] * delta) /
-                                (i + 2);
+                    float *const out_buffer_1(data_buffer->filter_output_samples.getWritePointer(
+                        0 + SUM_INPUTS_PER_FILTER * id));
+                    float *const out_buffer_2(data_buffer->filter_output_samples.getWritePointer(
+                        1 + SUM_INPUTS_PER_FILTER * id));
+                    float *const out_buffer_3(data_buffer->filter_output_samples.getWritePointer(
+                        2 + SUM_INPUTS_PER_FILTER * id));
+                    const float *const outputs[SUM_INPUTS_PER_FILTER] = {out_buffer_1, out_buffer_2,
+                                                                         out_buffer_3};
+                    sample_mix_block(this_filter_output_buffer, outputs, SUM_INPUTS_PER_FILTER,
+                                     num_samples);
+                    for (int sid = 0; sid != num_samples; ++sid)
+                    {
+                        // OUTPUT MIX AND DISTORTION
+                        {
+                            const float amp = smoothed_output_buffer[sid];
+                            float shape_power = smoothed_distortion_buffer[sid];
+                            const float result = this_filter_output_buffer[sid] * amp * 2;
+
+                            this_filter_output_buffer[sid] =
+                                sample_mix(result * (1.0f - shape_power),
+                                           soft_clipping(result * 5) * 1.5 * (shape_power));
+                        }
+                    }
                 }
+                else
                 {
-                    current_left_buffer[index] =
-                        sample_mix(left_in_[sid], result_l * power * left_pan(pan, sin_lookup));
-                    left_out_[sid] = left_in_[sid] * fade_in + result_l * fade_effect;
+                    float *const out_buffer(data_buffer->filter_output_samples.getWritePointer(
+                        0 + SUM_INPUTS_PER_FILTER * FILTER_3));
+                    for (int sid = 0; sid != num_samples; ++sid)
+                    {
+                        // OUTPUT MIX AND DISTORTION
+                        {
+                            const float amp = smoothed_output_buffer[sid];
+                            float shape_power = smoothed_distortion_buffer[sid];
+                            const float result = out_buffer[sid] * amp * 2;
+
+                            this_filter_output_buffer[sid] =
+                                sample_mix(result * (1.0f - shape_power),
+                                           soft_clipping(result * 5) * 1.5 * (shape_power));
+                        }
+                    }
                 }
             }
-            // R
+        }
+
+// PAN & MIX
+#ifdef POLY
+        if (synth_data->is_stereo)
+#endif
+        {
+            const float *const pan_buffer = filter_data->pan_smoother.get_smoothed_value_buffer();
+            float *const left_and_input_output_buffer =
+                data_buffer->filter_output_samples_l_r.getWritePointer(id);
+            float *const right_output_buffer =
+                data_buffer->filter_output_samples_l_r.getWritePointer(SUM_FILTERS + id);
+#ifdef POLY
+            const bool calculate_tracking[SUM_FILTERS] = {synth_data->keytrack_filter_volume[0],
+                                                          synth_data->keytrack_filter_volume[1],
+                                                          synth_data->keytrack_filter_volume[2]};
+            const float *const env_tracking_buffer =
+                data_buffer->filter_env_tracking.getReadPointer(id);
+#endif
+            float *const left_gains = data_buffer->pan_gains.getWritePointer(LEFT);
+            float *const right_gains = data_buffer->pan_gains.getWritePointer(RIGHT);
+            pan_block(pan_buffer, left_gains, right_gains, num_samples);
+            // const float multiplyer = id == FILTER_3 ? 1.5f : 1;
+            for (int sid = 0; sid != num_samples; ++sid)
+            {
+                const float output_sample = left_and_input_output_buffer[sid];
+#ifdef POLY
+                right_output_buffer[sid] =
+                    output_sample * left_gains[sid] *
+                    (calculate_tracking[id]
+                         ? env_tracking_buffer[sid] *
+                                   (1.0f - synth_data->keytrack_filter_volume_offset[id]) +
+                               synth_data->keytrack_filter_volume_offset[id]
+                         : 1);
+                left_and_input_output_buffer[sid] =
+                    output_sample * right_gains[sid] *
+                    (calculate_tracking[id]
+                         ? env_tracking_buffer[sid] *
+                                   (1.0f - synth_data->keytrack_filter_volume_offset[id]) +
+                               synth_data->keytrack_filter_volume_offset[id]
+                         : 1);
+#else
+                right_output_buffer[sid] = output_sample * left_gains[sid];
+                left_and_input_output_buffer[sid] = output_sample * right_gains[sid];
+#endif
+            }
+
+            // VISUALIZE
+            if (Monique_Ui_AmpPainter *const amp_painter = synth_data->audio_processor->amp_painter)
+            {
+                amp_painter->add_filter_env(id, amp_mix, num_samples);
+                amp_painter->add_filter(id, right_output_buffer, left_and_input_output_buffer,
+                                        num_samples);
+            }
+        }
+#ifdef POLY
+        else // NOTE just a reduced copy of the function before
+        {
+            float *const left_and_input_output_buffer =
+                data_buffer->filter_output_samples_l_r.getWritePointer(id);
+            const bool calculate_tracking[SUM_FILTERS] = {synth_data->keytrack_filter_volume[0],
+                                                          synth_data->keytrack_filter_volume[1],
+                                                          synth_data->keytrack_filter_volume[2]};
+            const float *const env_tracking_buffer =
+                data_buffer->filter_env_tracking.getReadPointer(id);
+            // const float multiplyer = id == FILTER_3 ? 1.5f : 1;
+            for (int sid = 0; sid != num_samples; ++sid)
+            {
+                const float output_sample = left_and_input_output_buffer[sid];
+                left_and_input_output_buffer[sid] =
+                    output_sample *
+                    (calculate_tracking[id]
+                         ? env_tracking_buffer[sid] *
+                                   (1.0f - synth_data->keytrack_filter_volume_offset[id]) +
+                               synth_data->keytrack_filter_volume_offset[id]
+                         : 1);
+            }
+
+            // VISUALIZE
+            if (Monique_Ui_AmpPainter *const amp_painter = synth_data->audio_processor->amp_painter)
+            {
+                amp_painter->add_filter_env(id, amp_mix, num_samples);
+                amp_painter->add_filter(id, left_and_input_output_buffer,
+                                        left_and_input_output_buffer, num_samples);
+            }
+        }
+#endif
+
+        // COLLECT THE FINAL OUTPUT
+        if (id == FILTER_3)
+        {
             if (synth_data->is_stereo)
             {
-                float result_r = 0;
-                for (int i = 0; i != SUM_DELAY_LINES; ++i)
+                float *const master_left_output_buffer =
+                    data_buffer->filter_stereo_output_samples.getWritePointer(LEFT);
+                float *const master_right_output_buffer =
+                    data_buffer->filter_stereo_output_samples.getWritePointer(RIGHT);
+                const float *const left_output_buffer_flt1 =
+                    data_buffer->filter_output_samples_l_r.getReadPointer(0);
+                const float *const right_output_buffer_flt1 =
+                    data_buffer->filter_output_samples_l_r.getReadPointer(SUM_FILTERS);
+                const float *const left_output_buffer_flt2 =
+                    data_buffer->filter_output_samples_l_r.getReadPointer(1);
+                const float *const right_output_buffer_flt2 =
+                    data_buffer->filter_output_samples_l_r.getReadPointer(SUM_FILTERS + 1);
+                const float *const left_output_buffer_flt3 =
+                    data_buffer->filter_output_samples_l_r.getReadPointer(2);
+                const float *const right_output_buffer_flt3 =
+                    data_buffer->filter_output_samples_l_r.getReadPointer(SUM_FILTERS + 2);
+                const float *const smoothed_distortion =
+                    synth_data->distortion_smoother.get_smoothed_value_buffer();
+                const float *const smoothed_fx_bypass_buffer =
+                    synth_data->effect_bypass_smoother.get_smoothed_value_buffer();
+
+                const float *const left_outputs[SUM_FILTERS] = {
+                    left_output_buffer_flt1, left_output_buffer_flt2, left_output_buffer_flt3};
+                const float *const right_outputs[SUM_FILTERS] = {
+                    right_output_buffer_flt1, right_output_buffer_flt2, right_output_buffer_flt3};
+                sample_mix_block(master_left_output_buffer, left_outputs, SUM_FILTERS, num_samples);
+                sample_mix_block(master_right_output_buffer, right_outputs, SUM_FILTERS,
+                                 num_samples);
+                for (int sid = 0; sid != num_samples; ++sid)
                 {
-                    float delay = (power * 0.9 + 0.1) * e2_samples * amps[i];
-                    float float_index = float(index) - delay + 1;
-                    CHECK_MAKE_INDEX_VALID(float_index, buffer_size)
-
-                    const int index_1 = std::floor(float_index);
-                    int index_2 = index_1 + 1;
-                    CHECK_MAKE_INDEX_VALID_upper_only(index_2, buffer_size) const float delta =
-                        float_index - index_1;
-
-                    result_r += (current_right_buffer[index_1] * (1.0f - delta) +
-                                 current_right_buffer[index_2] * delta) /
-                                (i + 2);
+                    const float left = master_left_output_buffer[sid];
+                    const float right = master_right_output_buffer[sid];
+                    const float left_add = left_output_buffer_flt1[sid] +
+                                           left_output_buffer_flt2[sid] +
+                                           left_output_buffer_flt3[sid];
+                    const float right_add = right_output_buffer_flt1[sid] +
+                                            right_output_buffer_flt2[sid] +
+                                            right_output_buffer_flt3[sid];
+                    const float distortion =
+                        smoothed_distortion[sid] * smoothed_fx_bypass_buffer[sid];
+
+                    master_left_output_buffer[sid] =
+                        left * (1.0f - distortion) +
+                        1.33f * soft_clipping(left_add * 10) * (distortion);
+                    master_right_output_buffer[sid] =
+                        right * (1.0f - distortion) +
+                        1.33f * soft_clipping(right_add * 10) * (distortion);
                 }
+            }
+            else // NOTE just a reduced copy of the function before
+            {
+                float *const master_left_output_buffer =
+                    data_buffer->filter_stereo_output_samples.getWritePointer(LEFT);
+                const float *const left_output_buffer_flt1 =
+                    data_buffer->filter_output_samples_l_r.getReadPointer(0);
+                const float *const left_output_buffer_flt2 =
+                    data_buffer->filter_output_samples_l_r.getReadPointer(1);
+                const float *const left_output_buffer_flt3 =
+                    data_buffer->filter_output_samples_l_r.getReadPointer(2);
+                const float *const smoothed_distortion =
+                    synth_data->distortion_smoother.get_smoothed_value_buffer();
+                const float *const smoothed_fx_bypass_buffer =
+                    synth_data->effect_bypass_smoother.get_smoothed_value_buffer();
+
+                const float *const left_outputs[SUM_FILTERS] = {
+                    left_output_buffer_flt1, left_output_buffer_flt2, left_output_buffer_flt3};
+                sample_mix_block(master_left_output_buffer, left_outputs, SUM_FILTERS, num_samples);
+                for (int sid = 0; sid != num_samples; ++sid)
                 {
-                    current_right_buffer[index] =
-                        sample_mix(right_in_[sid], result_r * power * right_pan(pan, cos_lookup));
-                    right_out_[sid] = right_in_[sid] * fade_in + result_r * fade_effect;
+                    const float left = master_left_output_buffer[sid];
+                    const float left_add = left_output_buffer_flt1[sid] +
+                                           left_output_buffer_flt2[sid] +
+                                           left_output_buffer_flt3[sid];
+                    const float distortion =
+                        smoothed_distortion[sid] * smoothed_fx_bypass_buffer[sid];
+
+                    master_left_output_buffer[sid] =
+                        left * (1.0f - distortion) +
+                        1.33f * soft_clipping(left_add * 10) * (distortion);
                 }
             }
-
-            index = (index + 1) % buffer_size;
         }
     }
 
-    inline void reset() noexcept { data_buffer.clear(); }
-    //==============================================================================
-    COLD void sample_rate_or_block_changed() noexcept override
-    {
-        buffer_size = sample_rate / 82.41;
-        data_buffer.setSize(buffer_size, false);
-        data_buffer.clear();
-
-        current_left_buffer = data_buffer.getWritePointer(LEFT);
-        current_right_buffer = data_buffer.getWritePointer(RIGHT);
-    }
-
   public:
     //==============================================================================
-    COLD mono_Chorus(RuntimeNotifyer *const notifyer_, MoniqueSynthData *const synth_data_) noexcept
-        : RuntimeListener(notifyer_),
-
-          synth_data(synth_data_),
-
-          chorus_data(synth_data_->chorus_data.get()), osc_1(notifyer_, synth_data_->sine_lookup),
-          osc_2(notifyer_, synth_data_->sine_lookup), osc_3(notifyer_, synth_data_->sine_lookup),
-          osc_4(notifyer_, synth_data_->sine_lookup),
+    COLD FilterProcessor(RuntimeNotifyer *const notifyer_, const MoniqueSynthData *synth_data_,
+                         int id_, const float *const sine_lookup_, const float *const cos_lookup_,
+                         const float *const exp_lookup_) noexcept
+        : env(new ENV(notifyer_, synth_data_, synth_data_->filter_datas[id_]->env_data,
+                      sine_lookup_, cos_lookup_, exp_lookup_)),
+          input_envs(),
 
-          osc_5(notifyer_, synth_data_->sine_lookup), buffer_size(1), index(0),
+          id(id_),
 
-          data_buffer(buffer_size),
+          synth_data(synth_data_), filter_data(synth_data_->filter_datas[id_]),
+          data_buffer(synth_data_->data_buffer),
 
-          sin_lookup(synth_data_->sine_lookup), cos_lookup(synth_data_->cos_lookup)
+          stage(), last_resonance(0), last_cutoff(0), last_distortion(0)
     {
-        sample_rate_or_block_changed();
-        osc_1.set_frequency(0.4);
-        osc_2.set_frequency(0.6);
-        osc_3.set_frequency(0.55);
-        osc_4.set_frequency(0.5);
-        osc_5.set_frequency(0.45);
+        for (int i = 0; i != SUM_INPUTS_PER_FILTER; ++i)
+        {
+            double_filter.add(new DoubleAnalogFilter(notifyer_));
+
+            ENVData *input_env_data(synth_data_->filter_datas[id_]->input_envs[i]);
+            input_env_datas.add(input_env_data);
+            input_envs.add(new ENV(notifyer_, synth_data_, input_env_data, sine_lookup_,
+                                   cos_lookup_, exp_lookup_));
+        }
     }
-    COLD ~mono_Chorus() noexcept {}
+    COLD ~FilterProcessor() noexcept {}
 
-    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(mono_Chorus)
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(FilterProcessor)
 };
 
 //==============================================================================
@@ -4327,739 +2434,379 @@ class mono_Chorus : public RuntimeListener
 //==============================================================================
 //==============================================================================
 //==============================================================================
-class mono_Delay : public RuntimeListener
+//==============================================================================
+//==============================================================================
+//==============================================================================
+static inline float get_low_pass_band_frequency(int band_id_, double sample_rate_) noexcept
 {
-    const MoniqueSynthData *synth_data;
-    RuntimeInfo *info;
-
-    double last_bmp_in;
-
-    int reflexion_write_index;
-    int last_in_reflexion_size;
-    int reflexion;
-    int current_reflexion;
-    int reflexion_buffer_size;
-    int current_reflexion_buffer_size;
-    mono_AudioSampleBuffer<2> reflexion_buffer;
-    float *active_left_reflexion_buffer;
-    float *active_right_reflexion_buffer;
-
-    int record_index;
-    int last_in_record_size;
-    int record_buffer_size;
-    int real_record_buffer_size;
-    int num_records_to_write;
-    mono_AudioSampleBuffer<2> record_buffer;
-    float *active_left_record_buffer;
-    float *active_right_record_buffer;
-    bool force_clear;
-
-    LinearSmootherMinMax<0, 1> record_switch_smoother;
-
-    const float *const sin_lookup;
-    const float *const cos_lookup;
-
-  public:
-    //==============================================================================
-    inline void set_reflexion_size(int reflexion_in_size_, int record_buffer_size_,
-                                   int glide_time_in_ms_, double bpm_) noexcept
+    switch (band_id_)
     {
-        // SETUP THE REFLEXION BUFFER
-        if (bpm_ < 20)
-        {
-            return;
-        }
+    case 0:
+        return 82.41;
+    case 1:
+        return 164.81;
+    case 2:
+        return 329.63;
+    case 3:
+        return 659.25;
+    case 4:
+        return 1318.51;
+    case 5:
+        return 2637.02;
+    default:
+        // return 2637.02;
+        return sample_rate_ / 2;
+    }
+}
+static inline float get_high_pass_band_frequency(int band_id_) noexcept
+{
+    switch (band_id_)
+    {
+    case 0:
+        return 20.60;
+    case 1:
+        return 82.41;
+    case 2:
+        return 164.81;
+    case 3:
+        return 329.63;
+    case 4:
+        return 659.25;
+    case 5:
+        return 1318.51;
+    default:
+        return 2637.02;
+    }
+}
+class EQProcessor : public RuntimeListener
+{
+    friend class EQProcessorStereo;
 
-        bool bpm_changed = last_bmp_in != bpm_;
-        last_bmp_in = bpm_;
+    float frequency_low_pass[SUM_EQ_BANDS];
+    float frequency_high_pass[SUM_EQ_BANDS];
 
-        if (bpm_changed || last_in_reflexion_size != reflexion_in_size_)
-        {
-            last_in_reflexion_size = reflexion_in_size_;
-            update_reflexion_stuff(bpm_);
-        }
-        if (bpm_changed || last_in_record_size != record_buffer_size_)
-        {
-            last_in_record_size = record_buffer_size_;
-            update_record_stuff(bpm_);
-        }
+    juce::OwnedArray<AnalogFilter> filters;
+    juce::IIRFilter high_pass_filters[SUM_EQ_BANDS];
+    TailBypass band_tails[SUM_EQ_BANDS];
 
-        // TODO ATTENTION FIX, do not clear! -> but if not crash on sample rate changes
-        /*
-        if( bpm_changed )
-        {
-            reflexion_write_index = 0;
-            current_reflexion = reflexion;
-            reflexion_buffer.clear();
-            record_buffer.clear();
-            record_switch_smoother.set_value(0);
-            record_switch_smoother.reset_glide_countdown();
-            record_switch_smoother.reset(sample_rate,glide_time_in_ms_);
-        }
-        */
+    friend class mono_ParameterOwnerStore;
 
-        record_switch_smoother.reset_coefficients(sample_rate, juce::jmax(200, glide_time_in_ms_));
-    }
+    const MoniqueSynthData *const synth_data;
+    const EQData *const eq_data;
+    DataBuffer *const data_buffer;
 
+  public:
     //==============================================================================
-  private:
-    inline void update_reflexion_stuff(double bpm_) noexcept
+    inline void reset() noexcept
     {
-        // CALCULATE THE NEEDED SIZE
-        {
-            const double speed_multi = delay_multi(last_in_reflexion_size);
-            const double bars_per_sec = bpm_ / 4 / 60;
-            const double samples_per_bar = (1.0f / bars_per_sec) * sample_rate;
-            reflexion_buffer_size = floor(samples_per_bar);
-            reflexion = samples_per_bar * speed_multi;
-        }
-        if (reflexion_buffer.get_size() < reflexion_buffer_size)
+        for (int band_id = 0; band_id != SUM_EQ_BANDS; ++band_id)
         {
-            reflexion_buffer.setSize(reflexion_buffer_size, true);
-            active_left_reflexion_buffer = reflexion_buffer.getWritePointer(LEFT);
-            active_right_reflexion_buffer = reflexion_buffer.getWritePointer(RIGHT);
+            filters[band_id]->reset();
+            high_pass_filters[band_id].reset();
         }
     }
-    inline void update_record_stuff(double bpm_) noexcept
+
+    void sample_rate_or_block_changed() noexcept override
     {
-        // CALCULATE THE NEEDED SIZE
-        {
-            num_records_to_write = delay_multi(last_in_record_size); // 1, 2 or 4
-            const double bars_per_sec = bpm_ / 4 / 60;
-            const double samples_per_bar = (1.0f / bars_per_sec) * sample_rate;
-            real_record_buffer_size = samples_per_bar * 4;
-            record_buffer_size = samples_per_bar;
-            // TODO change the record index only on zero
-        }
-        if (record_buffer.get_size() < real_record_buffer_size)
+        reset();
+        for (int band_id = 0; band_id != SUM_EQ_BANDS; ++band_id)
         {
-            record_buffer.setSize(real_record_buffer_size, true);
-            active_left_record_buffer = record_buffer.getWritePointer(LEFT);
-            active_right_record_buffer = record_buffer.getWritePointer(RIGHT);
+            frequency_low_pass[band_id] = get_low_pass_band_frequency(band_id, sample_rate);
+            high_pass_filters[band_id].setCoefficients(
+                juce::IIRCoefficients::makeHighPass(sample_rate, frequency_high_pass[band_id]));
         }
     }
 
-  private:
     //==============================================================================
-    inline int update_get_reflexion_read_index() noexcept
+    inline void process(float *io_buffer_, int num_samples_) noexcept
     {
-        if (current_reflexion < reflexion)
-        {
-            current_reflexion += 2;
-            if (current_reflexion > reflexion)
-            {
-                current_reflexion = reflexion;
-            }
-        }
-        else if (current_reflexion > reflexion)
-        {
-            --current_reflexion;
-        }
-
-        if (current_reflexion_buffer_size < reflexion_buffer_size)
         {
-            current_reflexion_buffer_size += 2;
-            if (current_reflexion_buffer_size > reflexion_buffer_size)
+            struct BandExecuter
             {
-                current_reflexion_buffer_size = reflexion_buffer_size;
-            }
-        }
-        else if (current_reflexion_buffer_size > reflexion_buffer_size)
-        {
-            --current_reflexion_buffer_size;
-        }
-
-        int read_index = reflexion_write_index - current_reflexion;
-        while (read_index < 0)
-        {
-            read_index += current_reflexion_buffer_size;
-        }
-        return read_index;
-    }
+                const int band_id;
 
-  public:
-    //==============================================================================
-    inline void process(float *const io_l, float *const io_r, const float *smoothed_power_,
-                        const float *smoothed_pan_buffer_, const float *record_release_buffer_,
-                        bool record_, const int num_samples_) noexcept
-    {
-        // PREPARE RECORDING
-        record_ = force_clear ? false : record_;
-        if (!record_)
-        {
-            record_switch_smoother.set_value(false);
-            record_switch_smoother.reset_glide_countdown();
-        }
+                const int num_samples_;
+                const float *const smoothed_shape_buffer;
 
-        // CURRENT INPUT AND REFLEXION OF USER SIZE
-        if (synth_data->is_stereo)
-        {
-            for (int sid = 0; sid != num_samples_; ++sid)
-            {
-                // REFLEXION AND INPUT
-                const int reflexion_read_index = update_get_reflexion_read_index();
+                const float filter_frequency;
+                juce::IIRFilter &high_pass_filter;
+                AnalogFilter &filter;
 
-                const float left_reflexion_and_input_mix =
-                    sample_mix(active_left_reflexion_buffer[reflexion_read_index], io_l[sid]);
-                const float right_reflexion_and_input_mix =
-                    sample_mix(active_right_reflexion_buffer[reflexion_read_index], io_r[sid]);
-                {
-                    const float pan = smoothed_pan_buffer_[sid];
-                    const float power = smoothed_power_[sid];
-
-                    const float left = left_pan(pan, sin_lookup);
-                    const float right = right_pan(pan, cos_lookup);
-                    // SWAPPED L AND R HERE - Must be wrong somethere else
-                    active_left_reflexion_buffer[reflexion_write_index] =
-                        left_reflexion_and_input_mix * power * right;
-                    active_right_reflexion_buffer[reflexion_write_index] =
-                        right_reflexion_and_input_mix * power * left;
-                }
+                const float *const filter_in_samples;
+                float *const band_out_buffer;
+                const float *const env_buffer;
 
-                // RECORD AND MIX BEFORE
+                inline void exec() noexcept { exec_default(); }
+                /*
+inline void exec_first() noexcept
+{
+    // PROCESS
+    for( int sid = 0 ; sid != num_samples_ ; ++sid )
+    {
+        const float shape = smoothed_shape_buffer[sid];
+        const float amp = env_buffer[sid];
+        const float in = filter_in_samples[sid] * amp;
+        filter.update_with_fixed_cutoff( shape*0.8f, filter_frequency );
+        float output = filter.processLowResonance(in);
+        band_out_buffer[sid] = output*4;
+    }
+}
+                */
+                inline void exec_default() noexcept
                 {
-                    float record_power = 0;
-                    if (record_)
-                    {
-                        record_power = record_switch_smoother.glide_tick(true);
-                    }
-                    else if (!record_switch_smoother.is_up_to_date())
+                    // PROCESS
+                    for (int sid = 0; sid != num_samples_; ++sid)
                     {
-                        record_power = record_switch_smoother.tick();
+                        const float shape = smoothed_shape_buffer[sid];
+                        const float amp = env_buffer[sid];
+                        const float in = filter_in_samples[sid] * amp;
+                        filter.update_with_fixed_cutoff(shape * 0.8f, filter_frequency);
+                        float output =
+                            high_pass_filter.processSingleSampleRaw(filter.processLowResonance(in));
+                        band_out_buffer[sid] = output * 4;
                     }
+                }
+                /*
+inline void exec_last() noexcept
+{
+    // PROCESS
+    for( int sid = 0 ; sid != num_samples_ ; ++sid )
+    {
+        const float shape = smoothed_shape_buffer[sid];
+        const float amp = env_buffer[sid];
+        const float in = filter_in_samples[sid] * amp;
+        filter.update_with_fixed_cutoff( shape*0.8f, filter_frequency );
+        float output = high_pass_filter.processSingleSampleRaw ( filter.processHighResonance(in) );
+        band_out_buffer[sid] = output*1.5;
+    }
+}
+                */
+                BandExecuter(EQProcessor *const processor_, float *in_buffer_, int num_samples__,
+                             int band_id_) noexcept
+                    : band_id(band_id_),
 
-                    const float left_record = active_left_record_buffer[record_index];
-                    const float right_record = active_right_record_buffer[record_index];
-                    if (record_power > 0)
-                    {
-                        const float record_release = record_release_buffer_[sid];
-                        const float left_record_feedback =
-                            left_reflexion_and_input_mix * record_power;
-                        const float right_record_feedback =
-                            right_reflexion_and_input_mix * record_power;
-                        if (num_records_to_write > 2)
-                        {
-                            active_left_record_buffer[record_index] =
-                                sample_mix(left_record, left_record_feedback) * record_release;
-                            active_right_record_buffer[record_index] =
-                                sample_mix(right_record, right_record_feedback) * record_release;
-                        }
-                        else if (num_records_to_write == 1)
-                        {
-                            const int record_index_1 = record_index;
-                            int record_index_2 = record_index_1 + record_buffer_size;
-                            if (record_index_2 >= real_record_buffer_size)
-                            {
-                                record_index_2 -= real_record_buffer_size;
-                            }
-                            int record_index_3 = record_index_2 + record_buffer_size;
-                            if (record_index_3 >= real_record_buffer_size)
-                            {
-                                record_index_3 -= real_record_buffer_size;
-                            }
-                            int record_index_4 = record_index_3 + record_buffer_size;
-                            if (record_index_4 >= real_record_buffer_size)
-                            {
-                                record_index_4 -= real_record_buffer_size;
-                            }
-
-                            active_left_record_buffer[record_index_1] =
-                                sample_mix(left_record, left_record_feedback) * record_release;
-                            active_right_record_buffer[record_index_1] =
-                                sample_mix(right_record, right_record_feedback) * record_release;
-                            active_left_record_buffer[record_index_2] =
-                                sample_mix(active_left_record_buffer[record_index_2],
-                                           left_record_feedback) *
-                                record_release;
-                            active_right_record_buffer[record_index_2] =
-                                sample_mix(active_right_record_buffer[record_index_2],
-                                           right_record_feedback) *
-                                record_release;
-                            active_left_record_buffer[record_index_3] =
-                                sample_mix(active_left_record_buffer[record_index_3],
-                                           left_record_feedback) *
-                                record_release;
-                            active_right_record_buffer[record_index_3] =
-                                sample_mix(active_right_record_buffer[record_index_3],
-                                           right_record_feedback) *
-                                record_release;
-                            active_left_record_buffer[record_index_4] =
-                                sample_mix(active_left_record_buffer[record_index_4],
-                                           left_record_feedback) *
-                                record_release;
-                            active_right_record_buffer[record_index_4] =
-                                sample_mix(active_right_record_buffer[record_index_4],
-                                           right_record_feedback) *
-                                record_release;
-                        }
-                        else // if( num_records_to_write == 2 )
-                        {
-                            int record_index_2 = record_index + record_buffer_size * 2;
-                            if (record_index_2 >= real_record_buffer_size)
-                            {
-                                record_index_2 -= real_record_buffer_size;
-                            }
-
-                            active_left_record_buffer[record_index] =
-                                sample_mix(left_record, left_record_feedback) * record_release;
-                            active_right_record_buffer[record_index] =
-                                sample_mix(right_record, right_record_feedback) * record_release;
-                            active_left_record_buffer[record_index_2] =
-                                sample_mix(active_left_record_buffer[record_index_2],
-                                           left_record_feedback) *
-                                record_release;
-                            active_right_record_buffer[record_index_2] =
-                                sample_mix(active_right_record_buffer[record_index_2],
-                                           right_record_feedback) *
-                                record_release;
-                        }
-                    }
-                    else if (force_clear)
-                    {
-                        record_buffer.clear();
-                        active_left_record_buffer = record_buffer.getWritePointer(LEFT);
-                        active_right_record_buffer = record_buffer.getWritePointer(RIGHT);
-                        force_clear = false;
-                    }
+                      num_samples_(num_samples__),
+                      smoothed_shape_buffer(
+                          processor_->synth_data->shape_smoother.get_smoothed_value_buffer()),
 
-                    io_l[sid] = sample_mix(left_record, left_reflexion_and_input_mix);
-                    io_r[sid] = sample_mix(right_record, right_reflexion_and_input_mix);
-                }
+                      filter_frequency(processor_->frequency_low_pass[band_id_]),
+                      high_pass_filter(processor_->high_pass_filters[band_id_]),
+                      filter(*processor_->filters.getUnchecked(band_id_)),
 
-                // UPDATE INDEX
+                      filter_in_samples(in_buffer_),
+                      band_out_buffer(
+                          processor_->data_buffer->band_out_buffers.getWritePointer(band_id_)),
+                      env_buffer(
+                          processor_->data_buffer->band_env_buffers.getWritePointer(band_id_))
                 {
-                    reflexion_write_index =
-                        (reflexion_write_index + 1) % current_reflexion_buffer_size;
-                    record_index = (record_index + 1) % real_record_buffer_size;
                 }
-            }
-        }
-        else // NOTE just a reduced copy of the function before
-        {
-            for (int sid = 0; sid != num_samples_; ++sid)
+            };
+
+            // A BAND WITHOUT INPUT SLEEPS AS SOON AS ITS OUTPUT IS SILENT
+            const bool io_is_silent = is_silent_block(io_buffer_, num_samples_);
+            bool all_bands_skipped = io_is_silent;
+            for (int band_id = 0; band_id != SUM_EQ_BANDS; ++band_id)
             {
-                // REFLEXION AND INPUT
-                const int reflexion_read_index = update_get_reflexion_read_index();
-                const float left_reflexion_and_input_mix =
-                    sample_mix(active_left_reflexion_buffer[reflexion_read_index], io_l[sid]);
+                const bool input_is_silent =
+                    io_is_silent ||
+                    is_silent_block(data_buffer->band_env_buffers.getReadPointer(band_id),
+                                    num_samples_);
+                float *const band_out_buffer =
+                    data_buffer->band_out_buffers.getWritePointer(band_id);
+                if (band_tails[band_id].can_skip(input_is_silent))
                 {
-                    active_left_reflexion_buffer[reflexion_write_index] =
-                        left_reflexion_and_input_mix * smoothed_power_[sid];
+                    juce::FloatVectorOperations::clear(band_out_buffer, num_samples_);
+                    continue;
                 }
+                all_bands_skipped = false;
 
-                // RECORD AND MIX BEFORE
+                BandExecuter(this, io_buffer_, num_samples_, band_id).exec();
+                if (band_tails[band_id].settle(input_is_silent,
+                                               is_silent_block(band_out_buffer, num_samples_), 0,
+                                               num_samples_))
                 {
-                    float record_power = 0;
-                    if (record_)
-                    {
-                        record_power = record_switch_smoother.glide_tick(true);
-                    }
-                    else if (!record_switch_smoother.is_up_to_date())
-                    {
-                        record_power = record_switch_smoother.tick();
-                    }
+                    filters[band_id]->reset();
+                    high_pass_filters[band_id].reset();
+                }
+            }
 
-                    const float left_record = active_left_record_buffer[record_index];
-                    if (record_power > 0)
-                    {
-                        const float record_release = record_release_buffer_[sid];
-                        const float left_record_feedback =
-                            left_reflexion_and_input_mix * record_power;
-                        if (num_records_to_write > 2)
-                        {
-                            active_left_record_buffer[record_index] =
-                                sample_mix(left_record, left_record_feedback) * record_release;
-                        }
-                        else if (num_records_to_write == 1)
-                        {
-                            const int record_index_1 = record_index;
-                            int record_index_2 = record_index_1 + record_buffer_size;
-                            if (record_index_2 >= real_record_buffer_size)
-                            {
-                                record_index_2 -= real_record_buffer_size;
-                            }
-                            int record_index_3 = record_index_2 + record_buffer_size;
-                            if (record_index_3 >= real_record_buffer_size)
-                            {
-                                record_index_3 -= real_record_buffer_size;
-                            }
-                            int record_index_4 = record_index_3 + record_buffer_size;
-                            if (record_index_4 >= real_record_buffer_size)
-                            {
-                                record_index_4 -= real_record_buffer_size;
-                            }
+            // NOTHING TO MIX, THE SILENT INPUT STAYS AS IT IS
+            if (all_bands_skipped)
+            {
+                return;
+            }
+        }
+        // EO MULTITHREADED
 
-                            active_left_record_buffer[record_index_1] =
-                                sample_mix(left_record, left_record_feedback) * record_release;
-                            active_left_record_buffer[record_index_2] =
-                                sample_mix(active_left_record_buffer[record_index_2],
-                                           left_record_feedback) *
-                                record_release;
-                            active_left_record_buffer[record_index_3] =
-                                sample_mix(active_left_record_buffer[record_index_3],
-                                           left_record_feedback) *
-                                record_release;
-                            active_left_record_buffer[record_index_4] =
-                                sample_mix(active_left_record_buffer[record_index_4],
-                                           left_record_feedback) *
-                                record_release;
-                        }
-                        else // if( num_records_to_write == 2 )
-                        {
-                            int record_index_2 = record_index + record_buffer_size * 2;
-                            if (record_index_2 >= real_record_buffer_size)
-                            {
-                                record_index_2 -= real_record_buffer_size;
-                            }
+        // FINAL MIX - SINGLE THREADED
+        {
+            // THE LOWEST BAND IS MIXED INVERTED, THE SUM REPLACES IT
+            float *const sum_buffer(data_buffer->band_out_buffers.getWritePointer(0));
+            juce::FloatVectorOperations::negate(sum_buffer, sum_buffer, num_samples_);
+            const float *const bands[SUM_EQ_BANDS] = {
+                data_buffer->band_out_buffers.getReadPointer(6),
+                data_buffer->band_out_buffers.getReadPointer(5),
+                data_buffer->band_out_buffers.getReadPointer(4),
+                data_buffer->band_out_buffers.getReadPointer(3),
+                data_buffer->band_out_buffers.getReadPointer(2),
+                data_buffer->band_out_buffers.getReadPointer(1),
+                sum_buffer};
+            sample_mix_block(sum_buffer, bands, SUM_EQ_BANDS, num_samples_);
 
-                            active_left_record_buffer[record_index] =
-                                sample_mix(left_record, left_record_feedback) * record_release;
-                            active_left_record_buffer[record_index_2] =
-                                sample_mix(active_left_record_buffer[record_index_2],
-                                           left_record_feedback) *
-                                record_release;
-                        }
-                    }
-                    else if (force_clear)
-                    {
-                        record_buffer.clear();
-                        active_left_record_buffer = record_buffer.getWritePointer(LEFT);
-                        force_clear = false;
-                    }
+            // const float* const smoothed_distortion =
+            // synth_data->final_clipping_smoother.get_smoothed_modulated_value_buffer() ;
+            const float *const smoothed_distortion =
+                synth_data->distortion_smoother.get_smoothed_value_buffer();
+            const float *const smoothed_fx_bypass_buffer =
+                synth_data->effect_bypass_smoother.get_smoothed_value_buffer();
+            const float *const smoothed_bypass =
+                eq_data->bypass_smoother.get_smoothed_value_buffer();
+            for (int sid = 0; sid != num_samples_; ++sid)
+            {
+                const float distortion = smoothed_distortion[sid] * smoothed_fx_bypass_buffer[sid];
+                const float bypass = smoothed_bypass[sid];
+                if (bypass > 0)
+                {
+                    float sum = sum_buffer[sid];
 
-                    io_l[sid] = sample_mix(left_record, left_reflexion_and_input_mix);
+                    // MONO_SNAP_TO_ZERO(sum)
+                    float mix = sum * bypass + io_buffer_[sid] * (1.0f - bypass);
+                    io_buffer_[sid] =
+                        mix * (1.0f - distortion) + (std::atan(mix * 10) * 0.7f) * distortion;
+                    // io_buffer_[sid] = soft_clipp_greater_1_2(sample_mix(mix*(1.0f-distortion),
+                    // sample_mix( mix, mix )*distortion));
                 }
-
-                // UPDATE INDEX
+                else
                 {
-                    reflexion_write_index =
-                        (reflexion_write_index + 1) % current_reflexion_buffer_size;
-                    record_index = (record_index + 1) % real_record_buffer_size;
+                    io_buffer_[sid] = io_buffer_[sid] * (1.0f - distortion) +
+                                      (std::atan(io_buffer_[sid] * 10) * 0.7f) * distortion;
                 }
             }
+            soft_clipp_greater_1_2_block(io_buffer_, io_buffer_, num_samples_,
+                                         synth_data->atan_accuracy);
         }
     }
 
-    //==============================================================================
-    inline void reset() noexcept { sample_rate_or_block_changed(); }
-
-    //==============================================================================
-    inline void clear_record_buffer() noexcept
-    {
-        force_clear = true;
-        active_left_record_buffer = record_buffer.getWritePointer(LEFT);
-        active_right_record_buffer = record_buffer.getWritePointer(RIGHT);
-    }
-
-    inline int get_max_duration() const noexcept { return real_record_buffer_size; }
-
-  private:
-    //==============================================================================
-    COLD void sample_rate_or_block_changed() noexcept override
-    {
-        update_record_stuff(last_bmp_in);
-        update_reflexion_stuff(last_bmp_in);
-    }
-
   public:
     //==============================================================================
-    COLD mono_Delay(RuntimeNotifyer *notifyer_, MoniqueSynthData *synth_data_) noexcept
+    COLD EQProcessor(RuntimeNotifyer *const notifyer_, MoniqueSynthData *synth_data_) noexcept
         : RuntimeListener(notifyer_),
 
-          synth_data(synth_data_),
-
-          last_bmp_in(20),
-
-          reflexion_write_index(0), last_in_reflexion_size(0), reflexion(0), current_reflexion(0),
-          reflexion_buffer_size(1), current_reflexion_buffer_size(1),
-          reflexion_buffer(reflexion_buffer_size),
-          active_left_reflexion_buffer(reflexion_buffer.getWritePointer(LEFT)),
-          active_right_reflexion_buffer(reflexion_buffer.getWritePointer(RIGHT)),
-
-          record_index(0), last_in_record_size(0), record_buffer_size(1),
-          real_record_buffer_size(record_buffer_size), num_records_to_write(1),
-          record_buffer(real_record_buffer_size),
-          active_left_record_buffer(record_buffer.getWritePointer(LEFT)),
-          active_right_record_buffer(record_buffer.getWritePointer(RIGHT)), force_clear(false),
+          synth_data(synth_data_), eq_data(synth_data_->eq_data.get()),
+          data_buffer(synth_data_->data_buffer)
+    {
+#ifdef JUCE_DEBUG
+        std::cout << "MONIQUE: init EQ L OR R" << std::endl;
+#endif
 
-          record_switch_smoother(),
+        for (int band_id = 0; band_id != SUM_EQ_BANDS; ++band_id)
+        {
+            filters.add(new AnalogFilter(notifyer_));
 
-          sin_lookup(synth_data_->sine_lookup), cos_lookup(synth_data_->sine_lookup)
-    {
+            frequency_low_pass[band_id] = get_low_pass_band_frequency(band_id, sample_rate);
+            frequency_high_pass[band_id] = get_high_pass_band_frequency(band_id);
+        }
         sample_rate_or_block_changed();
-        record_switch_smoother.set_value(0);
     }
-    COLD ~mono_Delay() noexcept {}
+    COLD ~EQProcessor() noexcept {}
 
-    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(mono_Delay)
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(EQProcessor)
 };
 
 //==============================================================================
 //==============================================================================
 //==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-class CombFilter
+class EQProcessorStereo
 {
-    juce::HeapBlock<float> buffer;
-    float last;
-    int bufferSize, bufferIndex;
+    MoniqueSynthData *const synth_data;
 
-  public:
-    //==============================================================================
-    inline float process(const float input, const float feedbackLevel) noexcept
-    {
-#define REVERB_DAMP 0
-        last = buffer[bufferIndex];
-        // last = (output * (1.0f - REVERB_DAMP)) + (last * REVERB_DAMP);
-        // JUCE_UNDENORMALISE (last);
+    EQProcessor *const left_processor;
+    EQProcessor *const right_processor;
 
-        float temp = input + (last * feedbackLevel);
-        JUCE_UNDENORMALISE(temp);
-        buffer[bufferIndex] = temp;
-        bufferIndex = (bufferIndex + 1) % bufferSize;
+    EQData *const eq_data;
+    DataBuffer *const data_buffer;
 
-        return last;
-    }
+  public:
+    juce::OwnedArray<ENV> envs;
 
+  public:
     //==============================================================================
-    COLD void setSize(const int size)
+    inline void start_attack() noexcept
     {
-        if (size != bufferSize)
+        for (int band_id = 0; band_id != SUM_EQ_BANDS; ++band_id)
         {
-            bufferIndex = 0;
-            buffer.malloc((size_t)size);
-            bufferSize = size;
+            envs.getUnchecked(band_id)->start_attack();
         }
-
-        clear();
-    }
-    COLD void clear() noexcept
-    {
-        last = 0;
-        buffer.clear((size_t)bufferSize);
     }
-
-  public:
-    //==============================================================================
-    COLD CombFilter() noexcept : last(0), bufferSize(0), bufferIndex(0) {}
-    COLD ~CombFilter() noexcept {}
-
-    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(CombFilter)
-};
-
-//==============================================================================
-//==============================================================================
-//==============================================================================
-class LinearSmoothedValue
-{
-    float currentValue, target, step, lastValue;
-    int countdown, stepsToTarget;
-
-  public:
-    //==========================================================================
-    inline float getNextValue() noexcept
+    inline void start_release() noexcept
     {
-        if (countdown <= 0)
-        {
-            lastValue = target;
-        }
-        else
+        for (int band_id = 0; band_id != SUM_EQ_BANDS; ++band_id)
         {
-            --countdown;
-            currentValue += step;
-
-            lastValue = currentValue;
+            envs.getUnchecked(band_id)->set_to_release();
         }
-
-        return lastValue;
     }
-    //==========================================================================
-    inline float getLastValue() noexcept { return lastValue; }
-
-    inline void setValue(float newValue) noexcept
+    inline void reset() noexcept
     {
-        if (target != newValue)
+        for (int band_id = 0; band_id != SUM_EQ_BANDS; ++band_id)
         {
-            target = newValue;
-            countdown = stepsToTarget;
-
-            if (countdown <= 0)
-            {
-                currentValue = target;
-            }
-            else
-            {
-                step = (target - currentValue) / countdown;
-            }
+            envs.getUnchecked(band_id)->reset();
         }
+        left_processor->reset();
+        if (synth_data->is_stereo)
+            right_processor->reset();
     }
 
     //==============================================================================
-    COLD void reset(float sampleRate, float fadeLengthSeconds) noexcept
-    {
-        stepsToTarget = std::floor(fadeLengthSeconds * sampleRate);
-        currentValue = target;
-        countdown = 0;
-    }
-
-  public:
-    //==============================================================================
-    COLD LinearSmoothedValue() noexcept
-        : currentValue(0), target(0), step(0), lastValue(0), countdown(0), stepsToTarget(0)
-    {
-    }
-
-    COLD ~LinearSmoothedValue() noexcept {}
-
-    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(LinearSmoothedValue)
-};
-
-//==============================================================================
-//==============================================================================
-//==============================================================================
-class mono_Reverb;
-struct ReverbParameters
-{
-    float roomSize; /**< Room size, 0 to 1.0, where 1.0 is big, 0 is small. */
-    float wetLevel; /**< Wet level, 0 to 1.0 */
-    float dryLevel; /**< Dry level, 0 to 1.0 */
-    float width;    /**< mono_Reverb width, 0 to 1.0, where 1.0 is very wide. */
-
-  private:
-    //==============================================================================
-    friend class mono_Reverb;
-    COLD ReverbParameters() noexcept : roomSize(0.5f), wetLevel(0.33f), dryLevel(0.4f), width(1.0f)
-    {
-    }
-    COLD ~ReverbParameters() noexcept {}
-
-    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ReverbParameters)
-};
-
-//==============================================================================
-//==============================================================================
-//==============================================================================
-class mono_Reverb : RuntimeListener
-{
-    const bool left_or_right;
-
-    enum
-    {
-        numCombs = 8,
-        numAllPasses = 4
-    };
-
-    CombFilter comb[numCombs];
-    AllPassFilter allPass[numAllPasses];
-
-    ReverbParameters parameters;
-#define REVERB_GAIN 0.013f
-
-    float wetGain1, wetGain2, feedback; // dryGain,  feedback
-
-  public:
-    //==========================================================================
-    inline float processSingleSampleRaw(float in) noexcept
+    inline void process(int num_samples_) noexcept
     {
-        float out = 0;
-        {
-            const float input = in * REVERB_GAIN;
-            for (int j = 0; j != numCombs; ++j) // accumulate the comb filters in parallel
-            {
-                out += comb[j].process(input, feedback);
-            }
-        }
-        for (int j = 0; j != numAllPasses; ++j) // run the allpass filters in series
+        for (int band_id = 0; band_id != SUM_EQ_BANDS; ++band_id)
         {
-            out = allPass[j].process(out);
+            ENV *env(envs.getUnchecked(band_id));
+            eq_data->velocity_smoothers[band_id]->process_amp(
+                !eq_data->hold[band_id], synth_data->glide_motor_time, env,
+                data_buffer->band_env_buffers.getWritePointer(band_id), num_samples_);
         }
 
-        return out * wetGain1 + out * wetGain2 + in * parameters.dryLevel;
-    }
-
-    //==========================================================================
-    inline ReverbParameters &get_parameters() noexcept { return parameters; }
-    inline void update_parameters() noexcept
-    {
-#define ROOM_SCALE 1.0f
-#define WET_SCALE_FACTOR 3.0f
-#define DRY_SCALE_FACTOR 1.0f
-#define ROOM_SCALE_FACTOR (0.28f * ROOM_SCALE)
-#define ROOM_OFFSET (1.0f - 0.28f * ROOM_SCALE - 0.02f)
-        const float wet = parameters.wetLevel * WET_SCALE_FACTOR;
-        // dryGain.setValue (parameters.dryLevel * DRY_SCALE_FACTOR);
-        wetGain1 = 0.5f * wet * (1.0f + parameters.width);
-        wetGain2 = 0.5f * wet * (1.0f - parameters.width);
-        feedback = parameters.roomSize * ROOM_SCALE_FACTOR + ROOM_OFFSET;
-    }
-
-    //==============================================================================
-    COLD void sample_rate_or_block_changed() noexcept override
-    {
-        static const int combTunings[] = {1116, 1188, 1277, 1356,
-                                          1422, 1491, 1557, 1617}; // (at 44100Hz)
-        static const int allPassTunings[] = {556, 441, 341, 225};
-        const int stereoSpread = 23;
-        const int intSampleRate = (int)sample_rate;
+        left_processor->process(data_buffer->filter_stereo_output_samples.getWritePointer(LEFT),
+                                num_samples_);
+        if (synth_data->is_stereo)
+            right_processor->process(
+                data_buffer->filter_stereo_output_samples.getWritePointer(RIGHT), num_samples_);
 
-        for (int i = 0; i < numCombs; ++i)
-        {
-            if (left_or_right == LEFT)
-            {
-                comb[i].setSize((intSampleRate * combTunings[i] * ROOM_SCALE) / 44100);
-            }
-            else
-            {
-                comb[i].setSize(
-                    (intSampleRate * (combTunings[i] * ROOM_SCALE + stereoSpread * ROOM_SCALE)) /
-                    44100);
-            }
-        }
-        for (int i = 0; i < numAllPasses; ++i)
+        if (Monique_Ui_AmpPainter *const amp_painter = synth_data->audio_processor->amp_painter)
         {
-            if (left_or_right == LEFT)
-            {
-                allPass[i].setSize((intSampleRate * allPassTunings[i] * ROOM_SCALE) / 44100);
-            }
-            else
-            {
-                allPass[i].setSize(
-                    (intSampleRate * (allPassTunings[i] * ROOM_SCALE + stereoSpread * ROOM_SCALE)) /
-                    44100);
-            }
+            amp_painter->add_eq(data_buffer->filter_stereo_output_samples.getWritePointer(LEFT),
+                                num_samples_);
         }
     }
-    COLD void reset() noexcept
+
+  public:
+    //==========================================================================
+    COLD EQProcessorStereo(RuntimeNotifyer *const notifyer_, MoniqueSynthData *synth_data_,
+                           const float *const sine_lookup_, const float *const cos_lookup_,
+                           const float *const exp_lookup_) noexcept
+        : synth_data(synth_data_), left_processor(new EQProcessor(notifyer_, synth_data_)),
+          right_processor(new EQProcessor(notifyer_, synth_data_)),
+          eq_data(synth_data_->eq_data.get()), data_buffer(synth_data_->data_buffer)
     {
-        for (int i = 0; i < numCombs; ++i)
-        {
-            comb[i].clear();
-        }
+#ifdef JUCE_DEBUG
+        std::cout << "MONIQUE: init EQ" << std::endl;
+#endif
 
-        for (int i = 0; i < numAllPasses; ++i)
+        for (int band_id = 0; band_id != SUM_EQ_BANDS; ++band_id)
         {
-            allPass[i].clear();
+            envs.add(new ENV(notifyer_, synth_data_,
+                             synth_data_->eq_data->envs.getUnchecked(band_id), sine_lookup_,
+                             cos_lookup_, exp_lookup_));
         }
     }
-
-  public:
-    //==========================================================================
-    COLD mono_Reverb(RuntimeNotifyer *const notifyer_, bool left_or_right_) noexcept
-        : RuntimeListener(notifyer_), left_or_right(left_or_right_), wetGain1(0), wetGain2(0),
-          feedback(0)
+    COLD ~EQProcessorStereo() noexcept
     {
-        update_parameters();
-        sample_rate_or_block_changed();
+        delete right_processor;
+        delete left_processor;
     }
-    COLD ~mono_Reverb() noexcept {}
 
-    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(mono_Reverb)
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(EQProcessorStereo)
 };
 
 //==============================================================================
@@ -5129,9 +2876,6 @@ class FXProcessor
     const ReverbData *const reverb_data;
     ChorusData *const chorus_data;
 
-    const float *const sin_lookup;
-    const float *const cos_lookup;
-
   public:
     //==========================================================================
     inline void process(juce::AudioSampleBuffer &output_buffer_, const float *velocity_,
@@ -5155,6 +2899,7 @@ class FXProcessor
 
             // PREPARE
             {
+                MONIQUE_STAGE_SCOPE(synth_data->runtime_info->stage_timings, TIMING_FX_ENV);
                 float *const final_env_amp = data_buffer->final_env.getWritePointer();
                 final_env->process(final_env_amp, num_samples_);
 
@@ -5169,12 +2914,14 @@ class FXProcessor
 
             // STEREO CHORUS
             {
+                MONIQUE_STAGE_SCOPE(synth_data->runtime_info->stage_timings, TIMING_FX_CHORUS);
                 chorus.process(left_input_buffer, right_input_buffer, left_out_buffer,
                                right_out_buffer, num_samples_);
             }
 
             // DELAY
             {
+                MONIQUE_STAGE_SCOPE(synth_data->runtime_info->stage_timings, TIMING_FX_DELAY);
                 delay.set_reflexion_size(synth_data->delay_refexion, synth_data->delay_record_size,
                                          synth_data->glide_motor_time,
                                          is_standalone() ? synth_data->speed
@@ -5189,6 +2936,7 @@ class FXProcessor
 
             // REVERB
             {
+                MONIQUE_STAGE_SCOPE(synth_data->runtime_info->stage_timings, TIMING_FX_REVERB);
                 const float *const smoothed_pan_buffer(
                     reverb_data->pan_smoother.get_smoothed_value_buffer());
                 const float *const smoothed_bypass_buffer =
@@ -5200,54 +2948,45 @@ class FXProcessor
                     reverb_data->width_smoother.get_smoothed_value_buffer();
                 const float *const smoothed_dry_wet_mix_buffer =
                     reverb_data->dry_wet_mix_smoother.get_smoothed_value_buffer();
-                ReverbParameters &rever_params_l = reverb_l.get_parameters();
-                ReverbParameters &rever_params_r = reverb_r.get_parameters();
+                float *const left_gains = data_buffer->pan_gains.getWritePointer(LEFT);
+                float *const right_gains = data_buffer->pan_gains.getWritePointer(RIGHT);
+                pan_block(smoothed_pan_buffer, left_gains, right_gains, num_samples_);
+
+                // THE PARAMETERS ONCE FOR BOTH SIDES, THEN EACH SIDE AS A BLOCK
+                mono_ArenaBuffer<SUM_REVERB_BUFFERS> &reverb_buffers =
+                    data_buffer->reverb_buffers;
+                float *const reverb_out = reverb_buffers.getWritePointer(REVERB_OUTPUT);
+                mono_Reverb::calc_block_parameters(smoothed_room_buffer,
+                                                   smoothed_dry_wet_mix_buffer,
+                                                   smoothed_with_buffer, reverb_buffers,
+                                                   num_samples_);
+
+                reverb_l.process_block(left_out_buffer, reverb_out, reverb_buffers, num_samples_);
                 for (int sid = 0; sid != num_samples_; ++sid)
                 {
-                    {
-                        const float reverb_room = smoothed_room_buffer[sid];
-                        const float reverb_dry_wet_mix = 1.0f - smoothed_dry_wet_mix_buffer[sid];
-                        const float reverb_width = smoothed_with_buffer[sid];
-                        if (rever_params_l.roomSize != reverb_room ||
-                            rever_params_l.dryLevel != reverb_dry_wet_mix
-                            //|| rever_params_r.wetLevel != r_params.wetLevel
-                            || rever_params_l.width != reverb_width)
-                        {
-                            rever_params_l.roomSize = reverb_room;
-                            rever_params_l.dryLevel = reverb_dry_wet_mix;
-                            rever_params_l.wetLevel = 1.0f - reverb_dry_wet_mix;
-                            rever_params_l.width = reverb_width;
-
-                            rever_params_r.roomSize = rever_params_l.roomSize;
-                            rever_params_r.dryLevel = rever_params_l.dryLevel;
-                            rever_params_r.wetLevel = rever_params_l.wetLevel;
-                            rever_params_r.width = rever_params_l.width;
-
-                            reverb_l.update_parameters();
-                            reverb_r.update_parameters();
-                        }
+                    const float in_l = left_out_buffer[sid];
+                    const float left = left_gains[sid];
+                    const float bypass = smoothed_bypass_buffer[sid];
+                    left_out_buffer[sid] =
+                        sample_mix((reverb_out[sid] * left + in_l * (1.0f - left)) * bypass,
+                                   left_input_buffer[sid] * (1.0f - bypass));
+                }
 
-                        const float in_l = left_out_buffer[sid];
-                        const float in_r = right_out_buffer[sid];
-                        float sample_l = reverb_l.processSingleSampleRaw(in_l);
-                        float sample_r = reverb_r.processSingleSampleRaw(in_r);
-
-                        const float pan = smoothed_pan_buffer[sid];
-                        const float left = left_pan(pan, sin_lookup);
-                        const float right = right_pan(pan, cos_lookup);
-                        const float bypass = smoothed_bypass_buffer[sid];
-                        left_out_buffer[sid] =
-                            sample_mix((sample_l * left + in_l * (1.0f - left)) * bypass,
-                                       left_input_buffer[sid] * (1.0f - bypass));
-                        right_out_buffer[sid] =
-                            sample_mix((sample_r * right + in_r * (1.0f - right)) * bypass,
-                                       right_input_buffer[sid] * (1.0f - bypass));
-                    }
+                reverb_r.process_block(right_out_buffer, reverb_out, reverb_buffers, num_samples_);
+                for (int sid = 0; sid != num_samples_; ++sid)
+                {
+                    const float in_r = right_out_buffer[sid];
+                    const float right = right_gains[sid];
+                    const float bypass = smoothed_bypass_buffer[sid];
+                    right_out_buffer[sid] =
+                        sample_mix((reverb_out[sid] * right + in_r * (1.0f - right)) * bypass,
+                                   right_input_buffer[sid] * (1.0f - bypass));
                 }
             }
 
             // PROCESS
             {
+                MONIQUE_STAGE_SCOPE(synth_data->runtime_info->stage_timings, TIMING_FX_OUTPUT);
                 // FINAL MIX
                 {
                     const float *const smoothed_volume_buffer =
@@ -5308,20 +3047,12 @@ class FXProcessor
                         juce::ScopedLock locked(synth_data->audio_processor->peak_meter_lock);
                         meter->process(left_out_buffer, num_samples_);
                     }
+                    soft_clipp_greater_0_9_block(left_out_buffer, left_out_buffer, num_samples_,
+                                                 synth_data->atan_accuracy);
                     if (is_stereo)
                     {
-                        for (int sid = 0; sid != num_samples_; ++sid)
-                        {
-                            left_out_buffer[sid] = soft_clipp_greater_0_9(left_out_buffer[sid]);
-                            right_out_buffer[sid] = soft_clipp_greater_0_9(right_out_buffer[sid]);
-                        }
-                    }
-                    else
-                    {
-                        for (int sid = 0; sid != num_samples_; ++sid)
-                        {
-                            left_out_buffer[sid] = soft_clipp_greater_0_9(left_out_buffer[sid]);
-                        }
+                        soft_clipp_greater_0_9_block(right_out_buffer, right_out_buffer,
+                                                     num_samples_, synth_data->atan_accuracy);
                     }
 
                     // VISUALIZE
@@ -5349,6 +3080,7 @@ class FXProcessor
 
             // PREPARE
             {
+                MONIQUE_STAGE_SCOPE(synth_data->runtime_info->stage_timings, TIMING_FX_ENV);
                 float *const final_env_amp = data_buffer->final_env.getWritePointer();
                 final_env->process(final_env_amp, num_samples_);
 
@@ -5362,11 +3094,13 @@ class FXProcessor
 
             // STEREO CHORUS
             {
+                MONIQUE_STAGE_SCOPE(synth_data->runtime_info->stage_timings, TIMING_FX_CHORUS);
                 chorus.process(left_input_buffer, nullptr, left_out_buffer, nullptr, num_samples_);
             }
 
             // DELAY
             {
+                MONIQUE_STAGE_SCOPE(synth_data->runtime_info->stage_timings, TIMING_FX_DELAY);
                 delay.set_reflexion_size(
                     synth_data->delay_refexion, synth_data->delay_record_size,
                     synth_data->glide_motor_time,
@@ -5382,6 +3116,7 @@ class FXProcessor
 
             // REVERB
             {
+                MONIQUE_STAGE_SCOPE(synth_data->runtime_info->stage_timings, TIMING_FX_REVERB);
                 const float *const smoothed_bypass_buffer =
                     synth_data->effect_bypass_smoother.get_smoothed_value_buffer();
 
@@ -5391,38 +3126,27 @@ class FXProcessor
                     reverb_data->width_smoother.get_smoothed_value_buffer();
                 const float *const smoothed_dry_wet_mix_buffer =
                     reverb_data->dry_wet_mix_smoother.get_smoothed_value_buffer();
-                ReverbParameters &rever_params_l = reverb_l.get_parameters();
+                mono_ArenaBuffer<SUM_REVERB_BUFFERS> &reverb_buffers =
+                    data_buffer->reverb_buffers;
+                float *const reverb_out = reverb_buffers.getWritePointer(REVERB_OUTPUT);
+                mono_Reverb::calc_block_parameters(smoothed_room_buffer,
+                                                   smoothed_dry_wet_mix_buffer,
+                                                   smoothed_with_buffer, reverb_buffers,
+                                                   num_samples_);
+
+                reverb_l.process_block(left_out_buffer, reverb_out, reverb_buffers, num_samples_);
                 for (int sid = 0; sid != num_samples_; ++sid)
                 {
-                    {
-                        const float reverb_room = smoothed_room_buffer[sid];
-                        const float reverb_dry_wet_mix = 1.0f - smoothed_dry_wet_mix_buffer[sid];
-                        const float reverb_width = smoothed_with_buffer[sid];
-                        if (rever_params_l.roomSize != reverb_room ||
-                            rever_params_l.dryLevel != reverb_dry_wet_mix
-                            //|| rever_params_r.wetLevel != r_params.wetLevel
-                            || rever_params_l.width != reverb_width)
-                        {
-                            rever_params_l.roomSize = reverb_room;
-                            rever_params_l.dryLevel = reverb_dry_wet_mix;
-                            rever_params_l.wetLevel = 1.0f - reverb_dry_wet_mix;
-                            rever_params_l.width = reverb_width;
-
-                            reverb_l.update_parameters();
-                        }
-
-                        const float in_l = left_out_buffer[sid];
-                        float sample_l = reverb_l.processSingleSampleRaw(in_l);
-
-                        const float bypass = smoothed_bypass_buffer[sid];
-                        left_out_buffer[sid] = sample_mix(sample_l + in_l * bypass,
-                                                          left_input_buffer[sid] * (1.0f - bypass));
-                    }
+                    const float in_l = left_out_buffer[sid];
+                    const float bypass = smoothed_bypass_buffer[sid];
+                    left_out_buffer[sid] = sample_mix(reverb_out[sid] + in_l * bypass,
+                                                      left_input_buffer[sid] * (1.0f - bypass));
                 }
             }
 
             // PROCESS
             {
+                MONIQUE_STAGE_SCOPE(synth_data->runtime_info->stage_timings, TIMING_FX_OUTPUT);
                 // FINAL MIX
                 {
                     const float *const smoothed_volume_buffer =
@@ -5453,13 +3177,10 @@ class FXProcessor
                         juce::ScopedLock locked(synth_data->audio_processor->peak_meter_lock);
                         meter->process(left_out_buffer, num_samples_);
                     }
-                    {
-                        for (int sid = 0; sid != num_samples_; ++sid)
-                        {
-                            right_out_buffer[sid] = left_out_buffer[sid] =
-                                soft_clipp_greater_0_9(left_out_buffer[sid]);
-                        }
-                    }
+                    soft_clipp_greater_0_9_block(left_out_buffer, left_out_buffer, num_samples_,
+                                                 synth_data->atan_accuracy);
+                    juce::FloatVectorOperations::copy(right_out_buffer, left_out_buffer,
+                                                      num_samples_);
 
                     // VISUALIZE
                     if (Monique_Ui_AmpPainter *amp_painter =
@@ -5527,9 +3248,7 @@ class FXProcessor
           bypass_smoother(bypass_smoother_),
 
           synth_data(synth_data_), data_buffer(synth_data_->data_buffer),
-          reverb_data(synth_data_->reverb_data.get()), chorus_data(synth_data_->chorus_data.get()),
-
-          sin_lookup(synth_data_->sine_lookup), cos_lookup(synth_data_->cos_lookup)
+          reverb_data(synth_data_->reverb_data.get()), chorus_data(synth_data_->chorus_data.get())
     {
 #ifdef JUCE_DEBUG
         std::cout << "MONIQUE: init FX" << std::endl;
@@ -5927,6 +3646,14 @@ COLD MoniqueSynthesiserVoice::~MoniqueSynthesiserVoice() noexcept
     delete eq_processor;
     delete fx_processor;
 }
+COLD void MoniqueSynthesiserVoice::collect_memory_footprint(
+    MemoryFootprint &footprint_) const noexcept
+{
+    footprint_.add(MEMORY_DELAY, fx_processor->delay.get_memory_usage());
+    footprint_.add(MEMORY_CHORUS, fx_processor->chorus.get_memory_usage());
+    footprint_.add(MEMORY_REVERB, fx_processor->reverb_l.get_memory_usage() +
+                                      fx_processor->reverb_r.get_memory_usage());
+}
 
 //==============================================================================
 void MoniqueSynthesiserVoice::startNote(int midi_note_number_, float velocity_,
@@ -7053,6 +4780,7 @@ void SmoothedParameter::smooth_and_morph(bool force_by_load_, bool is_automated_
     }
 
     const bool is_modulateable = has_modulation(param_to_smooth);
+    const int control_rate = smooth_manager->get_control_rate();
     float *const target = values.getWritePointer();
     if (!is_modulateable)
     {
@@ -7062,23 +4790,31 @@ void SmoothedParameter::smooth_and_morph(bool force_by_load_, bool is_automated_
         // AUTOMATED MORPH
         if (is_automated_morph_)
         {
-            for (int sid = 0; sid != num_samples_; ++sid)
+            for (int sid = 0; sid < num_samples_; sid += control_rate)
             {
-                const float power_of_right_ =
-                    morph_power_smoother.glide_tick(morph_amp_buffer_[sid]);
-                target[sid] = FORCE_MIN_MAX(left_morph_smoother.tick() * (1.0f - power_of_right_) +
-                                            right_morph_smoother.tick() * power_of_right_);
+                const int num_ticks = juce::jmin(control_rate, num_samples_ - sid);
+                const float power_of_right_ = morph_power_smoother.glide_tick(
+                    morph_amp_buffer_[sid + num_ticks - 1], num_ticks);
+                const float value =
+                    FORCE_MIN_MAX(left_morph_smoother.tick(num_ticks) * (1.0f - power_of_right_) +
+                                  right_morph_smoother.tick(num_ticks) * power_of_right_);
+                ramp_to(target + sid, last_morphed_value, value, num_ticks);
+                last_morphed_value = value;
             }
         }
         // USER MORPH
         else
         {
             morph_power_smoother.set_value(morph_slider_state_);
-            for (int sid = 0; sid != num_samples_; ++sid)
+            for (int sid = 0; sid < num_samples_; sid += control_rate)
             {
-                const float power_of_right = morph_power_smoother.tick();
-                target[sid] = FORCE_MIN_MAX(left_morph_smoother.tick() * (1.0f - power_of_right) +
-                                            right_morph_smoother.tick() * power_of_right);
+                const int num_ticks = juce::jmin(control_rate, num_samples_ - sid);
+                const float power_of_right = morph_power_smoother.tick(num_ticks);
+                const float value =
+                    FORCE_MIN_MAX(left_morph_smoother.tick(num_ticks) * (1.0f - power_of_right) +
+                                  right_morph_smoother.tick(num_ticks) * power_of_right);
+                ramp_to(target + sid, last_morphed_value, value, num_ticks);
+                last_morphed_value = value;
             }
 
             // KEEP UP TO DATE FOR A SWITCH
@@ -7098,34 +4834,46 @@ void SmoothedParameter::smooth_and_morph(bool force_by_load_, bool is_automated_
         float *const target_modulation = modulation_power.getWritePointer();
         if (is_automated_morph_)
         {
-            for (int sid = 0; sid != num_samples_; ++sid)
+            for (int sid = 0; sid < num_samples_; sid += control_rate)
             {
-                const float power_of_right_ =
-                    morph_power_smoother.glide_tick(morph_amp_buffer_[sid]);
+                const int num_ticks = juce::jmin(control_rate, num_samples_ - sid);
+                const float power_of_right_ = morph_power_smoother.glide_tick(
+                    morph_amp_buffer_[sid + num_ticks - 1], num_ticks);
 
                 // VALUE
-                target[sid] = FORCE_MIN_MAX(left_morph_smoother.tick() * (1.0f - power_of_right_) +
-                                            right_morph_smoother.tick() * power_of_right_);
+                const float value =
+                    FORCE_MIN_MAX(left_morph_smoother.tick(num_ticks) * (1.0f - power_of_right_) +
+                                  right_morph_smoother.tick(num_ticks) * power_of_right_);
+                ramp_to(target + sid, last_morphed_value, value, num_ticks);
+                last_morphed_value = value;
                 // MODULATION
-                target_modulation[sid] =
-                    left_modulation_morph_smoother.tick() * (1.0f - power_of_right_) +
-                    right_modulation_morph_smoother.tick() * power_of_right_;
+                const float modulation =
+                    left_modulation_morph_smoother.tick(num_ticks) * (1.0f - power_of_right_) +
+                    right_modulation_morph_smoother.tick(num_ticks) * power_of_right_;
+                ramp_to(target_modulation + sid, last_morphed_modulation, modulation, num_ticks);
+                last_morphed_modulation = modulation;
             }
         }
         // USER MORPH
         else
         {
             morph_power_smoother.set_value(morph_slider_state_);
-            for (int sid = 0; sid != num_samples_; ++sid)
+            for (int sid = 0; sid < num_samples_; sid += control_rate)
             {
-                const float power_of_right = morph_power_smoother.tick();
+                const int num_ticks = juce::jmin(control_rate, num_samples_ - sid);
+                const float power_of_right = morph_power_smoother.tick(num_ticks);
                 // VALUE BLOCK
-                target[sid] = FORCE_MIN_MAX(left_morph_smoother.tick() * (1.0f - power_of_right) +
-                                            right_morph_smoother.tick() * power_of_right);
+                const float value =
+                    FORCE_MIN_MAX(left_morph_smoother.tick(num_ticks) * (1.0f - power_of_right) +
+                                  right_morph_smoother.tick(num_ticks) * power_of_right);
+                ramp_to(target + sid, last_morphed_value, value, num_ticks);
+                last_morphed_value = value;
                 // MODULATION BLOCK
-                target_modulation[sid] =
-                    left_modulation_morph_smoother.tick() * (1.0f - power_of_right) +
-                    right_modulation_morph_smoother.tick() * power_of_right;
+                const float modulation =
+                    left_modulation_morph_smoother.tick(num_ticks) * (1.0f - power_of_right) +
+                    right_modulation_morph_smoother.tick(num_ticks) * power_of_right;
+                ramp_to(target_modulation + sid, last_morphed_modulation, modulation, num_ticks);
+                last_morphed_modulation = modulation;
             }
 
             // KEEP UP TO DATE FOR A SWITCH
@@ -7149,22 +4897,36 @@ inline void SmoothedParameter::process_modulation(const bool is_modulated_,
     const float *const modulation = modulation_power.getReadPointer();
     if (is_modulated_)
     {
-        float current_modulation_power;
-        for (int sid = 0; sid != num_samples_; ++sid)
-        {
-            current_modulation_power = modulation[sid] * modulation_power_smoother.glide_tick(
-                                                             modulator_power_buffer_[sid]);
-            const float in = source_and_target[sid];
-            if (current_modulation_power > 0)
-            {
-                source_and_target[sid] = in + (max_value - in) * current_modulation_power;
-                DEBUG_CHECK_MIN_MAX(source_and_target[sid]);
-            }
-            else
-            {
-                source_and_target[sid] = in + (in - min_value) * current_modulation_power;
-                DEBUG_CHECK_MIN_MAX(source_and_target[sid]);
+        // THE POWER AT THE CONTROL POINTS, RAMPED IN BETWEEN
+        const int control_rate = smooth_manager->get_control_rate();
+        float current_modulation_power = last_modulation_power;
+        for (int start_sid = 0; start_sid < num_samples_; start_sid += control_rate)
+        {
+            const int num_ticks = juce::jmin(control_rate, num_samples_ - start_sid);
+            const int last_sid = start_sid + num_ticks - 1;
+            const float modulation_power_at_control_point =
+                modulation[last_sid] *
+                modulation_power_smoother.glide_tick(modulator_power_buffer_[last_sid], num_ticks);
+            const float step = (modulation_power_at_control_point - last_modulation_power) /
+                               num_ticks;
+            for (int sid = start_sid; sid <= last_sid; ++sid)
+            {
+                current_modulation_power =
+                    sid == last_sid ? modulation_power_at_control_point
+                                    : last_modulation_power + step * (sid - start_sid + 1);
+                const float in = source_and_target[sid];
+                if (current_modulation_power > 0)
+                {
+                    source_and_target[sid] = in + (max_value - in) * current_modulation_power;
+                    DEBUG_CHECK_MIN_MAX(source_and_target[sid]);
+                }
+                else
+                {
+                    source_and_target[sid] = in + (in - min_value) * current_modulation_power;
+                    DEBUG_CHECK_MIN_MAX(source_and_target[sid]);
+                }
             }
+            last_modulation_power = modulation_power_at_control_point;
         }
 
         param_to_smooth->get_runtime_info().set_last_modulation_amount(current_modulation_power);
@@ -7194,6 +4956,7 @@ inline void SmoothedParameter::process_modulation(const bool is_modulated_,
         }
 
         param_to_smooth->get_runtime_info().set_last_modulation_amount(current_modulation_power);
+        last_modulation_power = current_modulation_power;
 
         // KEEP UP TO DATE FOR A SWITCH
         modulation_power_smoother.reset_glide_countdown();
@@ -7284,6 +5047,7 @@ void MoniqueSynthesiserVoice::render_block(juce::AudioSampleBuffer &output_buffe
     {
         must_process = fx_processor->final_env->get_current_stage() != END_ENV;
     }
+    synth_data->smooth_manager->set_control_rate(get_control_rate(synth_data));
     if (must_process)
     {
         const int glide_motor_time = synth_data->glide_motor_time;
@@ -7423,6 +5187,8 @@ void MoniqueSynthesiserVoice::render_block(juce::AudioSampleBuffer &output_buffe
                 ~SmoothExecuter() noexcept {}
             };
 
+            MONIQUE_STAGE_LAP_TIMER(info->stage_timings);
+
             // MASTER THREAD
             SmoothExecuter(this, data_buffer->mfo_amplitudes.getWritePointer(0),
                            data_buffer->lfo_amplitudes.getWritePointer(0),
@@ -7442,6 +5208,7 @@ void MoniqueSynthesiserVoice::render_block(juce::AudioSampleBuffer &output_buffe
 
                            force_by_load)
                 .exec();
+            MONIQUE_STAGE_LAP(TIMING_SMOOTH_1);
 
             // OPTIONAL THREAD WITH FILTER 1
             SmoothExecuter(this, data_buffer->mfo_amplitudes.getWritePointer(1),
@@ -7463,6 +5230,7 @@ void MoniqueSynthesiserVoice::render_block(juce::AudioSampleBuffer &output_buffe
 
                            force_by_load)
                 .exec();
+            MONIQUE_STAGE_LAP(TIMING_SMOOTH_2);
 
             // OPTIONAL THREAD
             SmoothExecuter(this, data_buffer->mfo_amplitudes.getWritePointer(2),
@@ -7484,6 +5252,7 @@ void MoniqueSynthesiserVoice::render_block(juce::AudioSampleBuffer &output_buffe
 
                            force_by_load)
                 .exec();
+            MONIQUE_STAGE_LAP(TIMING_SMOOTH_3);
 
             // MASTER THREAD
             SmoothExecuter(this, data_buffer->mfo_amplitudes.getWritePointer(3), nullptr,
@@ -7502,13 +5271,33 @@ void MoniqueSynthesiserVoice::render_block(juce::AudioSampleBuffer &output_buffe
 
                            force_by_load)
                 .exec();
+            MONIQUE_STAGE_LAP(TIMING_SMOOTH_4);
 
             // WITH THREADING INSIDE
             filter_processors[0]->process(num_samples);
+            MONIQUE_STAGE_LAP(TIMING_FILTER_1);
             filter_processors[1]->process(num_samples);
+            MONIQUE_STAGE_LAP(TIMING_FILTER_2);
             filter_processors[2]->process(num_samples);
+            MONIQUE_STAGE_LAP(TIMING_FILTER_3);
 
             eq_processor->process(num_samples);
+            MONIQUE_STAGE_LAP(TIMING_EQ);
+
+            if (juce::AudioSampleBuffer *const pre_fx_capture = info->pre_fx_capture)
+            {
+                for (int channel = 0; channel != pre_fx_capture->getNumChannels(); ++channel)
+                {
+                    juce::FloatVectorOperations::copy(
+                        pre_fx_capture->getWritePointer(channel, start_sample_),
+                        data_buffer->filter_stereo_output_samples.getReadPointer(
+                            synth_data->is_stereo ? channel : LEFT),
+                        num_samples);
+                }
+            }
+#if MONIQUE_STAGE_TIMING
+            info->stage_timings.add_block(num_samples, getSampleRate());
+#endif
         }
 
         float velocity_to_use = current_velocity;
@@ -55,6 +55,12 @@ class ArpSequencer;
 class SmoothManager;
 class RuntimeNotifyer;
 class MoniqueSynthesizer;
+struct MemoryFootprint;
+
+//==============================================================================
+// NOISE SOURCES CREATED AFTER THIS CALL ARE SEEDED WITH seed_, seed_ + 1, ...
+// 0 (DEFAULT) SEEDS THEM RANDOMLY
+void set_noise_seed(std::int64_t seed_) noexcept;
 
 #define TABLESIZE_MULTI 1000
 //#define LOOKUP_TABLE_SIZE int(float_Pi*TABLESIZE_MULTI*2)
@@ -170,6 +176,9 @@ class MoniqueSynthesiserVoice : public juce::SynthesiserVoice
     float get_arp_sequence_amp(int step_) const noexcept;
     float get_current_frequency() const noexcept;
 
+    // THE DELAY, CHORUS AND REVERB BUFFERS
+    COLD void collect_memory_footprint(MemoryFootprint &footprint_) const noexcept;
+
   public:
     //==============================================================================
     COLD MoniqueSynthesiserVoice(MoniqueAudioProcessor *const audio_processor_,
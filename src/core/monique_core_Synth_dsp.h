@@ -0,0 +1,4169 @@
+/*
+** Monique is Free and Open Source Software
+**
+** Monique is made available under the Gnu General Public License, v3.0
+** https://www.gnu.org/licenses/gpl-3.0.en.html; The authors of the code
+** reserve the right to re-license their contributions under the MIT license in the
+** future at the discretion of the project maintainers.
+**
+** Copyright 2016-2022 by various individuals as described by the git transaction log
+**
+** All source at: https://github.com/surge-synthesizer/monique-monosynth.git
+**
+** Monique was a commercial product from 2016-2021, with copyright and ownership
+** in that period held by Thomas Arndt at Monoplugs. Thomas made Monique
+** open source in December 2021.
+*/
+
+#ifndef MONOSYNTH_DSP_H_INCLUDED
+#define MONOSYNTH_DSP_H_INCLUDED
+
+#include "monique_core_Synth.h"
+
+#include "monique_core_Datastructures.h"
+#include "monique_core_Processor.h"
+
+#include <juce_dsp/juce_dsp.h>
+#include <atomic>
+#include <memory>
+
+// THE DSP PRIMITIVES OF THE SYNTH. THE VOICE AND ITS PROCESSORS IN monique_core_Synth.cpp
+// ARE BUILT FROM THEM, monique-bench MEASURES THEM ONE BY ONE.
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+inline float sample_mix(float s1_, float s2_) noexcept
+{
+    if ((s1_ > 0) && (s2_ > 0))
+    {
+        s1_ = s1_ + s2_ - (s1_ * s2_);
+    }
+    else if ((s1_ < 0) && (s2_ < 0))
+    {
+        s1_ = s1_ + s2_ + (s1_ * s2_);
+    }
+    else
+    {
+        s1_ += s2_;
+    }
+
+    return s1_;
+}
+
+#if JUCE_USE_SIMD
+using float_register = juce::dsp::SIMDRegister<float>;
+
+// THE SAME LAW AS ABOVE, THE BRANCHES BECOME MASKS
+inline float_register sample_mix(float_register s1_, float_register s2_) noexcept
+{
+    const float_register zero = float_register::expand(0);
+    const float_register product = s1_ * s2_;
+    const float_register::vMaskType both_positive =
+        float_register::greaterThan(s1_, zero) & float_register::greaterThan(s2_, zero);
+    const float_register::vMaskType both_negative =
+        float_register::lessThan(s1_, zero) & float_register::lessThan(s2_, zero);
+
+    return s1_ + s2_ - (product & both_positive) + (product & both_negative);
+}
+#endif
+
+// dest_ = sample_mix( ... sample_mix( sample_mix( ins_[0], ins_[1] ), ins_[2] ) ..., ins_[N-1] )
+// dest_ CAN BE ONE OF THE INPUTS
+inline void sample_mix_block(float *const dest_, const float *const *const ins_, const int num_ins_,
+                             const int num_samples_) noexcept
+{
+    int sid = 0;
+#if JUCE_USE_SIMD
+    bool is_aligned = float_register::isSIMDAligned(dest_);
+    for (int input_id = 0; input_id != num_ins_; ++input_id)
+    {
+        is_aligned = is_aligned && float_register::isSIMDAligned(ins_[input_id]);
+    }
+    if (is_aligned)
+    {
+        const int num_lanes = int(float_register::SIMDNumElements);
+        const int num_simd_samples = num_samples_ - num_samples_ % num_lanes;
+        for (; sid != num_simd_samples; sid += num_lanes)
+        {
+            float_register sum = float_register::fromRawArray(ins_[0] + sid);
+            for (int input_id = 1; input_id != num_ins_; ++input_id)
+            {
+                sum = sample_mix(sum, float_register::fromRawArray(ins_[input_id] + sid));
+            }
+            sum.copyToRawArray(dest_ + sid);
+        }
+    }
+#endif
+
+    // THE TAIL, UNALIGNED BUFFERS OR NO SIMD AT ALL
+    for (; sid != num_samples_; ++sid)
+    {
+        float sum = ins_[0][sid];
+        for (int input_id = 1; input_id != num_ins_; ++input_id)
+        {
+            sum = sample_mix(sum, ins_[input_id][sid]);
+        }
+        dest_[sid] = sum;
+    }
+}
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+// CONSTANT POWER PAN, sin AND cos OF ( pan_ + 1 ) * PI / 4. BOTH COME FROM THE ANGLE AROUND
+// PI / 4, SO THE POLYNOMIALS ONLY COVER +-PI / 4 AND STAY BELOW 4e-7 ERROR
+template <typename T> inline void pan_law(T pan_, T &sin_, T &cos_) noexcept
+{
+    const T x = pan_ * (juce::MathConstants<float>::pi * 0.25f);
+    const T x2 = x * x;
+    const T sin_x = x * (((x2 * (-1.0f / 5040) + 1.0f / 120) * x2 + (-1.0f / 6)) * x2 + 1.0f);
+    const T cos_x =
+        (((x2 * (1.0f / 40320) + (-1.0f / 720)) * x2 + 1.0f / 24) * x2 + (-0.5f)) * x2 + 1.0f;
+    sin_ = (cos_x + sin_x) * 0.70710678f;
+    cos_ = (cos_x - sin_x) * 0.70710678f;
+}
+inline float left_pan(float pan_) noexcept
+{
+    float sin_gain, cos_gain;
+    pan_law(pan_, sin_gain, cos_gain);
+    return juce::jmax(sin_gain, 0.00001f);
+}
+inline float right_pan(float pan_) noexcept
+{
+    float sin_gain, cos_gain;
+    pan_law(pan_, sin_gain, cos_gain);
+    return juce::jmax(cos_gain, 0.00001f);
+}
+
+// left_gains_ = left_pan( pan_ ) AND right_gains_ = right_pan( pan_ ) FOR A BLOCK
+// A PAN THAT DID NOT MOVE IN THIS BLOCK IS CALCULATED ONCE
+inline void pan_block(const float *const pan_, float *const left_gains_, float *const right_gains_,
+                      const int num_samples_) noexcept
+{
+    const juce::Range<float> range = juce::FloatVectorOperations::findMinAndMax(pan_, num_samples_);
+    if (range.getStart() == range.getEnd())
+    {
+        juce::FloatVectorOperations::fill(left_gains_, left_pan(range.getStart()), num_samples_);
+        juce::FloatVectorOperations::fill(right_gains_, right_pan(range.getStart()), num_samples_);
+        return;
+    }
+
+    int sid = 0;
+#if JUCE_USE_SIMD
+    if (float_register::isSIMDAligned(pan_) && float_register::isSIMDAligned(left_gains_) &&
+        float_register::isSIMDAligned(right_gains_))
+    {
+        const float_register min_gain = float_register::expand(0.00001f);
+        const int num_lanes = int(float_register::SIMDNumElements);
+        const int num_simd_samples = num_samples_ - num_samples_ % num_lanes;
+        for (; sid != num_simd_samples; sid += num_lanes)
+        {
+            float_register sin_gain, cos_gain;
+            pan_law(float_register::fromRawArray(pan_ + sid), sin_gain, cos_gain);
+            float_register::max(sin_gain, min_gain).copyToRawArray(left_gains_ + sid);
+            float_register::max(cos_gain, min_gain).copyToRawArray(right_gains_ + sid);
+        }
+    }
+#endif
+
+    for (; sid != num_samples_; ++sid)
+    {
+        left_gains_[sid] = left_pan(pan_[sid]);
+        right_gains_[sid] = right_pan(pan_[sid]);
+    }
+}
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+class Smoother : RuntimeListener
+{
+    int pos;
+    float sum;
+    int size_in_ms;
+    int size;
+    mono_AudioSampleBuffer<1> buffer;
+    float *ptr_to_buffer;
+
+  public:
+    //==========================================================================
+    inline void add(float val_) noexcept
+    {
+        sum -= ptr_to_buffer[pos];
+        ptr_to_buffer[pos] = val_;
+        sum += val_;
+
+        if (++pos >= size)
+        {
+            pos = 0;
+        }
+    }
+    inline float add_and_get_average(float val_) noexcept
+    {
+        add(val_);
+        return get_average();
+    }
+    inline float get_average() const noexcept { return sum * (1.0f / size); }
+    inline void reset(float value_) noexcept
+    {
+        sum = 0;
+        for (int i = 0; i != size; ++i)
+        {
+            ptr_to_buffer[i] = value_;
+            sum += value_;
+        }
+    }
+    void set_size_in_ms(int size_in_ms_, bool force_ = false) noexcept
+    {
+        if (size_in_ms != size_in_ms_ || force_)
+        {
+            float last_average = get_average();
+
+            size_in_ms = size_in_ms_;
+            size = juce::jmax(3, msToSamplesFast(size_in_ms_, sample_rate));
+            buffer.setSize(size, false);
+            ptr_to_buffer = buffer.getWritePointer();
+
+            if (pos > size)
+            {
+                pos = 0;
+            }
+
+            sum = 0;
+            for (int i = 0; i != size; ++i)
+            {
+                ptr_to_buffer[i] = last_average;
+                sum += last_average;
+            }
+        }
+    }
+
+  private:
+    virtual void sample_rate_or_block_changed() noexcept override
+    {
+        set_size_in_ms(size_in_ms, true);
+    };
+
+  public:
+    //==========================================================================
+    COLD Smoother(RuntimeNotifyer *const notifyer_, int init_size_in_ms_) noexcept
+        : RuntimeListener(notifyer_), pos(0), sum(0), size_in_ms(init_size_in_ms_),
+          size(juce::jmax(3, msToSamplesFast(init_size_in_ms_, sample_rate))), buffer(size),
+          ptr_to_buffer(buffer.getWritePointer())
+    {
+        reset(0);
+    }
+    COLD ~Smoother() {}
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(Smoother)
+};
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+// TOOPT with AudioBuffer and Function
+// atan lookup???
+inline float soft_clipping(float input_and_worker_) noexcept
+{
+    return (std::atan(input_and_worker_) * (1.0f / juce::MathConstants<float>::pi)) * 1.5;
+}
+
+//==============================================================================
+// TOOPT with AudioBuffer and Function
+inline float lfo2amp(float sample_) noexcept { return (sample_ + 1.0f) * 0.5f; }
+
+//==============================================================================
+// THE CONTROL RATE: THE SAMPLES UP TO THE NEXT CONTROL POINT, THE LAST ONE IS EXACT
+inline void ramp_to(float *dest_, float from_, float to_, int num_samples_) noexcept
+{
+    const float step = (to_ - from_) / num_samples_;
+    for (int sid = 1; sid < num_samples_; ++sid)
+    {
+        dest_[sid - 1] = from_ + step * sid;
+    }
+    dest_[num_samples_ - 1] = to_;
+}
+
+//==============================================================================
+// -120DB, A QUIETER SECTION INPUT IS SILENT AND A QUIETER TAIL HAS DECAYED
+#define SILENCE_THRESHOLD 1.0e-6f
+inline bool is_silent_block(const float *const buffer_, const int num_samples_) noexcept
+{
+    const juce::Range<float> range =
+        juce::FloatVectorOperations::findMinAndMax(buffer_, num_samples_);
+    return range.getStart() > -SILENCE_THRESHOLD && range.getEnd() < SILENCE_THRESHOLD;
+}
+
+//==============================================================================
+// BYPASSES A SECTION ONCE ITS INPUT IS SILENT AND ITS OUTPUT STAYED SILENT FOR LONGER THAN ITS
+// TAIL. THE FIRST BLOCK WITH INPUT WAKES IT UP AGAIN
+class TailBypass
+{
+    int silent_samples;
+    bool is_bypassed;
+
+  public:
+    //==========================================================================
+    // BEFORE PROCESSING, TRUE IF THE SECTION CAN SKIP THIS BLOCK
+    inline bool can_skip(bool input_is_silent_) noexcept
+    {
+        if (!input_is_silent_)
+        {
+            silent_samples = 0;
+            is_bypassed = false;
+        }
+        return is_bypassed;
+    }
+    // AFTER PROCESSING, TRUE IF THE SECTION JUST WENT TO SLEEP, THE CALLER CLEARS ITS STATE THEN
+    inline bool settle(bool input_is_silent_, bool output_is_silent_, int tail_samples_,
+                       int num_samples_) noexcept
+    {
+        if (!input_is_silent_ || !output_is_silent_)
+        {
+            silent_samples = 0;
+            is_bypassed = false;
+            return false;
+        }
+        if (is_bypassed)
+        {
+            return false;
+        }
+        silent_samples += num_samples_;
+        is_bypassed = silent_samples > tail_samples_;
+        return is_bypassed;
+    }
+
+    inline void reset() noexcept
+    {
+        silent_samples = 0;
+        is_bypassed = false;
+    }
+
+  public:
+    //==========================================================================
+    COLD TailBypass() noexcept : silent_samples(0), is_bypassed(false) {}
+    COLD ~TailBypass() noexcept {}
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(TailBypass)
+};
+
+//==============================================================================
+inline float distortion(float input_and_worker_, float distortion_power_) noexcept
+{
+    if (distortion_power_ != 0)
+    {
+        const float distortion_add_on = distortion_power_ * 0.9f;
+        input_and_worker_ =
+            ((1.0f + distortion_add_on) * input_and_worker_) -
+            (input_and_worker_ * input_and_worker_ * input_and_worker_) * distortion_add_on;
+    }
+
+    return input_and_worker_;
+}
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+// TOOPT with AudioBuffer and Function
+inline float clipp_to_0_and_1(float input_and_worker_) noexcept
+{
+    if (input_and_worker_ > 1)
+    {
+        input_and_worker_ = 1;
+    }
+    else if (input_and_worker_ < 0)
+    {
+        input_and_worker_ = 0;
+    }
+
+    return input_and_worker_;
+}
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+// TOOPT with AudioBuffer and Function
+inline float soft_clipp_greater_1_2(float x) noexcept
+{
+    if (x > 1)
+    {
+        x = 1.0f + soft_clipping(x - 1.0f);
+    }
+    else if (x < -1)
+    {
+        x = -1.0f + soft_clipping(x + 1.0f);
+    }
+
+    if (x > 1.2)
+    {
+        x = 1.2;
+    }
+    else if (x < -1.2)
+    {
+        x = -1.2;
+    }
+
+    return x;
+}
+//==============================================================================
+//==============================================================================
+//==============================================================================
+// TOOPT with AudioBuffer and Function
+inline float soft_clipp_greater_0_9(float x) noexcept
+{
+    if (x > 0.9f)
+    {
+        x = 0.9f + soft_clipping(x - 0.9f);
+    }
+    else if (x < -0.9f)
+    {
+        x = -0.9f + soft_clipping(x + 0.9f);
+    }
+
+    if (x > 1)
+    {
+        x = 1;
+    }
+    else if (x < -1)
+    {
+        x = -1;
+    }
+
+    return x;
+}
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+// TOOPT with AudioBuffer and Function
+inline float hard_clipper_1(float x) noexcept
+{
+    if (x > 1)
+    {
+        x = 1;
+    }
+    else if (x < -1)
+    {
+        x = -1;
+    }
+
+    return x;
+}
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+// atan FOR THE BLOCK CLIPPERS. |x| > 1 IS FOLDED TO 1/|x|, SO THE POLYNOMIALS ONLY COVER 0..1
+// ATAN_PRECISE STAYS BELOW 1.2e-5 ERROR, ATAN_FAST BELOW 1.5e-3
+template <int accuracy, typename T> inline T fast_atan_0_1(T z_) noexcept
+{
+    if constexpr (accuracy == ATAN_FAST)
+    {
+        return z_ * ((z_ + (-1.0f)) * (z_ * -0.0663f + (-0.2447f)) + 0.78539816f);
+    }
+    else
+    {
+        const T z2 = z_ * z_;
+        return z_ * ((((z2 * 0.0208351f + (-0.0851330f)) * z2 + 0.1801410f) * z2 +
+                      (-0.3302995f)) *
+                         z2 +
+                     0.9998660f);
+    }
+}
+template <int accuracy> inline float fast_atan(float x_) noexcept
+{
+    if constexpr (accuracy == ATAN_EXACT)
+    {
+        return std::atan(x_);
+    }
+    else
+    {
+        const float abs_x = std::abs(x_);
+        const float abs_atan =
+            abs_x > 1 ? juce::MathConstants<float>::halfPi - fast_atan_0_1<accuracy>(1.0f / abs_x)
+                      : fast_atan_0_1<accuracy>(abs_x);
+        return x_ < 0 ? -abs_atan : abs_atan;
+    }
+}
+inline float clip_to(float x_, float min_, float max_) noexcept
+{
+    return juce::jlimit(min_, max_, x_);
+}
+
+#if JUCE_USE_SIMD
+inline float_register reciprocal(float_register x_) noexcept
+{
+#if JUCE_USE_SSE_INTRINSICS
+    return float_register::fromNative(_mm_div_ps(_mm_set1_ps(1.0f), x_.value));
+#elif JUCE_USE_ARM_NEON
+    float32x4_t estimate = vrecpeq_f32(x_.value);
+    estimate = vmulq_f32(vrecpsq_f32(x_.value, estimate), estimate);
+    estimate = vmulq_f32(vrecpsq_f32(x_.value, estimate), estimate);
+    return float_register::fromNative(estimate);
+#else
+    for (std::size_t i = 0; i != float_register::SIMDNumElements; ++i)
+    {
+        x_.set(i, 1.0f / x_.get(i));
+    }
+    return x_;
+#endif
+}
+template <int accuracy> inline float_register fast_atan(float_register x_) noexcept
+{
+    if constexpr (accuracy == ATAN_EXACT)
+    {
+        for (std::size_t i = 0; i != float_register::SIMDNumElements; ++i)
+        {
+            x_.set(i, std::atan(x_.get(i)));
+        }
+        return x_;
+    }
+    else
+    {
+        const float_register one = float_register::expand(1);
+        const float_register::vMaskType is_negative =
+            float_register::lessThan(x_, float_register::expand(0));
+        const float_register abs_x = (x_ & ~is_negative) - (x_ & is_negative);
+
+        // min( |x|, 1/max( |x|, 1 ) ) IS |x| OR ITS FOLDED VALUE, WITHOUT A DIVISION BY ZERO
+        const float_register::vMaskType is_folded = float_register::greaterThan(abs_x, one);
+        const float_register atan_0_1 = fast_atan_0_1<accuracy>(
+            float_register::min(abs_x, reciprocal(float_register::max(abs_x, one))));
+        const float_register abs_atan =
+            (atan_0_1 & ~is_folded) +
+            ((float_register::expand(juce::MathConstants<float>::halfPi) - atan_0_1) & is_folded);
+        return (abs_atan & ~is_negative) - (abs_atan & is_negative);
+    }
+}
+inline float_register clip_to(float_register x_, float min_, float max_) noexcept
+{
+    return float_register::min(float_register::max(x_, float_register::expand(min_)),
+                               float_register::expand(max_));
+}
+#endif
+
+//==============================================================================
+// THE CLIPPERS ABOVE WITHOUT BRANCHES, FOR FLOATS AND SIMD LANES
+template <int accuracy, typename T> inline T soft_clipping_fast(T x_) noexcept
+{
+    return fast_atan<accuracy>(x_) * (1.5f / juce::MathConstants<float>::pi);
+}
+// soft_clipp_greater_1_2 IS ( x_, 1, 1.2 ), soft_clipp_greater_0_9 IS ( x_, 0.9, 1 )
+template <int accuracy, typename T>
+inline T soft_clipp_greater_fast(T x_, float knee_, float ceiling_) noexcept
+{
+    const T below_knee = clip_to(x_, -knee_, knee_);
+    return clip_to(below_knee + soft_clipping_fast<accuracy>(x_ - below_knee), -ceiling_,
+                   ceiling_);
+}
+// x_ * ( 1 - power_ ) + atan( x_ * 20 ) / 6.66 * power_
+template <int accuracy, typename T> inline T filter_distortion_fast(T x_, T power_) noexcept
+{
+    return x_ + (fast_atan<accuracy>(x_ * 20.0f) * (1.0f / 6.66f) - x_) * power_;
+}
+
+//==============================================================================
+// out_[sid] = kernel_( in_[sid] ) AND out_[sid] = kernel_( in_[sid], in_2_[sid] ), IN SIMD LANES IF
+// ALL BUFFERS ARE ALIGNED. out_ CAN BE ONE OF THE INPUTS
+template <typename Kernel>
+inline void map_block(const float *const in_, float *const out_, const int num_samples_,
+                      Kernel kernel_) noexcept
+{
+    int sid = 0;
+#if JUCE_USE_SIMD
+    if (float_register::isSIMDAligned(in_) && float_register::isSIMDAligned(out_))
+    {
+        const int num_lanes = int(float_register::SIMDNumElements);
+        const int num_simd_samples = num_samples_ - num_samples_ % num_lanes;
+        for (; sid != num_simd_samples; sid += num_lanes)
+        {
+            kernel_(float_register::fromRawArray(in_ + sid)).copyToRawArray(out_ + sid);
+        }
+    }
+#endif
+    for (; sid != num_samples_; ++sid)
+    {
+        out_[sid] = kernel_(in_[sid]);
+    }
+}
+template <typename Kernel>
+inline void map_block(const float *const in_, const float *const in_2_, float *const out_,
+                      const int num_samples_, Kernel kernel_) noexcept
+{
+    int sid = 0;
+#if JUCE_USE_SIMD
+    if (float_register::isSIMDAligned(in_) && float_register::isSIMDAligned(in_2_) &&
+        float_register::isSIMDAligned(out_))
+    {
+        const int num_lanes = int(float_register::SIMDNumElements);
+        const int num_simd_samples = num_samples_ - num_samples_ % num_lanes;
+        for (; sid != num_simd_samples; sid += num_lanes)
+        {
+            kernel_(float_register::fromRawArray(in_ + sid),
+                    float_register::fromRawArray(in_2_ + sid))
+                .copyToRawArray(out_ + sid);
+        }
+    }
+#endif
+    for (; sid != num_samples_; ++sid)
+    {
+        out_[sid] = kernel_(in_[sid], in_2_[sid]);
+    }
+}
+
+//==============================================================================
+// THE BLOCK CLIPPERS, ATAN_EXACT RUNS THE SCALAR ORIGINALS
+inline void soft_clipp_greater_1_2_block(const float *const in_, float *const out_,
+                                         const int num_samples_, const int atan_accuracy_) noexcept
+{
+    switch (atan_accuracy_)
+    {
+    case ATAN_FAST:
+        map_block(in_, out_, num_samples_,
+                  [](auto x_) { return soft_clipp_greater_fast<ATAN_FAST>(x_, 1, 1.2f); });
+        break;
+    case ATAN_PRECISE:
+        map_block(in_, out_, num_samples_,
+                  [](auto x_) { return soft_clipp_greater_fast<ATAN_PRECISE>(x_, 1, 1.2f); });
+        break;
+    default:
+        for (int sid = 0; sid != num_samples_; ++sid)
+        {
+            out_[sid] = soft_clipp_greater_1_2(in_[sid]);
+        }
+    }
+}
+inline void soft_clipp_greater_0_9_block(const float *const in_, float *const out_,
+                                         const int num_samples_, const int atan_accuracy_) noexcept
+{
+    switch (atan_accuracy_)
+    {
+    case ATAN_FAST:
+        map_block(in_, out_, num_samples_,
+                  [](auto x_) { return soft_clipp_greater_fast<ATAN_FAST>(x_, 0.9f, 1); });
+        break;
+    case ATAN_PRECISE:
+        map_block(in_, out_, num_samples_,
+                  [](auto x_) { return soft_clipp_greater_fast<ATAN_PRECISE>(x_, 0.9f, 1); });
+        break;
+    default:
+        for (int sid = 0; sid != num_samples_; ++sid)
+        {
+            out_[sid] = soft_clipp_greater_0_9(in_[sid]);
+        }
+    }
+}
+// THE DISTORTION OF THE FILTER INPUTS AND OUTPUTS, A BLOCK WITHOUT DISTORTION IS SKIPPED
+inline void filter_distortion_block(const float *const in_, const float *const powers_,
+                                    float *const out_, const int num_samples_,
+                                    const int atan_accuracy_) noexcept
+{
+    const juce::Range<float> power_range =
+        juce::FloatVectorOperations::findMinAndMax(powers_, num_samples_);
+    if (power_range.getStart() == 0 && power_range.getEnd() == 0)
+    {
+        if (out_ != in_)
+        {
+            juce::FloatVectorOperations::copy(out_, in_, num_samples_);
+        }
+        return;
+    }
+
+    switch (atan_accuracy_)
+    {
+    case ATAN_FAST:
+        map_block(in_, powers_, out_, num_samples_, [](auto x_, auto power_) {
+            return filter_distortion_fast<ATAN_FAST>(x_, power_);
+        });
+        break;
+    case ATAN_PRECISE:
+        map_block(in_, powers_, out_, num_samples_, [](auto x_, auto power_) {
+            return filter_distortion_fast<ATAN_PRECISE>(x_, power_);
+        });
+        break;
+    default:
+        for (int sid = 0; sid != num_samples_; ++sid)
+        {
+            const float power = powers_[sid];
+            out_[sid] = power != 0 ? in_[sid] * (1.0f - power) +
+                                         (std::atan(in_[sid] * 20) / 6.66) * power
+                                   : in_[sid];
+        }
+    }
+}
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+// replace with juce table lookup
+inline float lookup(const float *table_, float x) noexcept
+{
+    return table_[int(x * TABLESIZE_MULTI) % LOOKUP_TABLE_SIZE];
+}
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+class PerfectCycleCounter : RuntimeListener
+{
+    //==========================================================================
+    double frequency;
+
+    double delta;
+    double angle;
+
+    double rate;
+    double phase;
+
+    double cylces_per_sec;
+
+    bool new_cycle;
+
+  public:
+    //==========================================================================
+    inline void set_frequency(double frequency_) noexcept
+    {
+        if (frequency != frequency_)
+        {
+            frequency = frequency_;
+            cylces_per_sec = sample_rate / frequency_;
+
+            delta = frequency_ / sample_rate *
+                    (juce::MathConstants<double>::pi + juce::MathConstants<double>::pi);
+            rate = (1.0 / cylces_per_sec) * juce::MathConstants<double>::pi;
+        }
+    }
+    inline void tick() noexcept
+    {
+        new_cycle = false;
+
+        angle += delta;
+        phase += rate;
+        if (angle > (juce::MathConstants<double>::pi + juce::MathConstants<double>::pi))
+        {
+            angle -= (juce::MathConstants<double>::pi + juce::MathConstants<double>::pi);
+            phase -= (juce::MathConstants<double>::pi + juce::MathConstants<double>::pi);
+            new_cycle = true;
+        }
+    }
+    inline double get_last_angle() const noexcept { return angle; }
+    inline double get_last_phase() const noexcept { return phase; }
+    inline double get_angle_delta() const noexcept { return delta; }
+    inline double get_phase_delta() const noexcept { return rate; }
+
+    inline double get_cylces_per_sec() const noexcept { return cylces_per_sec; }
+    inline bool is_new_cycle() const noexcept { return new_cycle; }
+    inline bool is_clean() const noexcept { return angle == 0 && new_cycle && phase == 0; }
+
+    //==========================================================================
+    void reset() noexcept
+    {
+        angle = 0;
+        new_cycle = true;
+        phase = 0;
+    }
+
+    //==========================================================================
+    void sample_rate_or_block_changed() noexcept override
+    {
+        float frequency_old = frequency;
+        frequency = 0;
+        set_frequency(frequency_old);
+    }
+
+  public:
+    //==========================================================================
+    COLD PerfectCycleCounter(RuntimeNotifyer *const notifyer_) noexcept
+        : RuntimeListener(notifyer_), frequency(0), delta(0), angle(0), rate(0), phase(0),
+          cylces_per_sec(0), new_cycle(true)
+    {
+    }
+    COLD ~PerfectCycleCounter() noexcept {}
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PerfectCycleCounter)
+};
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+class mono_BlitSaw
+{
+    float phase_offset;
+    double last_tick_value;
+    double p_;
+    double C2_;
+    double phase_correction;
+    double a_;
+    double state_;
+
+    unsigned int m_;
+
+  public:
+    //==========================================================================
+    inline float tick(double phase_) noexcept
+    {
+        double tmp;
+        {
+            const double working_phase_ = (phase_ + phase_offset) - phase_correction;
+
+            // Avoid a divide by zero, or use of a denormalized divisor
+            // at the sinc peak, which has a limiting value of m_ / p_.
+            const double denominator = std::sin(working_phase_);
+            if (std::fabs(denominator) <= std::numeric_limits<double>::epsilon())
+            {
+                tmp = a_;
+            }
+            else
+            {
+                tmp = sin(working_phase_ * m_) / (p_ * denominator);
+            }
+        }
+
+        tmp += (state_ - C2_);
+        state_ = tmp * 0.995;
+
+        return last_tick_value = tmp;
+    }
+    inline float lastOut() const noexcept { return last_tick_value; }
+
+    // BRINGS THE LEAKY INTEGRATOR BACK TO ITS STEADY STATE AFTER SKIPPED TICKS
+    // WHOLE CYCLES OF N SAMPLES FROM ZERO GIVE c, THE STEADY STATE IS c / (1 - LEAK^N)
+    inline void resync(double last_phase_, double phase_delta_, int num_samples_) noexcept
+    {
+        state_ = 0;
+        warm_up(last_phase_, phase_delta_, num_samples_);
+        state_ /= 1.0 - std::pow(0.995, num_samples_);
+        last_tick_value = state_ / 0.995;
+    }
+    // TICKS THE num_samples_ UP TO last_phase_
+    inline void warm_up(double last_phase_, double phase_delta_, int num_samples_) noexcept
+    {
+        for (int i = num_samples_ - 1; i >= 0; --i)
+        {
+            tick(last_phase_ - i * phase_delta_);
+        }
+    }
+
+    //==========================================================================
+    inline void set_phase_offset(float offset_) noexcept
+    {
+        phase_offset = offset_ * juce::MathConstants<float>::pi;
+    }
+    inline void updateHarmonics(double p) noexcept
+    {
+        p_ = p;
+        C2_ = 1.0 / p;
+        phase_correction = C2_ * (juce::MathConstants<double>::pi * 0.5) / 0.9;
+        m_ = 2 * floor(0.5 * p) + 1;
+        a_ = p / p;
+    }
+
+    //==========================================================================
+    inline void reset() noexcept
+    {
+        state_ = 0;
+        last_tick_value = 0;
+    }
+
+  public:
+    //==========================================================================
+    COLD mono_BlitSaw() noexcept
+        : phase_offset(0), last_tick_value(0), p_(0), C2_(0), phase_correction(0), a_(0), state_(0),
+          m_(0)
+    {
+    }
+    COLD ~mono_BlitSaw() noexcept {}
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(mono_BlitSaw)
+};
+
+//==============================================================================
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+class mono_BlitSquare
+{
+    float last_tick_value;
+    float phase_offset;
+    double a_;
+    double p_;
+    double phase_correction;
+    double lastBlitOutput_;
+    double dcbState_;
+
+    unsigned int m_;
+
+  public:
+    //==========================================================================
+    inline float tick(double phase_) noexcept
+    {
+        // OUTPUT PROCESS
+        float out;
+        {
+            const double temp = lastBlitOutput_;
+            {
+                const double current_phase = (phase_ + phase_offset) - phase_correction;
+
+                // Avoid a divide by zero, or use of a denomralized divisor
+                // at the sinc peak, which has a limiting value of 1.0.
+                {
+
+                    const double denominator = std::sin(current_phase);
+                    if (std::fabs(denominator) < std::numeric_limits<double>::epsilon())
+                    {
+                        // Inexact comparison safely distinguishes between *close to zero*, and
+                        // *close to PI*.
+                        if (current_phase < 0.0001 ||
+                            current_phase > (juce::MathConstants<double>::pi +
+                                             juce::MathConstants<double>::pi) -
+                                                0.0001)
+                        {
+                            lastBlitOutput_ = a_;
+                        }
+                        else
+                        {
+                            lastBlitOutput_ = -a_;
+                        }
+                    }
+                    else
+                    {
+                        lastBlitOutput_ = std::sin(current_phase * m_) / (p_ * denominator);
+                    }
+                }
+            }
+
+            lastBlitOutput_ += temp;
+
+            // Now apply DC blocker.
+            out = lastBlitOutput_ - dcbState_ + 0.999f * last_tick_value;
+            dcbState_ = lastBlitOutput_;
+        }
+
+        return last_tick_value = out;
+    }
+    inline float lastOut(void) const noexcept { return last_tick_value; }
+
+    // THE OUTPUT IS THE BLIT INTEGRATED WITH A 0.999 LEAK, THE INTEGRATOR ITSELF ONLY ADDS A DC
+    // THE BLOCKER REMOVES. SAME STEADY STATE TRICK AS mono_BlitSaw::resync
+    inline void resync(double last_angle_, double angle_delta_, int num_samples_) noexcept
+    {
+        last_tick_value = 0;
+        warm_up(last_angle_, angle_delta_, num_samples_);
+        last_tick_value /= 1.0 - std::pow(0.999, num_samples_);
+    }
+    // TICKS THE num_samples_ UP TO last_angle_
+    inline void warm_up(double last_angle_, double angle_delta_, int num_samples_) noexcept
+    {
+        for (int i = num_samples_ - 1; i >= 0; --i)
+        {
+            double angle = std::fmod(last_angle_ - i * angle_delta_,
+                                     juce::MathConstants<double>::twoPi);
+            if (angle < 0)
+            {
+                angle += juce::MathConstants<double>::twoPi;
+            }
+            tick(angle);
+        }
+    }
+
+    //==========================================================================
+    inline void set_phase_offset(float offset_) noexcept
+    {
+        phase_offset = offset_ * juce::MathConstants<float>::pi;
+    }
+    inline void updateHarmonics(double p) noexcept
+    {
+        p_ = p * 0.5;
+        m_ = (floor(0.5 * p_) + 1) * 2;
+        a_ = p / p;
+
+        phase_correction = (1.0 / p) * juce::MathConstants<double>::pi;
+    }
+
+    //==========================================================================
+    inline void reset() noexcept
+    {
+        last_tick_value = 0;
+        dcbState_ = 0;
+        lastBlitOutput_ = 0;
+    }
+
+  public:
+    //==========================================================================
+    COLD mono_BlitSquare() noexcept
+        : last_tick_value(0), phase_offset(0), a_(0), p_(0), phase_correction(0),
+          lastBlitOutput_(0), dcbState_(0), m_(0)
+    {
+    }
+    COLD ~mono_BlitSquare() noexcept {}
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(mono_BlitSquare)
+};
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+// POLYNOMIAL BAND LIMITED STEP, t IS THE POSITION IN THE CYCLE, dt THE CYCLE PER SAMPLE
+inline double poly_blep(double t_, double dt_) noexcept
+{
+    if (t_ < dt_)
+    {
+        t_ /= dt_;
+        return t_ + t_ - t_ * t_ - 1;
+    }
+    else if (t_ > 1 - dt_)
+    {
+        t_ = (t_ - 1) / dt_;
+        return t_ * t_ + t_ + t_ + 1;
+    }
+    return 0;
+}
+
+//==============================================================================
+// DROP IN FOR mono_BlitSaw: SAME PHASE INPUT (ONE CYCLE PER PI), LEVEL AND DIRECTION, NO STATE
+class mono_PolyBlepSaw
+{
+    double phase_offset;
+    double cycles_per_sample;
+    float last_tick_value;
+
+  public:
+    //==========================================================================
+    inline float tick(double phase_) noexcept
+    {
+        double t = (phase_ + phase_offset) * (1.0 / juce::MathConstants<double>::pi);
+        t -= std::floor(t);
+
+        return last_tick_value = float(0.5 - t + 0.5 * poly_blep(t, cycles_per_sample));
+    }
+    inline float lastOut() const noexcept { return last_tick_value; }
+
+    //==========================================================================
+    inline void set_phase_offset(float offset_) noexcept
+    {
+        phase_offset = offset_ * juce::MathConstants<double>::pi;
+    }
+    inline void updateHarmonics(double samples_per_cycle_) noexcept
+    {
+        cycles_per_sample = juce::jmin(0.5, 1.0 / samples_per_cycle_);
+    }
+
+    //==========================================================================
+    inline void reset() noexcept { last_tick_value = 0; }
+
+  public:
+    //==========================================================================
+    COLD mono_PolyBlepSaw() noexcept : phase_offset(0), cycles_per_sample(0), last_tick_value(0)
+    {
+    }
+    COLD ~mono_PolyBlepSaw() noexcept {}
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(mono_PolyBlepSaw)
+};
+
+//==============================================================================
+// DROP IN FOR mono_BlitSquare: SAME ANGLE INPUT, +0.5 IN THE FIRST HALF OF THE CYCLE, NO STATE
+class mono_PolyBlepSquare
+{
+    double phase_offset;
+    double cycles_per_sample;
+    float last_tick_value;
+
+  public:
+    //==========================================================================
+    inline float tick(double angle_) noexcept
+    {
+        double t = (angle_ + phase_offset) * (1.0 / juce::MathConstants<double>::twoPi);
+        t -= std::floor(t);
+        double t_down = t + 0.5;
+        t_down -= std::floor(t_down);
+
+        const double naive = t < 0.5 ? 1 : -1;
+        return last_tick_value =
+                   float(0.5 * (naive + poly_blep(t, cycles_per_sample) -
+                                poly_blep(t_down, cycles_per_sample)));
+    }
+    inline float lastOut() const noexcept { return last_tick_value; }
+
+    //==========================================================================
+    inline void set_phase_offset(float offset_) noexcept
+    {
+        phase_offset = offset_ * juce::MathConstants<double>::pi;
+    }
+    inline void updateHarmonics(double samples_per_cycle_) noexcept
+    {
+        cycles_per_sample = juce::jmin(0.5, 1.0 / samples_per_cycle_);
+    }
+
+    //==========================================================================
+    inline void reset() noexcept { last_tick_value = 0; }
+
+  public:
+    //==========================================================================
+    COLD mono_PolyBlepSquare() noexcept
+        : phase_offset(0), cycles_per_sample(0), last_tick_value(0)
+    {
+    }
+    COLD ~mono_PolyBlepSquare() noexcept {}
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(mono_PolyBlepSquare)
+};
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+class mono_SineWave
+{
+    const float *const sine_lookup;
+
+    float last_tick_value;
+    float phase_offset;
+
+  public:
+    //==========================================================================
+    inline float tick(double angle_) noexcept
+    {
+        return last_tick_value = lookup(sine_lookup, angle_ + phase_offset);
+    }
+    inline float lastOut() const noexcept { return last_tick_value; }
+
+    //==========================================================================
+    inline void set_phase_offset(float offset_) noexcept
+    {
+        phase_offset = offset_ * juce::MathConstants<float>::pi;
+    }
+
+  public:
+    //==========================================================================
+    COLD mono_SineWave(const float *sine_lookup_) noexcept
+        : sine_lookup(sine_lookup_), last_tick_value(0), phase_offset(0)
+    {
+    }
+    COLD ~mono_SineWave() noexcept {}
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(mono_SineWave)
+};
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+class mono_SineWaveAutonom : public RuntimeListener
+{
+    const float *const sine_lookup;
+
+    double frequency;
+
+    double delta;
+    double angle;
+
+    bool new_cycle;
+
+    float last_tick_value;
+
+  public:
+    //==========================================================================
+    inline float tick() noexcept
+    {
+        new_cycle = false;
+
+        angle += delta;
+        if (angle > (juce::MathConstants<double>::pi + juce::MathConstants<double>::pi))
+        {
+            angle -= (juce::MathConstants<double>::pi + juce::MathConstants<double>::pi);
+            new_cycle = true;
+        }
+
+        return last_tick_value = lookup(sine_lookup, angle);
+    }
+    inline float lastOut_with_phase_offset(float offset_) noexcept
+    {
+        return lookup(sine_lookup, angle + offset_ * (juce::MathConstants<double>::pi +
+                                                      juce::MathConstants<double>::pi));
+    }
+    inline float lastOut() const noexcept { return last_tick_value; }
+
+    //==========================================================================
+    inline void set_frequency(double frequency_) noexcept
+    {
+        if (frequency != frequency_)
+        {
+            frequency = frequency_;
+            delta = frequency_ / sample_rate *
+                    (juce::MathConstants<double>::pi + juce::MathConstants<double>::pi);
+        }
+    }
+    inline void overwrite_angle(float angle_) noexcept { angle = angle_; }
+
+    //==========================================================================
+    inline bool is_new_cycle() const noexcept { return new_cycle; }
+
+    inline void sample_rate_or_block_changed() noexcept override
+    {
+        float frequency_old = frequency;
+        frequency = 0;
+        set_frequency(frequency_old);
+    }
+
+  public:
+    //==========================================================================
+    COLD mono_SineWaveAutonom(RuntimeNotifyer *const notifyer_,
+                              const float *const sine_lookup_) noexcept
+        : RuntimeListener(notifyer_),
+
+          sine_lookup(sine_lookup_), frequency(0),
+
+          delta(0), angle(0),
+
+          new_cycle(0),
+
+          last_tick_value(0)
+    {
+    }
+    COLD ~mono_SineWaveAutonom() noexcept {}
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(mono_SineWaveAutonom)
+};
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+class mono_SineWaveAutonomShifted : public RuntimeListener
+{
+    const float *const sine_lookup;
+
+    double frequency;
+
+    double delta;
+    double angle;
+
+    bool new_cycle;
+
+    float last_tick_value;
+
+  public:
+    //==========================================================================
+    inline float tick() noexcept
+    {
+        new_cycle = false;
+
+        angle += delta;
+        if (angle - (juce::MathConstants<double>::pi * 0.5) >
+            (juce::MathConstants<double>::pi + juce::MathConstants<double>::pi))
+        {
+            angle -= (juce::MathConstants<double>::pi + juce::MathConstants<double>::pi);
+            new_cycle = true;
+        }
+
+        return last_tick_value = (lookup(sine_lookup, angle) * -1 + 1) * 0.5;
+    }
+    inline float lastOut() const noexcept { return last_tick_value; }
+
+    //==========================================================================
+    inline void set_frequency(double frequency_) noexcept
+    {
+        if (frequency != frequency_)
+        {
+            frequency = frequency_;
+            delta = frequency_ / sample_rate *
+                    (juce::MathConstants<double>::pi + juce::MathConstants<double>::pi);
+        }
+    }
+
+    //==========================================================================
+    inline bool is_new_cycle() const noexcept { return new_cycle; }
+
+    //==========================================================================
+    inline void sample_rate_or_block_changed() noexcept override
+    {
+        float frequency_old = frequency;
+        frequency = 0;
+        set_frequency(frequency_old);
+    }
+
+  public:
+    //==========================================================================
+    COLD mono_SineWaveAutonomShifted(RuntimeNotifyer *const notifyer_,
+                                     const float *const sine_lookup_) noexcept
+        : RuntimeListener(notifyer_),
+
+          sine_lookup(sine_lookup_), frequency(0),
+
+          delta(0), angle(juce::MathConstants<double>::pi * 0.5),
+
+          new_cycle(0),
+
+          last_tick_value(0)
+    {
+    }
+    COLD ~mono_SineWaveAutonomShifted() noexcept {}
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(mono_SineWaveAutonomShifted)
+};
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+// THE SEED OF THE NEXT NOISE SOURCE, SEE set_noise_seed. 0 SEEDS IT RANDOMLY
+std::int64_t take_noise_seed() noexcept;
+
+class mono_Noise
+{
+    juce::Random random;
+    float last_tick_value;
+
+  public:
+    //==========================================================================
+    inline float tick() noexcept { return last_tick_value = random.nextFloat() * 2 - 1; }
+    inline float lastOut() const noexcept { return last_tick_value; }
+
+  public:
+    //==========================================================================
+    COLD mono_Noise() noexcept : last_tick_value(0)
+    {
+        const std::int64_t seed = take_noise_seed();
+        if (seed != 0)
+        {
+            random.setSeed(seed);
+        }
+    }
+    COLD ~mono_Noise() noexcept {}
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(mono_Noise)
+};
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+class mono_OnePole
+{
+    float last_tick_value;
+    float gain;
+    float a1, b;
+
+  public:
+    //==========================================================================
+    inline float tick(float input) noexcept
+    {
+        return last_tick_value = b * gain * input - a1 * last_tick_value;
+    }
+    inline float lastOut() const noexcept { return last_tick_value; }
+
+    //==========================================================================
+    inline void setPole(float thePole) noexcept
+    {
+        if (thePole > 0)
+        {
+            b = 1.0f - thePole;
+        }
+        else
+        {
+            b = 1.0f + thePole;
+        }
+
+        a1 = -thePole;
+    }
+    inline void setGain(float gain_) noexcept { gain = gain_; }
+
+  public:
+    //==========================================================================
+    COLD mono_OnePole(float thePole = 0.9) noexcept : last_tick_value(0), gain(0), a1(0), b(0)
+    {
+        this->setPole(thePole);
+    }
+    COLD ~mono_OnePole() noexcept {}
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(mono_OnePole)
+};
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+class mono_Modulate : public RuntimeListener
+{
+    const float *const sine_lookup;
+
+    mono_SineWaveAutonomShifted vibrato;
+    mono_SineWaveAutonom swing;
+    mono_OnePole filter;
+    mono_Noise noise;
+
+    float last_tick_value;
+    float last_swing_frequency;
+    unsigned int noiseRate;
+    unsigned int noiseCounter;
+
+  public:
+    //==========================================================================
+    inline float tick() noexcept
+    {
+        // Compute periodic and random modulations.
+        last_tick_value = vibrato.tick();
+        if (++noiseCounter > noiseRate)
+        {
+            noise.tick();
+            noiseCounter = 0;
+        }
+        last_tick_value += filter.tick(noise.lastOut());
+
+        return last_tick_value * swing.tick();
+    }
+    inline float lastOut() const noexcept { return last_tick_value; }
+
+    //==========================================================================
+    inline void set_vibrato_frequency(float frequency_) noexcept
+    {
+        vibrato.set_frequency(frequency_);
+    }
+    inline void set_swing_frequency(float frequency_) noexcept
+    {
+        if (last_swing_frequency != frequency_)
+        {
+            if (frequency_ == 0)
+            {
+                swing.overwrite_angle(juce::MathConstants<float>::pi * 0.5);
+            }
+
+            last_swing_frequency = frequency_;
+            swing.set_frequency(frequency_);
+        }
+    }
+    inline bool is_next_a_new_cycle() const noexcept { return vibrato.is_new_cycle(); }
+
+    //==========================================================================
+    inline void reset() noexcept { last_tick_value = 0; }
+
+    void sample_rate_or_block_changed() noexcept override
+    {
+        noiseRate = (unsigned int)(330.0 * sample_rate / 22050.0);
+    }
+
+  public:
+    //==========================================================================
+    COLD mono_Modulate(RuntimeNotifyer *const notifyer_, const float *const sine_lookup_) noexcept
+        : RuntimeListener(notifyer_),
+
+          sine_lookup(sine_lookup_),
+
+          vibrato(notifyer_, sine_lookup_), swing(notifyer_, sine_lookup_),
+
+          filter(), noise(),
+
+          last_tick_value(0), last_swing_frequency(0), noiseRate(0), noiseCounter(0)
+    {
+        vibrato.set_frequency(6.0);
+        swing.set_frequency(0);
+        swing.overwrite_angle(juce::MathConstants<float>::pi * 0.5);
+
+        noiseRate = (unsigned int)(330.0 * sample_rate / 22050.0);
+        noiseCounter = noiseRate;
+
+        filter.setPole(0.999);
+        filter.setGain(0.05);
+    }
+    COLD ~mono_Modulate() noexcept {}
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(mono_Modulate)
+};
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+class LFO : public RuntimeListener
+{
+    const float *const sine_lookup;
+
+    float delta;
+    float angle;
+    int last_samples_per_clock;
+
+    int last_speed;
+    float last_out;
+
+    float glide_samples;
+    int glide_counter;
+    float glide_value;
+
+    DataBuffer *const data_buffer;
+    const LFOData *const lfo_data;
+    const RuntimeInfo *const runtime_info;
+    const SmoothManager *const smooth_manager;
+
+    //==============================================================================
+    inline float calculate_amp(float angle_, float offset_, float wave_,
+                               float speed_multi_) const noexcept
+    {
+        const float sine_amp =
+            lookup(sine_lookup, angle_ * juce::MathConstants<double>::twoPi +
+                                    offset_ * juce::MathConstants<double>::twoPi);
+        float amp = sine_amp * (1.0f - wave_) +
+                    (std::atan(sine_amp * 250 * juce::jmax(speed_multi_, 1.0f)) * (1.0f / 1.55)) *
+                        wave_;
+        if (amp > 1)
+        {
+            amp = 1;
+        }
+        else if (amp < -1)
+        {
+            amp = -1;
+        }
+        return lfo2amp(amp);
+    }
+
+    //==============================================================================
+    inline void calculate_delta(const int samples_per_clock_, const float speed_multi_,
+                                const std::int64_t sync_sample_pos_) noexcept
+    {
+        if (last_samples_per_clock != samples_per_clock_)
+        {
+            {
+                const float samples_per_bar = samples_per_clock_ * 96;
+                const float samples_per_cylce = samples_per_bar * speed_multi_;
+                delta = (1.0f / samples_per_cylce);
+            }
+
+            last_samples_per_clock = samples_per_clock_;
+        }
+    }
+
+  public:
+    inline void process(float *dest_, int step_number_, int absoloute_step_number_,
+                        int start_pos_in_buffer_, int num_samples_, bool use_process_sample = true,
+                        juce::Array<RuntimeInfo::standalone_features::ClockSync::SyncPosPair>
+                            *clock_infos_ = nullptr) noexcept
+    {
+        // USER SPEED
+        const int speed(lfo_data->speed);
+        const float speed_multi(get_lfo_speed_multi(speed));
+        if (speed != last_speed)
+        {
+            glide_samples = glide_counter = sample_rate / 1000;
+            glide_value = last_out;
+            last_speed = speed;
+        }
+
+        // TO MIDI CLOCK SYNC
+        std::int64_t sync_sample_pos =
+            (runtime_info->relative_samples_since_start + start_pos_in_buffer_);
+        if (!use_process_sample)
+        {
+            sync_sample_pos = start_pos_in_buffer_;
+        }
+
+        bool same_samples_per_block_for_buffer = true;
+        if (is_standalone() && runtime_info->standalone_features_pimpl->is_extern_synced)
+        {
+            auto &runtime_info_standalone_features = *runtime_info->standalone_features_pimpl;
+
+            juce::Array<RuntimeInfo::standalone_features::ClockSync::SyncPosPair>
+                clock_informations =
+                    clock_infos_ ? *clock_infos_
+                                 : runtime_info_standalone_features.clock_sync_information
+                                       .get_a_working_copy();
+
+            if (!runtime_info_standalone_features.clock_sync_information.has_clocks_inside())
+            {
+                same_samples_per_block_for_buffer = true;
+                calculate_delta(runtime_info_standalone_features.clock_sync_information
+                                    .get_last_samples_per_clock(),
+                                speed_multi, sync_sample_pos);
+            }
+            else
+            {
+                same_samples_per_block_for_buffer = false;
+            }
+
+            if (sync_sample_pos <= 0)
+            {
+                angle = 0;
+            }
+
+            // FORCE SYNC
+            if (step_number_ != -1)
+            {
+                bool should_smooth = false;
+                if (fmod(absoloute_step_number_, speed_multi * 16) == 0)
+                {
+                    should_smooth = angle != 0;
+                    angle = 0;
+                }
+
+                if (should_smooth && glide_counter <= 0)
+                {
+                    glide_samples = glide_counter = juce::jmax(10.0, sample_rate / 1000);
+                    glide_value = last_out;
+                }
+            }
+
+            // PROCESS
+            {
+                const float *smoothed_wave_buffer(
+                    lfo_data->wave_smoother.get_smoothed_value_buffer());
+                const float *smoothed_offset_buffer(
+                    lfo_data->phase_shift_smoother.get_smoothed_value_buffer());
+                for (int sid = 0; sid != num_samples_; ++sid)
+                {
+                    if (++sync_sample_pos < 0)
+                    {
+                        continue;
+                    }
+
+                    {
+                        float amp;
+                        {
+                            // CURRENT ANGLE
+                            {
+                                if (!same_samples_per_block_for_buffer)
+                                {
+                                    calculate_delta(
+                                        runtime_info_standalone_features.clock_sync_information
+                                            .get_samples_per_clock(start_pos_in_buffer_ + sid,
+                                                                   clock_informations),
+                                        speed_multi, sync_sample_pos);
+                                }
+                                angle += delta;
+                                angle = angle - floor(angle);
+                            }
+
+                            // AMP
+                            amp = calculate_amp(angle, smoothed_offset_buffer[sid],
+                                                smoothed_wave_buffer[sid], speed_multi);
+                        }
+
+                        if (--glide_counter > 0)
+                        {
+                            float glide = (1.0f / glide_samples * glide_counter);
+                            amp = amp * (1.0f - glide) + glide_value * glide;
+                        }
+
+                        dest_[sid] = amp;
+                    }
+                }
+                last_out = dest_[num_samples_ - 1];
+            }
+        }
+        else
+        // PERFECT SYNC
+        {
+            const float bars_per_sec = runtime_info->bpm / 4 / 60;
+            const float samples_per_bar = (1.0f / bars_per_sec) * sample_rate;
+            const float samples_per_cylce = samples_per_bar * speed_multi;
+            const float cycles_per_sample = (1.0 / samples_per_cylce);
+
+            // PROCESS
+            {
+                const float *smoothed_wave_buffer(
+                    lfo_data->wave_smoother.get_smoothed_value_buffer());
+                const float *smoothed_offset_buffer(
+                    lfo_data->phase_shift_smoother.get_smoothed_value_buffer());
+                // THE ANGLE ONLY DEPENDS ON THE POSITION, SO ONLY THE CONTROL POINTS ARE
+                // CALCULATED AND RAMPED IN BETWEEN
+                const int control_rate = smooth_manager->get_control_rate();
+                for (int sid = 0; sid < num_samples_; sid += control_rate)
+                {
+                    const int num_ticks = juce::jmin(control_rate, num_samples_ - sid);
+                    const int last_sid = sid + num_ticks - 1;
+
+                    angle = cycles_per_sample * (sync_sample_pos + last_sid);
+                    angle = angle - floor(angle);
+
+                    const float amp =
+                        calculate_amp(angle, smoothed_offset_buffer[last_sid],
+                                      smoothed_wave_buffer[last_sid], speed_multi);
+                    ramp_to(dest_ + sid, last_out, amp, num_ticks);
+                    last_out = amp;
+                }
+            }
+        }
+    }
+
+    void sample_rate_or_block_changed() noexcept override { last_speed = -1; }
+
+    //==========================================================================
+    float get_current_amp() const noexcept { return last_out; }
+
+    //==========================================================================
+    void reset() noexcept { last_out = 0; }
+
+  public:
+    //==========================================================================
+    LFO(RuntimeNotifyer *const notifyer_, MoniqueSynthData *synth_data_, LFOData *lfo_data_,
+        const float *const sine_lookup_)
+    noexcept
+        : RuntimeListener(notifyer_),
+
+          sine_lookup(sine_lookup_),
+
+          delta(0), angle(0), last_samples_per_clock(-1),
+
+          last_speed(0), last_out(0),
+
+          glide_samples(0), glide_counter(0), glide_value(0),
+
+          data_buffer(synth_data_->data_buffer), lfo_data(lfo_data_),
+          runtime_info(synth_data_->runtime_info), smooth_manager(synth_data_->smooth_manager)
+    {
+    }
+    ~LFO() noexcept {}
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(LFO)
+};
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+// THE WAVE MIX ONLY EVER HEARS TWO GENERATORS:
+// 0..1 SINE - SQUARE, 1..2 SQUARE - SAW, 2..3 SAW - NOISE
+// SKIPPED BLITS ARE RESYNCED BEFORE THEY ARE HEARD AGAIN. THE RESYNC NEEDS A WHOLE CYCLE AND RUNS
+// ON THE AUDIO THREAD, SO ONLY CYCLES UP TO BLIT_RESYNC_MAX_SAMPLES ARE SKIPPED. LOWER NOTES KEEP
+// THEIR BLITS TICKING
+#define BLIT_RESYNC_MAX_SAMPLES 512
+class ActiveWaves
+{
+    bool saw_in_sync;
+    bool square_in_sync;
+
+  public:
+    bool sine;
+    bool square;
+    bool saw;
+
+  private:
+    // THE WHOLE NUMBER OF CYCLES WHICH ENDS CLOSEST TO A SAMPLE, SO THE WARM UP IS PERIODIC
+    static inline int get_resync_samples(double samples_per_cycle_) noexcept
+    {
+        int best_samples = juce::roundToInt(samples_per_cycle_);
+        double best_error = 1;
+        for (int cycles = 1; cycles * samples_per_cycle_ <= BLIT_RESYNC_MAX_SAMPLES; ++cycles)
+        {
+            const double samples = cycles * samples_per_cycle_;
+            const double error = std::abs(samples - std::round(samples));
+            if (error < best_error)
+            {
+                best_error = error;
+                best_samples = juce::roundToInt(samples);
+            }
+        }
+        return juce::jmax(1, best_samples);
+    }
+
+  public:
+    //==========================================================================
+    inline void update(const float *wave_buffer_, int num_samples_, bool only_active_,
+                       bool use_blits_, const PerfectCycleCounter &cycle_counter_,
+                       mono_BlitSaw &saw_generator_, mono_BlitSquare &square_generator_) noexcept
+    {
+        if (only_active_)
+        {
+            const juce::Range<float> range =
+                juce::FloatVectorOperations::findMinAndMax(wave_buffer_, num_samples_);
+            sine = range.getStart() < 1;
+            square = range.getEnd() > 0 && range.getStart() < 2;
+            saw = range.getEnd() > 1 && range.getStart() < 3;
+        }
+        else
+        {
+            sine = square = saw = true;
+        }
+
+        // NO HARMONICS BEFORE THE FIRST FREQUENCY, THE GENERATORS ARE STILL IN RESET STATE
+        const double samples_per_cycle = cycle_counter_.get_cylces_per_sec();
+        if (samples_per_cycle > 0 && use_blits_)
+        {
+            const bool can_resync = samples_per_cycle <= BLIT_RESYNC_MAX_SAMPLES;
+            if (!can_resync)
+            {
+                saw = square = true;
+            }
+            // A NOTE WHICH GLIDED DOWN WHILE ITS BLITS WERE SKIPPED GETS NO WHOLE CYCLE, THE LEAK
+            // OF THE BOUNDED WARM UP PULLS THE INTEGRATOR TOWARDS ITS STEADY STATE
+            if (saw && !saw_in_sync)
+            {
+                if (can_resync)
+                {
+                    saw_generator_.resync(cycle_counter_.get_last_phase(),
+                                          cycle_counter_.get_phase_delta(),
+                                          get_resync_samples(samples_per_cycle));
+                }
+                else
+                {
+                    saw_generator_.warm_up(cycle_counter_.get_last_phase(),
+                                           cycle_counter_.get_phase_delta(),
+                                           BLIT_RESYNC_MAX_SAMPLES);
+                }
+            }
+            if (square && !square_in_sync)
+            {
+                if (can_resync)
+                {
+                    square_generator_.resync(cycle_counter_.get_last_angle(),
+                                             cycle_counter_.get_angle_delta(),
+                                             get_resync_samples(samples_per_cycle));
+                }
+                else
+                {
+                    square_generator_.warm_up(cycle_counter_.get_last_angle(),
+                                              cycle_counter_.get_angle_delta(),
+                                              BLIT_RESYNC_MAX_SAMPLES);
+                }
+            }
+        }
+        // THE BLITS ARE NOT TICKED WHILE THE POLYBLEPS PLAY
+        saw_in_sync = saw && use_blits_;
+        square_in_sync = square && use_blits_;
+    }
+    // AFTER A RESET OF THE GENERATORS
+    inline void reset() noexcept
+    {
+        saw_in_sync = true;
+        square_in_sync = true;
+    }
+
+  public:
+    //==========================================================================
+    COLD ActiveWaves() noexcept
+        : saw_in_sync(true), square_in_sync(true), sine(true), square(true), saw(true)
+    {
+    }
+    COLD ~ActiveWaves() noexcept {}
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ActiveWaves)
+};
+
+//==============================================================================
+// THE PORTAMENTO AS A FACTOR ON THE TARGET FREQUENCY. THE FACTOR GOES MULTIPLICATIVE TO 1,
+// WHICH IS THE SAME CURVE AS A LINEAR GLIDE OVER THE NOTES, BUT WITHOUT A pow PER SAMPLE.
+// DOUBLES, SO A LONG GLIDE DOES NOT DRIFT BEFORE IT LANDS
+class ExponentialGlide
+{
+    double factor;
+    double step;
+    int samples_left;
+
+  public:
+    //==========================================================================
+    inline bool is_gliding() const noexcept { return samples_left > 0; }
+    inline float get_factor() const noexcept { return float(factor); }
+
+    // STARTS AT start_factor_ TIMES THE TARGET AND REACHES IT AFTER num_samples_ TICKS
+    inline void start(float start_factor_, int num_samples_) noexcept
+    {
+        if (num_samples_ > 0 && start_factor_ > 0)
+        {
+            factor = start_factor_;
+            step = std::pow(double(start_factor_), -1.0 / num_samples_);
+            samples_left = num_samples_;
+        }
+        else
+        {
+            reset();
+        }
+    }
+    inline void tick() noexcept
+    {
+        if (samples_left > 0)
+        {
+            // THE LAST TICK LANDS EXACTLY ON THE TARGET
+            factor = --samples_left > 0 ? factor * step : 1;
+        }
+    }
+    inline void reset() noexcept
+    {
+        factor = 1;
+        step = 1;
+        samples_left = 0;
+    }
+
+    //==========================================================================
+    COLD ExponentialGlide() noexcept : factor(1), step(1), samples_left(0) {}
+    COLD ~ExponentialGlide() noexcept {}
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ExponentialGlide)
+};
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+// MoniqueAudioProcessor::process SETS FLUSH TO ZERO AND DENORMALS ARE ZERO WITH A
+// juce::ScopedNoDenormals, THE SAME CPUS AS THERE. ELSE WE FLUSH THE FILTER STATES OURSELF.
+#if JUCE_USE_SSE_INTRINSICS || JUCE_USE_ARM_NEON || defined(__arm64__) || defined(__aarch64__)
+#define MONO_UNDENORMALISE(n)
+#else
+#define MONO_UNDENORMALISE(n)                                                                      \
+    if (!(n < -1.0e-8f || n > 1.0e-8f))                                                            \
+        n = 0;
+#endif
+
+//==============================================================================
+class AnalogFilter : public RuntimeListener
+{
+    friend class DoubleAnalogFilter;
+    friend class AnalogFilterLanes;
+    float p, k, r;
+    float y1, y2, y3, y4;
+    float oldx;
+    float oldy1, oldy2, oldy3;
+
+    float cutoff, res, res_original;
+
+    // CONTROL RATE GLIDE OF THE COEFFICIENTS
+    float p_step, r_step;
+    float p_target, r_target;
+    int coefficient_steps;
+
+    bool force_update;
+
+    float oversampling; // THE FILTER RUNS AT sample_rate * oversampling
+
+  public:
+    //==========================================================================
+    // RETURNS TRUE ON COFF CHANGED
+    inline bool update(float resonance_, float cutoff_) noexcept
+    {
+        bool success = false;
+        if (force_update || (cutoff != cutoff_ || res_original != resonance_))
+        {
+            cutoff = cutoff_;
+            res_original = resonance_;
+            res = juce::jmax(0.00001f, resonance_ *= 0.99999);
+            success = true;
+
+            force_update = false;
+        }
+        return success;
+    }
+    inline void update_with_fixed_cutoff(float resonance_, float cutoff_) noexcept
+    {
+        if (force_update || (cutoff != cutoff_ || res_original != resonance_))
+        {
+            cutoff = cutoff_;
+            res_original = resonance_;
+            res = resonance_;
+            calc_coefficients(cutoff);
+
+            force_update = false;
+        }
+    }
+    //==========================================================================
+    // THE COEFFICIENTS OF cutoff_ ARE REACHED IN num_steps_ CALLS OF step_coefficients()
+    inline void glide_coefficients_to(float cutoff_, int num_steps_) noexcept
+    {
+        if (num_steps_ <= 1)
+        {
+            calc_coefficients(cutoff_);
+            coefficient_steps = 0;
+            return;
+        }
+
+        const float last_p = p;
+        const float last_r = r;
+        calc_coefficients(cutoff_);
+        p_target = p;
+        r_target = r;
+        p_step = (p_target - last_p) / num_steps_;
+        r_step = (r_target - last_r) / num_steps_;
+        p = last_p;
+        r = last_r;
+        coefficient_steps = num_steps_;
+    }
+    inline void step_coefficients() noexcept
+    {
+        if (coefficient_steps > 0)
+        {
+            // THE LAST STEP SETS THE TARGET, SO NO ERROR SUMS UP
+            if (--coefficient_steps == 0)
+            {
+                p = p_target;
+                r = r_target;
+            }
+            else
+            {
+                p += p_step;
+                r += r_step;
+            }
+            k = p * 2 - 1;
+        }
+    }
+
+    //==========================================================================
+    inline void copy_coefficient_from(const AnalogFilter &other_) noexcept
+    {
+        cutoff = other_.cutoff;
+        res = other_.res;
+
+        p = other_.p;
+        k = other_.k;
+        r = other_.r;
+
+        p_step = other_.p_step;
+        r_step = other_.r_step;
+        p_target = other_.p_target;
+        r_target = other_.r_target;
+        coefficient_steps = other_.coefficient_steps;
+    }
+    inline void copy_state_from(const AnalogFilter &other_) noexcept
+    {
+        oldx = other_.oldx;
+        oldy1 = other_.oldy1;
+        oldy2 = other_.oldy2;
+        oldy3 = other_.oldy3;
+        y1 = other_.y1;
+        y2 = other_.y2;
+        y3 = other_.y3;
+        y4 = other_.y4;
+    }
+    //==========================================================================
+    inline float processLow(float input_and_worker_) noexcept
+    {
+        input_and_worker_ -= r * y4;
+        MONO_UNDENORMALISE(input_and_worker_);
+
+        // Four cascaded onepole filters (bilinear transform)
+        y1 = input_and_worker_ * p + oldx * p - k * y1;
+        y2 = y1 * p + oldy1 * p - k * y2;
+        y3 = y2 * p + oldy2 * p - k * y3;
+        y4 = y3 * p + oldy3 * p - k * y4;
+
+        // Clipper band limited sigmoid
+        y4 -= (y4 * y4 * y4) / 6;
+        MONO_UNDENORMALISE(y4);
+
+        oldx = input_and_worker_;
+        oldy1 = y1;
+        oldy2 = y2;
+        oldy3 = y3;
+
+        return soft_clipp_greater_1_2(y4);
+    }
+    inline float processLowResonance(float input_and_worker_) noexcept
+    {
+        input_and_worker_ -= r * y4;
+        MONO_UNDENORMALISE(input_and_worker_);
+
+        // Four cascaded onepole filters (bilinear transform)
+        y1 = input_and_worker_ * p + oldx * p - k * y1;
+        y2 = y1 * p + oldy1 * p - k * y2;
+        y3 = y2 * p + oldy2 * p - k * y3;
+        y4 = y3 * p + oldy3 * p - k * y4;
+
+        // Clipper band limited sigmoid
+        y4 -= (y4 * y4 * y4) / 6;
+        MONO_UNDENORMALISE(y4);
+
+        oldx = input_and_worker_;
+        oldy1 = y1;
+        oldy2 = y2;
+        oldy3 = y3;
+
+        return soft_clipp_greater_1_2(sample_mix(y4, y3 * res));
+    }
+    inline float processHighResonance(float input_and_worker_) noexcept
+    {
+        input_and_worker_ -= r * y4;
+        MONO_UNDENORMALISE(input_and_worker_);
+
+        // Four cascaded onepole filters (bilinear transform)
+        y1 = input_and_worker_ * p + oldx * p - k * y1;
+        y2 = y1 * p + oldy1 * p - k * y2;
+        y3 = y2 * p + oldy2 * p - k * y3;
+        y4 = y3 * p + oldy3 * p - k * y4;
+
+        // Clipper band limited sigmoid
+        y4 -= (y4 * y4 * y4) / 6;
+        MONO_UNDENORMALISE(y4);
+
+        oldx = input_and_worker_;
+        oldy1 = y1;
+        oldy2 = y2;
+        oldy3 = y3;
+
+        return hard_clipper_1(input_and_worker_ - y4);
+    }
+
+    //==========================================================================
+    inline void reset() noexcept
+    {
+        y1 = y2 = y3 = y4 = oldx = oldy1 = oldy2 = oldy3 = 0;
+    }
+
+    //==========================================================================
+    inline void calc_coefficients(float cutoff_) noexcept
+    {
+        {
+            float f = cutoff_ / (sample_rate * oversampling);
+
+            // float agressive = 0.98f *( 1.0f - res );
+            // float agressive = 0.98f * jmax(0.0f,( 1.0f/8000.0f*cutoff ));
+            // p=f*((1.99f-agressive)-((0.99f-agressive)*f));
+            p = f * (1.8f - 0.8f * f);
+            k = p * 2 - 1;
+        }
+        {
+            // const float cutoff_power = 1.0f - (0.5f * jmin(1.0f,1.0f/(8000.0f*cutoff_)));
+            float t =
+                (1.0f - p) * 1.386249f; // + ( 0.2f * (1.0f-1.0f/(1000.0f*jmax(0.00001f,cutoff))) );
+            const float t2 = 12.0f + t * t;
+            r = res * (t2 + 6.0f * t) / (t2 - 6.0f * t); // * cutoff_power;
+        }
+    }
+
+  private:
+    //==========================================================================
+    COLD void sample_rate_or_block_changed() noexcept override
+    {
+        reset();
+        force_update = true;
+        coefficient_steps = 0;
+    }
+
+  public:
+    //==========================================================================
+    COLD AnalogFilter(RuntimeNotifyer *const notifyer_) noexcept
+        : RuntimeListener(notifyer_),
+
+          p(1), k(1), r(1), y1(0), y2(0), y3(0), y4(0), oldx(0), oldy1(0), oldy2(0), oldy3(0),
+
+          cutoff(1000), res(1), res_original(0.99999),
+
+          p_step(0), r_step(0), p_target(1), r_target(1), coefficient_steps(0),
+
+          force_update(true), oversampling(1)
+    {
+        sample_rate_or_block_changed();
+    }
+    COLD ~AnalogFilter() noexcept {}
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(AnalogFilter)
+};
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+#define FILTER_CHANGE_GLIDE_TIME_MS                                                                \
+    (msToSamplesFast(200, flt_1.sample_rate * flt_1.oversampling) + 50)
+class DoubleAnalogFilter
+{
+    friend class DoubleAnalogFilterLanes;
+    AnalogFilter flt_1;
+    AnalogFilter flt_2;
+
+    DoubleAnalogFilter *smooth_filter;
+
+    FILTER_TYPS last_filter_type;
+    FILTER_TYPS smooth_filter_type;
+    int glide_time_4_filters;
+
+  public:
+    // LP
+    //==========================================================================
+    inline void updateLow2Pass(float resonance_, float cutoff_) noexcept
+    {
+        if (flt_2.update(resonance_, cutoff_))
+        {
+            flt_2.calc_coefficients(get_cutoff(cutoff_));
+            flt_1.copy_coefficient_from(flt_2);
+        }
+    }
+    inline void glideLow2Pass(float resonance_, float cutoff_, int num_steps_) noexcept
+    {
+        num_steps_ = flt_2.force_update ? 1 : num_steps_;
+        if (flt_2.update(resonance_, cutoff_))
+        {
+            flt_2.glide_coefficients_to(get_cutoff(cutoff_), num_steps_);
+            flt_1.copy_coefficient_from(flt_2);
+        }
+    }
+    inline float processLow2Pass(float in_) noexcept
+    {
+        const float out = flt_2.processLowResonance(in_);
+        const float low = flt_1.processLowResonance(out);
+
+        return process_filter_change(in_,
+                                     //(out+low)*(1.0f-gain) + resonance_clipping(out+low)*gain
+                                     sample_mix(out, low));
+    }
+
+    // 1 PASS HP
+    //==========================================================================
+    inline void updateHigh2Pass(float resonance_, float cutoff_) noexcept
+    {
+        if (flt_1.update(resonance_, cutoff_))
+        {
+            flt_1.calc_coefficients(get_cutoff(cutoff_));
+        }
+    }
+    inline void glideHigh2Pass(float resonance_, float cutoff_, int num_steps_) noexcept
+    {
+        num_steps_ = flt_1.force_update ? 1 : num_steps_;
+        if (flt_1.update(resonance_, cutoff_))
+        {
+            flt_1.glide_coefficients_to(get_cutoff(cutoff_), num_steps_);
+        }
+    }
+    inline float processHigh2Pass(float in_) noexcept
+    {
+        in_ = soft_clipp_greater_1_2(in_);
+        const float out = flt_1.processHighResonance(in_);
+        return process_filter_change(in_, out);
+    }
+
+    // BAND
+    //==========================================================================
+    inline void updateBand(float resonance_, float cutoff_) noexcept
+    {
+        float cutoff_2 = cutoff_ + cutoff_ * 0.02;
+        if (flt_1.update(resonance_, cutoff_2))
+        {
+            flt_1.calc_coefficients(get_cutoff(cutoff_));
+            flt_2.update(resonance_, cutoff_);
+            flt_2.calc_coefficients(get_cutoff(cutoff_));
+        }
+    }
+    inline void glideBand(float resonance_, float cutoff_, int num_steps_) noexcept
+    {
+        num_steps_ = flt_1.force_update ? 1 : num_steps_;
+        float cutoff_2 = cutoff_ + cutoff_ * 0.02;
+        if (flt_1.update(resonance_, cutoff_2))
+        {
+            flt_1.glide_coefficients_to(get_cutoff(cutoff_), num_steps_);
+            flt_2.update(resonance_, cutoff_);
+            flt_2.glide_coefficients_to(get_cutoff(cutoff_), num_steps_);
+        }
+    }
+    inline float processBand(float in_) noexcept
+    {
+        return process_filter_change(
+            in_, flt_1.processLowResonance(flt_2.processHighResonance(in_)) * 2);
+    }
+
+    // PASS
+    //==========================================================================
+    inline float processPass(float in_) noexcept { return process_filter_change(in_, in_); }
+
+    // CONTROL RATE
+    //==========================================================================
+    // THE glide* VERSIONS OF THE UPDATES NEED ONE STEP PER SAMPLE
+    inline void step_coefficients() noexcept
+    {
+        flt_1.step_coefficients();
+        flt_2.step_coefficients();
+    }
+    // FOR FILTERS WHICH ARE PROCESSED WITH THE COEFFICIENTS OF ANOTHER ONE
+    inline void copy_coefficients_from(const DoubleAnalogFilter &other_) noexcept
+    {
+        flt_1.copy_coefficient_from(other_.flt_1);
+        flt_1.res_original = other_.flt_1.res_original;
+        flt_1.force_update = other_.flt_1.force_update;
+        flt_2.copy_coefficient_from(other_.flt_2);
+        flt_2.res_original = other_.flt_2.res_original;
+        flt_2.force_update = other_.flt_2.force_update;
+    }
+
+    // BY TYPE
+    //==========================================================================
+    inline void update_filter_to(FILTER_TYPS type_) noexcept
+    {
+        if (last_filter_type != type_)
+        {
+            if (smooth_filter)
+            {
+                // SET THE SECOND FILTER TO THE OLD COMPLETE STATE
+                if (last_filter_type != PASS)
+                {
+                    smooth_filter->flt_1.copy_coefficient_from(flt_1);
+                    smooth_filter->flt_1.copy_state_from(flt_1);
+                    flt_1.force_update = true;
+
+                    smooth_filter->flt_2.copy_coefficient_from(flt_2);
+                    smooth_filter->flt_2.copy_state_from(flt_2);
+                    flt_2.force_update = true;
+                }
+                else
+                {
+                    flt_1.reset();
+                    flt_2.reset();
+                }
+                flt_1.force_update = true;
+                flt_2.force_update = true;
+
+                glide_time_4_filters = FILTER_CHANGE_GLIDE_TIME_MS;
+
+                smooth_filter->last_filter_type = last_filter_type;
+                smooth_filter_type = last_filter_type;
+            }
+
+            last_filter_type = type_;
+        }
+    }
+    // TRUE IF update_filter_to( type_ ) WOULD START OR CONTINUE THE FADE FROM THE LAST TYPE
+    inline bool is_changing_type(FILTER_TYPS type_) const noexcept
+    {
+        return last_filter_type != type_ || glide_time_4_filters > 0;
+    }
+    // THE FILTERS RUN AT factor_ TIMES THE SAMPLE RATE, A CHANGE RECALCULATES THE COEFFICIENTS
+    inline void set_oversampling(int factor_) noexcept
+    {
+        if (flt_1.oversampling != factor_)
+        {
+            flt_1.oversampling = flt_2.oversampling = float(factor_);
+            flt_1.force_update = flt_2.force_update = true;
+            if (smooth_filter)
+            {
+                smooth_filter->set_oversampling(factor_);
+            }
+        }
+    }
+    inline float process_filter_change(float original_in_, float result_in_) noexcept
+    {
+        if (glide_time_4_filters > 0)
+        {
+            // if( smooth_filter ) IS TRUE IF glide_time_4_filters != 0
+            {
+                const float smooth_out =
+                    smooth_filter->processByType(original_in_, smooth_filter_type);
+
+                float mix = 1.0f / float(FILTER_CHANGE_GLIDE_TIME_MS) * glide_time_4_filters;
+                result_in_ = result_in_ * (1.0f - mix) + smooth_out * mix;
+            }
+            --glide_time_4_filters;
+        }
+
+        return result_in_;
+    }
+    inline float processByType(float io_, FILTER_TYPS type_) noexcept
+    {
+        switch (type_)
+        {
+        case LPF:
+        case LPF_2_PASS:
+            io_ = processLow2Pass(io_);
+            break;
+        case HPF:
+        case HIGH_2_PASS:
+            io_ = processHigh2Pass(io_);
+            break;
+        case BPF:
+            io_ = processBand(io_);
+            break;
+        default /* PASS & UNKNOWN */:; // io_ = filter_hard_clipper(io_);
+        }
+
+        return io_;
+    }
+
+    //==========================================================================
+    // CLEARS THE FILTER STATES BUT KEEPS THE TYPE, SO THERE IS NO FADE AFTERWARDS
+    inline void clear_state() noexcept
+    {
+        flt_1.reset();
+        flt_2.reset();
+    }
+    inline void reset() noexcept
+    {
+        last_filter_type = UNKNOWN;
+        smooth_filter_type = UNKNOWN;
+        glide_time_4_filters = 0;
+        if (smooth_filter)
+        {
+            smooth_filter->reset();
+        }
+        flt_1.reset();
+        flt_2.reset();
+    }
+
+  public:
+    //==============================================================================
+    COLD DoubleAnalogFilter(RuntimeNotifyer *const notifyer_,
+                            bool create_smooth_filter = true) noexcept
+        : flt_1(notifyer_), flt_2(notifyer_),
+
+          smooth_filter(nullptr),
+
+          last_filter_type(UNKNOWN), smooth_filter_type(UNKNOWN),
+
+          glide_time_4_filters(0)
+    {
+        if (create_smooth_filter)
+        {
+            smooth_filter = new DoubleAnalogFilter(notifyer_, false);
+        }
+    }
+    COLD ~DoubleAnalogFilter() noexcept
+    {
+        if (smooth_filter)
+        {
+            delete smooth_filter;
+        }
+    }
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(DoubleAnalogFilter)
+};
+
+// OFFLINE RENDERS ALWAYS CALCULATE THE FILTER COEFFICIENTS PER SAMPLE
+inline int get_filter_coefficient_rate(const MoniqueSynthData *synth_data_) noexcept
+{
+    if (synth_data_->audio_processor && synth_data_->audio_processor->isNonRealtime())
+    {
+        return 1;
+    }
+    return synth_data_->filter_coefficient_rate;
+}
+
+// IN SAMPLES, OFFLINE RENDERS ALWAYS RUN THE SMOOTHERS AND LFOS PER SAMPLE
+inline int get_control_rate(const MoniqueSynthData *synth_data_) noexcept
+{
+    if (synth_data_->audio_processor && synth_data_->audio_processor->isNonRealtime())
+    {
+        return 1;
+    }
+    switch (int(synth_data_->control_rate))
+    {
+    case CONTROL_RATE_8:
+        return 8;
+    case CONTROL_RATE_16:
+        return 16;
+    case CONTROL_RATE_32:
+        return 32;
+    default:
+        return 1;
+    }
+}
+
+// 1, 2 OR 4, OFFLINE RENDERS USE THE RENDER SETTING. WITHOUT SIMD THERE IS NO OVERSAMPLING
+inline int get_filter_oversampling(const MoniqueSynthData *synth_data_, bool &is_render_) noexcept
+{
+    is_render_ = synth_data_->audio_processor && synth_data_->audio_processor->isNonRealtime();
+#if JUCE_USE_SIMD
+    switch (int(is_render_ ? synth_data_->render_filter_oversampling
+                           : synth_data_->filter_oversampling))
+    {
+    case FILTER_OVERSAMPLING_2X:
+        return 2;
+    case FILTER_OVERSAMPLING_4X:
+        return 4;
+    default:
+        return 1;
+    }
+#else
+    return 1;
+#endif
+}
+
+#if JUCE_USE_SIMD
+//==============================================================================
+//==============================================================================
+//==============================================================================
+// THE STATE OF ONE AnalogFilter PER SIMD LANE, ALL LANES USE THE COEFFICIENTS OF ONE FILTER
+class AnalogFilterLanes
+{
+    float_register y1, y2, y3, y4;
+    float_register oldx;
+    float_register oldy1, oldy2, oldy3;
+
+  public:
+    //==========================================================================
+    inline void load(const AnalogFilter &filter_, std::size_t lane_) noexcept
+    {
+        y1.set(lane_, filter_.y1);
+        y2.set(lane_, filter_.y2);
+        y3.set(lane_, filter_.y3);
+        y4.set(lane_, filter_.y4);
+        oldx.set(lane_, filter_.oldx);
+        oldy1.set(lane_, filter_.oldy1);
+        oldy2.set(lane_, filter_.oldy2);
+        oldy3.set(lane_, filter_.oldy3);
+    }
+    inline void store(AnalogFilter &filter_, std::size_t lane_) const noexcept
+    {
+        filter_.y1 = y1.get(lane_);
+        filter_.y2 = y2.get(lane_);
+        filter_.y3 = y3.get(lane_);
+        filter_.y4 = y4.get(lane_);
+        filter_.oldx = oldx.get(lane_);
+        filter_.oldy1 = oldy1.get(lane_);
+        filter_.oldy2 = oldy2.get(lane_);
+        filter_.oldy3 = oldy3.get(lane_);
+    }
+
+    //==========================================================================
+    // AnalogFilter::processLowResonance AND processHighResonance, SIMD MEANS FLUSH TO ZERO IS SET
+    template <int accuracy, bool is_high>
+    inline float_register process(float_register in_, const AnalogFilter &coefficients_) noexcept
+    {
+        const float_register p = float_register::expand(coefficients_.p);
+        const float_register k = float_register::expand(coefficients_.k);
+
+        const float_register x = in_ - float_register::expand(coefficients_.r) * y4;
+
+        // Four cascaded onepole filters (bilinear transform)
+        const float_register new_y1 = x * p + oldx * p - k * y1;
+        const float_register new_y2 = new_y1 * p + oldy1 * p - k * y2;
+        const float_register new_y3 = new_y2 * p + oldy2 * p - k * y3;
+        const float_register new_y4 = new_y3 * p + oldy3 * p - k * y4;
+
+        // Clipper band limited sigmoid
+        y4 = new_y4 - new_y4 * new_y4 * new_y4 * (1.0f / 6);
+
+        oldx = x;
+        oldy1 = y1 = new_y1;
+        oldy2 = y2 = new_y2;
+        oldy3 = y3 = new_y3;
+
+        return is_high ? clip_to(x - y4, -1, 1)
+                       : soft_clipp_greater_fast<accuracy>(
+                             sample_mix(y4, y3 * float_register::expand(coefficients_.res)), 1,
+                             1.2f);
+    }
+
+    //==========================================================================
+    COLD AnalogFilterLanes() noexcept
+        : y1(float_register::expand(0)), y2(float_register::expand(0)),
+          y3(float_register::expand(0)), y4(float_register::expand(0)),
+          oldx(float_register::expand(0)), oldy1(float_register::expand(0)),
+          oldy2(float_register::expand(0)), oldy3(float_register::expand(0))
+    {
+    }
+};
+
+//==============================================================================
+// UP TO ONE DoubleAnalogFilter OF THE SAME TYPE PER SIMD LANE. THE STATES ARE LOADED BEFORE AND
+// STORED BACK AFTER EACH BLOCK, THE FIRST FILTER CALCULATES THE COEFFICIENTS
+class DoubleAnalogFilterLanes
+{
+    DoubleAnalogFilter *const *filters;
+    int num_filters;
+
+    AnalogFilterLanes flt_1;
+    AnalogFilterLanes flt_2;
+
+  public:
+    //==========================================================================
+    // type_ IS LPF_2_PASS, HIGH_2_PASS OR BPF, THE FILTERS MUST NOT CHANGE THEIR TYPE
+    template <int accuracy>
+    inline void process(FILTER_TYPS type_, const float *const resonance_,
+                        const float *const cutoff_, const int coefficient_rate_,
+                        const float *const *const ins_, float *const *const outs_,
+                        const int num_samples_) noexcept
+    {
+        DoubleAnalogFilter &coefficients = *filters[0];
+        alignas(float_register::SIMDRegisterSize) float samples[float_register::SIMDNumElements] =
+            {};
+        for (int first_sid = 0; first_sid < num_samples_; first_sid += coefficient_rate_)
+        {
+            const int end_sid = juce::jmin(first_sid + coefficient_rate_, num_samples_);
+            const int num_steps = end_sid - first_sid;
+            switch (type_)
+            {
+            case HIGH_2_PASS:
+                coefficients.glideHigh2Pass(resonance_[end_sid - 1], cutoff_[end_sid - 1],
+                                            num_steps);
+                break;
+            case BPF:
+                coefficients.glideBand(resonance_[end_sid - 1], cutoff_[end_sid - 1], num_steps);
+                break;
+            default /* LPF_2_PASS */:
+                coefficients.glideLow2Pass(resonance_[end_sid - 1], cutoff_[end_sid - 1],
+                                           num_steps);
+            }
+
+            for (int sid = first_sid; sid != end_sid; ++sid)
+            {
+                coefficients.step_coefficients();
+
+                for (int lane = 0; lane != num_filters; ++lane)
+                {
+                    samples[lane] = ins_[lane][sid];
+                }
+                float_register io = float_register::fromRawArray(samples);
+                switch (type_)
+                {
+                case HIGH_2_PASS:
+                    io = flt_1.process<accuracy, true>(
+                        soft_clipp_greater_fast<accuracy>(io, 1, 1.2f), coefficients.flt_1);
+                    break;
+                case BPF:
+                    io = flt_1.process<accuracy, false>(
+                             flt_2.process<accuracy, true>(io, coefficients.flt_2),
+                             coefficients.flt_1) *
+                         2.0f;
+                    break;
+                default /* LPF_2_PASS */:
+                {
+                    const float_register out =
+                        flt_2.process<accuracy, false>(io, coefficients.flt_2);
+                    io = sample_mix(out,
+                                    flt_1.process<accuracy, false>(out, coefficients.flt_1));
+                }
+                }
+                io.copyToRawArray(samples);
+                for (int lane = 0; lane != num_filters; ++lane)
+                {
+                    outs_[lane][sid] = samples[lane];
+                }
+            }
+        }
+    }
+
+    //==========================================================================
+    inline void load(DoubleAnalogFilter *const *const filters_, const int num_filters_) noexcept
+    {
+        jassert(num_filters_ <= int(float_register::SIMDNumElements));
+        filters = filters_;
+        num_filters = num_filters_;
+        for (int lane = 0; lane != num_filters; ++lane)
+        {
+            flt_1.load(filters[lane]->flt_1, std::size_t(lane));
+            flt_2.load(filters[lane]->flt_2, std::size_t(lane));
+        }
+    }
+    inline void store() noexcept
+    {
+        for (int lane = 0; lane != num_filters; ++lane)
+        {
+            flt_1.store(filters[lane]->flt_1, std::size_t(lane));
+            flt_2.store(filters[lane]->flt_2, std::size_t(lane));
+            if (lane != 0)
+            {
+                filters[lane]->copy_coefficients_from(*filters[0]);
+            }
+        }
+    }
+
+    //==========================================================================
+    COLD DoubleAnalogFilterLanes() noexcept : filters(nullptr), num_filters(0) {}
+    COLD ~DoubleAnalogFilterLanes() noexcept {}
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(DoubleAnalogFilterLanes)
+};
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+// A POLYPHASE IIR HALF BAND FILTER FOR ONE CHANNEL PER SIMD LANE. TWO CHAINS OF FIRST
+// ORDER ALLPASSES, THE EVEN COEFFICIENTS BUILD THE FIRST CHAIN AND THE ODD ONES THE SECOND
+#define MAX_HALF_BAND_COEFFICIENTS 12
+class HalfBandLanes
+{
+    float_register coefficients[MAX_HALF_BAND_COEFFICIENTS];
+    float_register states[MAX_HALF_BAND_COEFFICIENTS];
+    float_register delayed; // THE LAST ODD INPUT OF THE DOWNSAMPLER
+    int num_coefficients;
+
+    inline float_register process_chain(float_register io_, const int first_) noexcept
+    {
+        for (int i = first_; i < num_coefficients; i += 2)
+        {
+            const float_register out = coefficients[i] * io_ + states[i];
+            states[i] = io_ - coefficients[i] * out;
+            io_ = out;
+        }
+        return io_;
+    }
+    inline void undenormalise_states() noexcept
+    {
+        const float_register min = float_register::expand(-1.0e-15f);
+        const float_register max = float_register::expand(1.0e-15f);
+        for (int i = 0; i != num_coefficients; ++i)
+        {
+            states[i] = states[i] & (float_register::lessThan(states[i], min) |
+                                     float_register::greaterThan(states[i], max));
+        }
+    }
+
+  public:
+    //==========================================================================
+    // num_samples_ IN, 2 * num_samples_ OUT
+    inline void upsample(const float *const *const ins_, float *const *const outs_,
+                         const int num_lanes_, const int num_samples_) noexcept
+    {
+        jassert(num_lanes_ <= int(float_register::SIMDNumElements));
+        alignas(float_register::SIMDRegisterSize) float even[float_register::SIMDNumElements] = {};
+        alignas(float_register::SIMDRegisterSize) float odd[float_register::SIMDNumElements] = {};
+        for (int sid = 0; sid != num_samples_; ++sid)
+        {
+            for (int lane = 0; lane != num_lanes_; ++lane)
+            {
+                even[lane] = ins_[lane][sid];
+            }
+            const float_register in = float_register::fromRawArray(even);
+            process_chain(in, 0).copyToRawArray(even);
+            process_chain(in, 1).copyToRawArray(odd);
+            for (int lane = 0; lane != num_lanes_; ++lane)
+            {
+                outs_[lane][sid * 2] = even[lane];
+                outs_[lane][sid * 2 + 1] = odd[lane];
+            }
+        }
+        undenormalise_states();
+    }
+    // 2 * num_samples_ IN, num_samples_ OUT
+    inline void downsample(const float *const *const ins_, float *const *const outs_,
+                           const int num_lanes_, const int num_samples_) noexcept
+    {
+        jassert(num_lanes_ <= int(float_register::SIMDNumElements));
+        alignas(float_register::SIMDRegisterSize) float even[float_register::SIMDNumElements] = {};
+        alignas(float_register::SIMDRegisterSize) float odd[float_register::SIMDNumElements] = {};
+        for (int sid = 0; sid != num_samples_; ++sid)
+        {
+            for (int lane = 0; lane != num_lanes_; ++lane)
+            {
+                even[lane] = ins_[lane][sid * 2];
+                odd[lane] = ins_[lane][sid * 2 + 1];
+            }
+            const float_register out =
+                (process_chain(float_register::fromRawArray(even), 0) + process_chain(delayed, 1)) *
+                0.5f;
+            delayed = float_register::fromRawArray(odd);
+            out.copyToRawArray(even);
+            for (int lane = 0; lane != num_lanes_; ++lane)
+            {
+                outs_[lane][sid] = even[lane];
+            }
+        }
+        undenormalise_states();
+    }
+
+    //==========================================================================
+    inline void set_coefficients(const float *const coefficients_,
+                                 const int num_coefficients_) noexcept
+    {
+        jassert(num_coefficients_ <= MAX_HALF_BAND_COEFFICIENTS);
+        num_coefficients = num_coefficients_;
+        for (int i = 0; i != num_coefficients; ++i)
+        {
+            coefficients[i] = float_register::expand(coefficients_[i]);
+            states[i] = float_register::expand(0);
+        }
+        delayed = float_register::expand(0);
+    }
+
+    //==========================================================================
+    // ELLIPTIC DESIGN AFTER LAURENT DE SORAS' HIIR, transition_ IS THE TRANSITION BAND RELATIVE
+    // TO THE HIGHER SAMPLE RATE, CENTERED AT A QUARTER OF IT
+    static COLD void design(float *const coefficients_, const int num_coefficients_,
+                            const double transition_) noexcept
+    {
+        const double pi = juce::MathConstants<double>::pi;
+        double k = std::tan((1 - transition_ * 2) * pi / 4);
+        k *= k;
+        const double kk = std::pow(1 - k * k, 0.25);
+        const double e = 0.5 * (1 - kk) / (1 + kk);
+        const double e4 = e * e * e * e;
+        const double q = e * (1 + e4 * (2 + e4 * (15 + 150 * e4)));
+        const int order = num_coefficients_ * 2 + 1;
+
+        for (int i = 0; i != num_coefficients_; ++i)
+        {
+            const int c = i + 1;
+            double num = 0;
+            for (int n = 0, sign = 1;; ++n, sign = -sign)
+            {
+                const double term =
+                    std::pow(q, n * (n + 1)) * std::sin((n * 2 + 1) * c * pi / order);
+                num += term * sign;
+                if (std::abs(term) < 1e-100)
+                {
+                    break;
+                }
+            }
+            double den = 0.5;
+            for (int n = 1, sign = -1;; ++n, sign = -sign)
+            {
+                const double term = std::pow(q, n * n) * std::cos(n * 2 * c * pi / order);
+                den += term * sign;
+                if (std::abs(term) < 1e-100)
+                {
+                    break;
+                }
+            }
+            const double ww = num * std::pow(q, 0.25) / den;
+            const double ww2 = ww * ww;
+            const double x = std::sqrt((1 - ww2 * k) * (1 - ww2 / k)) / (1 + ww2);
+            coefficients_[i] = float((1 - x) / (1 + x));
+        }
+    }
+
+    //==========================================================================
+    COLD HalfBandLanes() noexcept : delayed(float_register::expand(0)), num_coefficients(0)
+    {
+        for (int i = 0; i != MAX_HALF_BAND_COEFFICIENTS; ++i)
+        {
+            coefficients[i] = float_register::expand(0);
+            states[i] = float_register::expand(0);
+        }
+    }
+};
+
+//==============================================================================
+// 2X OR 4X WITH TWO CASCADED HALF BANDS. THE STEEP ONE RUNS AT THE LOWER RATE AND HAS 8
+// COEFFICIENTS LIVE (-106DB) AND 12 IN RENDERS (-123DB), THE 4X STAGE NEEDS ONLY 4 (-100DB)
+class FilterOversampler
+{
+    HalfBandLanes up[2];   // 1X TO 2X AND 2X TO 4X
+    HalfBandLanes down[2]; // 2X TO 1X AND 4X TO 2X
+
+    float realtime_coefficients[8];
+    float render_coefficients[12];
+    float second_stage_coefficients[4];
+
+    int factor;
+    bool is_render;
+
+  public:
+    //==========================================================================
+    // A CHANGE CLEARS THE HALF BAND STATES
+    inline void set_mode(const int factor_, const bool is_render_) noexcept
+    {
+        if (factor == factor_ && is_render == is_render_)
+        {
+            return;
+        }
+        factor = factor_;
+        is_render = is_render_;
+
+        const float *const coefficients = is_render ? render_coefficients : realtime_coefficients;
+        const int num_coefficients = is_render ? 12 : 8;
+        up[0].set_coefficients(coefficients, num_coefficients);
+        down[0].set_coefficients(coefficients, num_coefficients);
+        up[1].set_coefficients(second_stage_coefficients, 4);
+        down[1].set_coefficients(second_stage_coefficients, 4);
+    }
+    inline int get_factor() const noexcept { return factor; }
+
+    //==========================================================================
+    // ins_ HOLD num_samples_, outs_ factor * num_samples_ AND tmp_ 2 * num_samples_ AT 4X
+    inline void upsample(const float *const *const ins_, float *const *const outs_,
+                         float *const *const tmp_, const int num_lanes_,
+                         const int num_samples_) noexcept
+    {
+        if (factor == 2)
+        {
+            up[0].upsample(ins_, outs_, num_lanes_, num_samples_);
+        }
+        else
+        {
+            up[0].upsample(ins_, tmp_, num_lanes_, num_samples_);
+            up[1].upsample(tmp_, outs_, num_lanes_, num_samples_ * 2);
+        }
+    }
+    // ins_ HOLD factor * num_samples_, outs_ num_samples_ AND tmp_ 2 * num_samples_ AT 4X
+    inline void downsample(const float *const *const ins_, float *const *const outs_,
+                           float *const *const tmp_, const int num_lanes_,
+                           const int num_samples_) noexcept
+    {
+        if (factor == 2)
+        {
+            down[0].downsample(ins_, outs_, num_lanes_, num_samples_);
+        }
+        else
+        {
+            down[1].downsample(ins_, tmp_, num_lanes_, num_samples_ * 2);
+            down[0].downsample(tmp_, outs_, num_lanes_, num_samples_);
+        }
+    }
+
+    //==========================================================================
+    COLD FilterOversampler() noexcept : factor(1), is_render(false)
+    {
+        HalfBandLanes::design(realtime_coefficients, 8, 0.05);
+        HalfBandLanes::design(render_coefficients, 12, 0.02);
+        HalfBandLanes::design(second_stage_coefficients, 4, 0.2);
+    }
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(FilterOversampler)
+};
+#endif
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+class AllPassFilter
+{
+    juce::HeapBlock<float> buffer;
+    int bufferSize, bufferIndex;
+
+  public:
+    //==============================================================================
+    inline float process(const float input) noexcept
+    {
+        const float bufferedValue = buffer[bufferIndex];
+        float temp = input + (bufferedValue * 0.5f);
+        JUCE_UNDENORMALISE(temp);
+        buffer[bufferIndex] = temp;
+        bufferIndex = (bufferIndex + 1) % bufferSize;
+
+        return bufferedValue - input;
+    }
+    // process() FOR A BLOCK IN PLACE. THE BUFFER IS WALKED IN SPANS UP TO ITS END, INSIDE A SPAN NO
+    // SAMPLE DEPENDS ON ANOTHER ONE, SO THE LOOP VECTORISES
+    inline void process_block(float *const io_, const int num_samples_) noexcept
+    {
+        for (int sid = 0; sid != num_samples_;)
+        {
+            const int span = juce::jmin(num_samples_ - sid, bufferSize - bufferIndex);
+            float *const line = buffer + bufferIndex;
+            float *const io = io_ + sid;
+            for (int i = 0; i != span; ++i)
+            {
+                const float bufferedValue = line[i];
+                float temp = io[i] + (bufferedValue * 0.5f);
+                JUCE_UNDENORMALISE(temp);
+                line[i] = temp;
+                io[i] = bufferedValue - io[i];
+            }
+            bufferIndex = (bufferIndex + span) % bufferSize;
+            sid += span;
+        }
+    }
+
+    //==============================================================================
+    COLD void setSize(const int size)
+    {
+        if (size != bufferSize)
+        {
+            bufferIndex = 0;
+            buffer.malloc((size_t)size);
+            bufferSize = size;
+        }
+
+        clear();
+    }
+    COLD void clear() noexcept { buffer.clear((size_t)bufferSize); }
+    COLD std::size_t get_memory_usage() const noexcept { return bufferSize * sizeof(float); }
+
+  public:
+    //==============================================================================
+    COLD AllPassFilter() noexcept : bufferSize(0), bufferIndex(0) {}
+    COLD ~AllPassFilter() noexcept {}
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(AllPassFilter)
+};
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+class mono_Chorus : public RuntimeListener
+{
+    MoniqueSynthData *const synth_data;
+    ChorusData *const chorus_data;
+
+    mono_SineWaveAutonom osc_1;
+    mono_SineWaveAutonom osc_2;
+    mono_SineWaveAutonom osc_3;
+    mono_SineWaveAutonom osc_4;
+    mono_SineWaveAutonom osc_5;
+
+    int buffer_size;
+    int index;
+    mono_AudioSampleBuffer<2> data_buffer;
+    float *current_left_buffer;
+    float *current_right_buffer;
+
+    TailBypass tail;
+
+  public:
+#define SUM_DELAY_LINES 4
+#define CHECK_MAKE_INDEX_VALID(floated_index_, size_)                                              \
+    if (floated_index_ >= size_)                                                                   \
+    {                                                                                              \
+        floated_index_ -= size_;                                                                   \
+    }                                                                                              \
+    else if (floated_index_ < 0)                                                                   \
+    {                                                                                              \
+        floated_index_ += size_;                                                                   \
+    }
+    // THE SUM OF THE FOUR INTERPOLATED TAPS, EACH WEIGHTED WITH 1/(i+2). buffer_[buffer_size] IS A
+    // COPY OF buffer_[0], SO THE SECOND INDEX OF THE INTERPOLATION NEVER WRAPS
+    inline float process_taps(const float *const buffer_,
+                              const float (&delays_)[SUM_DELAY_LINES]) const noexcept
+    {
+#if JUCE_USE_SIMD
+        // THE TAPS FILL WHOLE REGISTERS, THE LANES AFTER THE LAST TAP HAVE NO DELAY AND WEIGHT 0
+        constexpr int num_lanes = int(float_register::SIMDNumElements);
+        constexpr int num_lane_taps = (SUM_DELAY_LINES + num_lanes - 1) / num_lanes * num_lanes;
+        alignas(float_register::SIMDRegisterSize) static const float weights[num_lane_taps] = {
+            1.0f / 2, 1.0f / 3, 1.0f / 4, 1.0f / 5};
+        alignas(float_register::SIMDRegisterSize) float indices[num_lane_taps] = {};
+        alignas(float_register::SIMDRegisterSize) float firsts[num_lane_taps];
+        alignas(float_register::SIMDRegisterSize) float seconds[num_lane_taps];
+        for (int i = 0; i != SUM_DELAY_LINES; ++i)
+        {
+            indices[i] = delays_[i];
+        }
+
+        const float_register size = float_register::expand(float(buffer_size));
+        float result = 0;
+        for (int first_tap = 0; first_tap != num_lane_taps; first_tap += num_lanes)
+        {
+            float_register float_index = float_register::expand(float(index)) -
+                                         float_register::fromRawArray(indices + first_tap) + 1.0f;
+            float_index =
+                float_index - (size & float_register::greaterThanOrEqual(float_index, size)) +
+                (size & float_register::lessThan(float_index, float_register::expand(0)));
+
+            // THE INDEX IS NOT NEGATIVE ANYMORE, SO THE CAST FLOORS
+            float_index.copyToRawArray(indices + first_tap);
+            for (int i = first_tap; i != first_tap + num_lanes; ++i)
+            {
+                const int index_1 = int(indices[i]);
+                firsts[i] = buffer_[index_1];
+                seconds[i] = buffer_[index_1 + 1];
+                indices[i] -= index_1;
+            }
+            const float_register delta = float_register::fromRawArray(indices + first_tap);
+            const float_register taps =
+                (float_register::fromRawArray(firsts + first_tap) *
+                     (float_register::expand(1) - delta) +
+                 float_register::fromRawArray(seconds + first_tap) * delta) *
+                float_register::fromRawArray(weights + first_tap);
+            for (std::size_t lane = 0; lane != float_register::SIMDNumElements; ++lane)
+            {
+                result += taps.get(lane);
+            }
+        }
+        return result;
+#else
+        float result = 0;
+        for (int i = 0; i != SUM_DELAY_LINES; ++i)
+        {
+            float float_index = float(index) - delays_[i] + 1;
+            CHECK_MAKE_INDEX_VALID(float_index, buffer_size)
+
+            const int index_1 = int(float_index);
+            const float delta = float_index - index_1;
+            result += (buffer_[index_1] * (1.0f - delta) + buffer_[index_1 + 1] * delta) / (i + 2);
+        }
+        return result;
+#endif
+    }
+    inline void write(float *const buffer_, float sample_) const noexcept
+    {
+        buffer_[index] = sample_;
+        if (index == 0)
+        {
+            buffer_[buffer_size] = sample_;
+        }
+    }
+
+    inline void process(float *left_in_, float *right_in_, float *left_out_, float *right_out_,
+                        int num_samples_) noexcept
+    {
+        const float *const chorus_env_buffer(
+            chorus_data->modulation_smoother.get_smoothed_value_buffer());
+        const bool is_stereo = synth_data->is_stereo;
+
+        // WITHOUT INPUT AND A DECAYED TAIL ONLY THE DRY PART IS LEFT
+        const bool input_is_silent = is_silent_block(left_in_, num_samples_) &&
+                                     (!is_stereo || is_silent_block(right_in_, num_samples_));
+        if (tail.can_skip(input_is_silent))
+        {
+            for (int sid = 0; sid != num_samples_; ++sid)
+            {
+                const float fade_in = 1.0f - (juce::jmin(1.0f, chorus_env_buffer[sid] * 0.8f * 2));
+                left_out_[sid] = left_in_[sid] * fade_in;
+                if (is_stereo)
+                {
+                    right_out_[sid] = right_in_[sid] * fade_in;
+                }
+            }
+            return;
+        }
+
+        const float *const smoothed_pan_buffer(
+            chorus_data->pan_smoother.get_smoothed_value_buffer());
+        float *const left_gains = synth_data->data_buffer->pan_gains.getWritePointer(LEFT);
+        float *const right_gains = synth_data->data_buffer->pan_gains.getWritePointer(RIGHT);
+        pan_block(smoothed_pan_buffer, left_gains, right_gains, num_samples_);
+
+        const float e_samples = sample_rate / 164.81; // 82.41;
+        const float e2_samples = sample_rate / 165.91;
+        for (int sid = 0; sid != num_samples_; ++sid)
+        {
+            // const float power = (exp( (chorus_env_buffer[sid] *0.85f) *2)-1)/6.38906;
+            const float power = chorus_env_buffer[sid] * 0.8f;
+            // THE OSCS ARE TICKED ONCE FOR BOTH SIDES
+            const float amps[SUM_DELAY_LINES] = {
+                ((osc_1.tick() * 0.7f + osc_2.tick() * 0.3f) + 1) * 0.5f,
+                ((osc_1.lastOut_with_phase_offset(0.25f) * 0.3f + osc_3.tick() * 0.6f) + 1) * 0.5f,
+                ((osc_1.lastOut_with_phase_offset(0.5f) * 0.4f + osc_4.tick() * 0.5f) + 1) * 0.5f,
+                ((osc_1.lastOut_with_phase_offset(0.75f) * 0.6f + osc_5.tick() * 0.4f) + 1) * 0.5f};
+            const float delay_scale = power * 0.9 + 0.1;
+
+            // L
+            const float fade_in = 1.0f - (juce::jmin(1.0f, power * 2));
+            const float fade_effect = (juce::jmin(1.0f, power * 2));
+            {
+                float delays[SUM_DELAY_LINES];
+                for (int i = 0; i != SUM_DELAY_LINES; ++i)
+                {
+                    delays[i] = delay_scale * e_samples * amps[i];
+                }
+                const float result_l = process_taps(current_left_buffer, delays);
+                write(current_left_buffer,
+                      sample_mix(left_in_[sid], result_l * power * left_gains[sid]));
+                left_out_[sid] = left_in_[sid] * fade_in + result_l * fade_effect;
+            }
+            // R
+            if (is_stereo)
+            {
+                float delays[SUM_DELAY_LINES];
+                for (int i = 0; i != SUM_DELAY_LINES; ++i)
+                {
+                    delays[i] = delay_scale * e2_samples * amps[i];
+                }
+                const float result_r = process_taps(current_right_buffer, delays);
+                write(current_right_buffer,
+                      sample_mix(right_in_[sid], result_r * power * right_gains[sid]));
+                right_out_[sid] = right_in_[sid] * fade_in + result_r * fade_effect;
+            }
+
+            index = (index + 1) % buffer_size;
+        }
+
+        const bool output_is_silent = is_silent_block(left_out_, num_samples_) &&
+                                      (!is_stereo || is_silent_block(right_out_, num_samples_));
+        if (tail.settle(input_is_silent, output_is_silent, buffer_size, num_samples_))
+        {
+            reset();
+        }
+    }
+
+    inline void reset() noexcept { data_buffer.clear(); }
+    //==============================================================================
+    COLD void sample_rate_or_block_changed() noexcept override
+    {
+        buffer_size = sample_rate / 82.41;
+        // ONE MORE FOR THE COPY OF THE FIRST SAMPLE
+        data_buffer.setSize(buffer_size + 1, false);
+        data_buffer.clear();
+
+        current_left_buffer = data_buffer.getWritePointer(LEFT);
+        current_right_buffer = data_buffer.getWritePointer(RIGHT);
+    }
+
+  public:
+    COLD std::size_t get_memory_usage() const noexcept { return data_buffer.get_memory_usage(); }
+
+  public:
+    //==============================================================================
+    COLD mono_Chorus(RuntimeNotifyer *const notifyer_, MoniqueSynthData *const synth_data_) noexcept
+        : RuntimeListener(notifyer_),
+
+          synth_data(synth_data_),
+
+          chorus_data(synth_data_->chorus_data.get()), osc_1(notifyer_, synth_data_->sine_lookup),
+          osc_2(notifyer_, synth_data_->sine_lookup), osc_3(notifyer_, synth_data_->sine_lookup),
+          osc_4(notifyer_, synth_data_->sine_lookup),
+
+          osc_5(notifyer_, synth_data_->sine_lookup), buffer_size(1), index(0),
+
+          data_buffer(buffer_size)
+    {
+        sample_rate_or_block_changed();
+        osc_1.set_frequency(0.4);
+        osc_2.set_frequency(0.6);
+        osc_3.set_frequency(0.55);
+        osc_4.set_frequency(0.5);
+        osc_5.set_frequency(0.45);
+    }
+    COLD ~mono_Chorus() noexcept {}
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(mono_Chorus)
+};
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+class mono_Delay : public RuntimeListener
+{
+    const MoniqueSynthData *synth_data;
+    RuntimeInfo *info;
+
+    double last_bmp_in;
+
+    int reflexion_write_index;
+    int last_in_reflexion_size;
+    int reflexion;
+    int current_reflexion;
+    int reflexion_buffer_size;
+    int current_reflexion_buffer_size;
+    mono_AudioSampleBuffer<2> reflexion_buffer;
+    float *active_left_reflexion_buffer;
+    float *active_right_reflexion_buffer;
+
+    int record_index;
+    int last_in_record_size;
+    int record_buffer_size;
+    int real_record_buffer_size;
+    int num_records_to_write;
+    mono_AudioSampleBuffer<2> record_buffer;
+    float *active_left_record_buffer;
+    float *active_right_record_buffer;
+    bool force_clear;
+
+    LinearSmootherMinMax<0, 1> record_switch_smoother;
+
+    TailBypass tail;
+
+  public:
+    //==============================================================================
+    inline void set_reflexion_size(int reflexion_in_size_, int record_buffer_size_,
+                                   int glide_time_in_ms_, double bpm_) noexcept
+    {
+        // SETUP THE REFLEXION BUFFER
+        if (bpm_ < 20)
+        {
+            return;
+        }
+
+        bool bpm_changed = last_bmp_in != bpm_;
+        last_bmp_in = bpm_;
+
+        if (bpm_changed || last_in_reflexion_size != reflexion_in_size_)
+        {
+            last_in_reflexion_size = reflexion_in_size_;
+            update_reflexion_stuff(bpm_);
+        }
+        if (bpm_changed || last_in_record_size != record_buffer_size_)
+        {
+            last_in_record_size = record_buffer_size_;
+            update_record_stuff(bpm_);
+        }
+
+        // TODO ATTENTION FIX, do not clear! -> but if not crash on sample rate changes
+        /*
+        if( bpm_changed )
+        {
+            reflexion_write_index = 0;
+            current_reflexion = reflexion;
+            reflexion_buffer.clear();
+            record_buffer.clear();
+            record_switch_smoother.set_value(0);
+            record_switch_smoother.reset_glide_countdown();
+            record_switch_smoother.reset(sample_rate,glide_time_in_ms_);
+        }
+        */
+
+        record_switch_smoother.reset_coefficients(sample_rate, juce::jmax(200, glide_time_in_ms_));
+    }
+
+    //==============================================================================
+  private:
+    inline void update_reflexion_stuff(double bpm_) noexcept
+    {
+        // CALCULATE THE NEEDED SIZE
+        {
+            const double speed_multi = delay_multi(last_in_reflexion_size);
+            const double bars_per_sec = bpm_ / 4 / 60;
+            const double samples_per_bar = (1.0f / bars_per_sec) * sample_rate;
+            reflexion_buffer_size = floor(samples_per_bar);
+            reflexion = samples_per_bar * speed_multi;
+        }
+        if (reflexion_buffer.get_size() < reflexion_buffer_size)
+        {
+            reflexion_buffer.setSize(reflexion_buffer_size, true);
+            active_left_reflexion_buffer = reflexion_buffer.getWritePointer(LEFT);
+            active_right_reflexion_buffer = reflexion_buffer.getWritePointer(RIGHT);
+        }
+    }
+    inline void update_record_stuff(double bpm_) noexcept
+    {
+        // CALCULATE THE NEEDED SIZE
+        {
+            num_records_to_write = delay_multi(last_in_record_size); // 1, 2 or 4
+            const double bars_per_sec = bpm_ / 4 / 60;
+            const double samples_per_bar = (1.0f / bars_per_sec) * sample_rate;
+            real_record_buffer_size = samples_per_bar * 4;
+            record_buffer_size = samples_per_bar;
+            // TODO change the record index only on zero
+        }
+        if (record_buffer.get_size() < real_record_buffer_size)
+        {
+            record_buffer.setSize(real_record_buffer_size, true);
+            active_left_record_buffer = record_buffer.getWritePointer(LEFT);
+            active_right_record_buffer = record_buffer.getWritePointer(RIGHT);
+        }
+    }
+
+  private:
+    //==============================================================================
+    inline int update_get_reflexion_read_index() noexcept
+    {
+        if (current_reflexion < reflexion)
+        {
+            current_reflexion += 2;
+            if (current_reflexion > reflexion)
+            {
+                current_reflexion = reflexion;
+            }
+        }
+        else if (current_reflexion > reflexion)
+        {
+            --current_reflexion;
+        }
+
+        if (current_reflexion_buffer_size < reflexion_buffer_size)
+        {
+            current_reflexion_buffer_size += 2;
+            if (current_reflexion_buffer_size > reflexion_buffer_size)
+            {
+                current_reflexion_buffer_size = reflexion_buffer_size;
+            }
+        }
+        else if (current_reflexion_buffer_size > reflexion_buffer_size)
+        {
+            --current_reflexion_buffer_size;
+        }
+
+        int read_index = reflexion_write_index - current_reflexion;
+        while (read_index < 0)
+        {
+            read_index += current_reflexion_buffer_size;
+        }
+        return read_index;
+    }
+
+  public:
+    //==============================================================================
+    inline void process(float *const io_l, float *const io_r, const float *smoothed_power_,
+                        const float *smoothed_pan_buffer_, const float *record_release_buffer_,
+                        bool record_, const int num_samples_) noexcept
+    {
+        // PREPARE RECORDING
+        record_ = force_clear ? false : record_;
+        if (!record_)
+        {
+            record_switch_smoother.set_value(false);
+            record_switch_smoother.reset_glide_countdown();
+        }
+
+        // WITHOUT INPUT AND RECORDING THE BUFFERS ONLY HOLD A DECAYED TAIL, SO THE INPUT PASSES
+        const bool is_stereo = synth_data->is_stereo;
+        const bool input_is_silent = !record_ && !force_clear &&
+                                     record_switch_smoother.is_up_to_date() &&
+                                     is_silent_block(io_l, num_samples_) &&
+                                     (!is_stereo || is_silent_block(io_r, num_samples_));
+        if (tail.can_skip(input_is_silent))
+        {
+            return;
+        }
+        process_reflexions_and_records(io_l, io_r, smoothed_power_, smoothed_pan_buffer_,
+                                       record_release_buffer_, record_, num_samples_);
+        tail.settle(input_is_silent,
+                    is_silent_block(io_l, num_samples_) &&
+                        (!is_stereo || is_silent_block(io_r, num_samples_)),
+                    get_max_duration(), num_samples_);
+    }
+
+  private:
+    //==============================================================================
+    inline void process_reflexions_and_records(float *const io_l, float *const io_r,
+                                               const float *smoothed_power_,
+                                               const float *smoothed_pan_buffer_,
+                                               const float *record_release_buffer_, bool record_,
+                                               const int num_samples_) noexcept
+    {
+        // CURRENT INPUT AND REFLEXION OF USER SIZE
+        if (synth_data->is_stereo)
+        {
+            float *const left_gains = synth_data->data_buffer->pan_gains.getWritePointer(LEFT);
+            float *const right_gains = synth_data->data_buffer->pan_gains.getWritePointer(RIGHT);
+            pan_block(smoothed_pan_buffer_, left_gains, right_gains, num_samples_);
+            for (int sid = 0; sid != num_samples_; ++sid)
+            {
+                // REFLEXION AND INPUT
+                const int reflexion_read_index = update_get_reflexion_read_index();
+
+                const float left_reflexion_and_input_mix =
+                    sample_mix(active_left_reflexion_buffer[reflexion_read_index], io_l[sid]);
+                const float right_reflexion_and_input_mix =
+                    sample_mix(active_right_reflexion_buffer[reflexion_read_index], io_r[sid]);
+                {
+                    const float power = smoothed_power_[sid];
+
+                    const float left = left_gains[sid];
+                    const float right = right_gains[sid];
+                    // SWAPPED L AND R HERE - Must be wrong somethere else
+                    active_left_reflexion_buffer[reflexion_write_index] =
+                        left_reflexion_and_input_mix * power * right;
+                    active_right_reflexion_buffer[reflexion_write_index] =
+                        right_reflexion_and_input_mix * power * left;
+                }
+
+                // RECORD AND MIX BEFORE
+                {
+                    float record_power = 0;
+                    if (record_)
+                    {
+                        record_power = record_switch_smoother.glide_tick(true);
+                    }
+                    else if (!record_switch_smoother.is_up_to_date())
+                    {
+                        record_power = record_switch_smoother.tick();
+                    }
+
+                    const float left_record = active_left_record_buffer[record_index];
+                    const float right_record = active_right_record_buffer[record_index];
+                    if (record_power > 0)
+                    {
+                        const float record_release = record_release_buffer_[sid];
+                        const float left_record_feedback =
+                            left_reflexion_and_input_mix * record_power;
+                        const float right_record_feedback =
+                            right_reflexion_and_input_mix * record_power;
+                        if (num_records_to_write > 2)
+                        {
+                            active_left_record_buffer[record_index] =
+                                sample_mix(left_record, left_record_feedback) * record_release;
+                            active_right_record_buffer[record_index] =
+                                sample_mix(right_record, right_record_feedback) * record_release;
+                        }
+                        else if (num_records_to_write == 1)
+                        {
+                            const int record_index_1 = record_index;
+                            int record_index_2 = record_index_1 + record_buffer_size;
+                            if (record_index_2 >= real_record_buffer_size)
+                            {
+                                record_index_2 -= real_record_buffer_size;
+                            }
+                            int record_index_3 = record_index_2 + record_buffer_size;
+                            if (record_index_3 >= real_record_buffer_size)
+                            {
+                                record_index_3 -= real_record_buffer_size;
+                            }
+                            int record_index_4 = record_index_3 + record_buffer_size;
+                            if (record_index_4 >= real_record_buffer_size)
+                            {
+                                record_index_4 -= real_record_buffer_size;
+                            }
+
+                            active_left_record_buffer[record_index_1] =
+                                sample_mix(left_record, left_record_feedback) * record_release;
+                            active_right_record_buffer[record_index_1] =
+                                sample_mix(right_record, right_record_feedback) * record_release;
+                            active_left_record_buffer[record_index_2] =
+                                sample_mix(active_left_record_buffer[record_index_2],
+                                           left_record_feedback) *
+                                record_release;
+                            active_right_record_buffer[record_index_2] =
+                                sample_mix(active_right_record_buffer[record_index_2],
+                                           right_record_feedback) *
+                                record_release;
+                            active_left_record_buffer[record_index_3] =
+                                sample_mix(active_left_record_buffer[record_index_3],
+                                           left_record_feedback) *
+                                record_release;
+                            active_right_record_buffer[record_index_3] =
+                                sample_mix(active_right_record_buffer[record_index_3],
+                                           right_record_feedback) *
+                                record_release;
+                            active_left_record_buffer[record_index_4] =
+                                sample_mix(active_left_record_buffer[record_index_4],
+                                           left_record_feedback) *
+                                record_release;
+                            active_right_record_buffer[record_index_4] =
+                                sample_mix(active_right_record_buffer[record_index_4],
+                                           right_record_feedback) *
+                                record_release;
+                        }
+                        else // if( num_records_to_write == 2 )
+                        {
+                            int record_index_2 = record_index + record_buffer_size * 2;
+                            if (record_index_2 >= real_record_buffer_size)
+                            {
+                                record_index_2 -= real_record_buffer_size;
+                            }
+
+                            active_left_record_buffer[record_index] =
+                                sample_mix(left_record, left_record_feedback) * record_release;
+                            active_right_record_buffer[record_index] =
+                                sample_mix(right_record, right_record_feedback) * record_release;
+                            active_left_record_buffer[record_index_2] =
+                                sample_mix(active_left_record_buffer[record_index_2],
+                                           left_record_feedback) *
+                                record_release;
+                            active_right_record_buffer[record_index_2] =
+                                sample_mix(active_right_record_buffer[record_index_2],
+                                           right_record_feedback) *
+                                record_release;
+                        }
+                    }
+                    else if (force_clear)
+                    {
+                        record_buffer.clear();
+                        active_left_record_buffer = record_buffer.getWritePointer(LEFT);
+                        active_right_record_buffer = record_buffer.getWritePointer(RIGHT);
+                        force_clear = false;
+                    }
+
+                    io_l[sid] = sample_mix(left_record, left_reflexion_and_input_mix);
+                    io_r[sid] = sample_mix(right_record, right_reflexion_and_input_mix);
+                }
+
+                // UPDATE INDEX
+                {
+                    reflexion_write_index =
+                        (reflexion_write_index + 1) % current_reflexion_buffer_size;
+                    record_index = (record_index + 1) % real_record_buffer_size;
+                }
+            }
+        }
+        else // NOTE just a reduced copy of the function before
+        {
+            for (int sid = 0; sid != num_samples_; ++sid)
+            {
+                // REFLEXION AND INPUT
+                const int reflexion_read_index = update_get_reflexion_read_index();
+                const float left_reflexion_and_input_mix =
+                    sample_mix(active_left_reflexion_buffer[reflexion_read_index], io_l[sid]);
+                {
+                    active_left_reflexion_buffer[reflexion_write_index] =
+                        left_reflexion_and_input_mix * smoothed_power_[sid];
+                }
+
+                // RECORD AND MIX BEFORE
+                {
+                    float record_power = 0;
+                    if (record_)
+                    {
+                        record_power = record_switch_smoother.glide_tick(true);
+                    }
+                    else if (!record_switch_smoother.is_up_to_date())
+                    {
+                        record_power = record_switch_smoother.tick();
+                    }
+
+                    const float left_record = active_left_record_buffer[record_index];
+                    if (record_power > 0)
+                    {
+                        const float record_release = record_release_buffer_[sid];
+                        const float left_record_feedback =
+                            left_reflexion_and_input_mix * record_power;
+                        if (num_records_to_write > 2)
+                        {
+                            active_left_record_buffer[record_index] =
+                                sample_mix(left_record, left_record_feedback) * record_release;
+                        }
+                        else if (num_records_to_write == 1)
+                        {
+                            const int record_index_1 = record_index;
+                            int record_index_2 = record_index_1 + record_buffer_size;
+                            if (record_index_2 >= real_record_buffer_size)
+                            {
+                                record_index_2 -= real_record_buffer_size;
+                            }
+                            int record_index_3 = record_index_2 + record_buffer_size;
+                            if (record_index_3 >= real_record_buffer_size)
+                            {
+                                record_index_3 -= real_record_buffer_size;
+                            }
+                            int record_index_4 = record_index_3 + record_buffer_size;
+                            if (record_index_4 >= real_record_buffer_size)
+                            {
+                                record_index_4 -= real_record_buffer_size;
+                            }
+
+                            active_left_record_buffer[record_index_1] =
+                                sample_mix(left_record, left_record_feedback) * record_release;
+                            active_left_record_buffer[record_index_2] =
+                                sample_mix(active_left_record_buffer[record_index_2],
+                                           left_record_feedback) *
+                                record_release;
+                            active_left_record_buffer[record_index_3] =
+                                sample_mix(active_left_record_buffer[record_index_3],
+                                           left_record_feedback) *
+                                record_release;
+                            active_left_record_buffer[record_index_4] =
+                                sample_mix(active_left_record_buffer[record_index_4],
+                                           left_record_feedback) *
+                                record_release;
+                        }
+                        else // if( num_records_to_write == 2 )
+                        {
+                            int record_index_2 = record_index + record_buffer_size * 2;
+                            if (record_index_2 >= real_record_buffer_size)
+                            {
+                                record_index_2 -= real_record_buffer_size;
+                            }
+
+                            active_left_record_buffer[record_index] =
+                                sample_mix(left_record, left_record_feedback) * record_release;
+                            active_left_record_buffer[record_index_2] =
+                                sample_mix(active_left_record_buffer[record_index_2],
+                                           left_record_feedback) *
+                                record_release;
+                        }
+                    }
+                    else if (force_clear)
+                    {
+                        record_buffer.clear();
+                        active_left_record_buffer = record_buffer.getWritePointer(LEFT);
+                        force_clear = false;
+                    }
+
+                    io_l[sid] = sample_mix(left_record, left_reflexion_and_input_mix);
+                }
+
+                // UPDATE INDEX
+                {
+                    reflexion_write_index =
+                        (reflexion_write_index + 1) % current_reflexion_buffer_size;
+                    record_index = (record_index + 1) % real_record_buffer_size;
+                }
+            }
+        }
+    }
+
+  public:
+    //==============================================================================
+    inline void reset() noexcept { sample_rate_or_block_changed(); }
+
+    //==============================================================================
+    inline void clear_record_buffer() noexcept
+    {
+        force_clear = true;
+        active_left_record_buffer = record_buffer.getWritePointer(LEFT);
+        active_right_record_buffer = record_buffer.getWritePointer(RIGHT);
+    }
+
+    inline int get_max_duration() const noexcept { return real_record_buffer_size; }
+    COLD std::size_t get_memory_usage() const noexcept
+    {
+        return reflexion_buffer.get_memory_usage() + record_buffer.get_memory_usage();
+    }
+
+  private:
+    //==============================================================================
+    COLD void sample_rate_or_block_changed() noexcept override
+    {
+        update_record_stuff(last_bmp_in);
+        update_reflexion_stuff(last_bmp_in);
+    }
+
+  public:
+    //==============================================================================
+    COLD mono_Delay(RuntimeNotifyer *notifyer_, MoniqueSynthData *synth_data_) noexcept
+        : RuntimeListener(notifyer_),
+
+          synth_data(synth_data_),
+
+          last_bmp_in(20),
+
+          reflexion_write_index(0), last_in_reflexion_size(0), reflexion(0), current_reflexion(0),
+          reflexion_buffer_size(1), current_reflexion_buffer_size(1),
+          reflexion_buffer(reflexion_buffer_size),
+          active_left_reflexion_buffer(reflexion_buffer.getWritePointer(LEFT)),
+          active_right_reflexion_buffer(reflexion_buffer.getWritePointer(RIGHT)),
+
+          record_index(0), last_in_record_size(0), record_buffer_size(1),
+          real_record_buffer_size(record_buffer_size), num_records_to_write(1),
+          record_buffer(real_record_buffer_size),
+          active_left_record_buffer(record_buffer.getWritePointer(LEFT)),
+          active_right_record_buffer(record_buffer.getWritePointer(RIGHT)), force_clear(false),
+
+          record_switch_smoother()
+    {
+        sample_rate_or_block_changed();
+        record_switch_smoother.set_value(0);
+    }
+    COLD ~mono_Delay() noexcept {}
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(mono_Delay)
+};
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+class CombFilter
+{
+    juce::HeapBlock<float> buffer;
+    float last;
+    int bufferSize, bufferIndex;
+
+  public:
+    //==============================================================================
+    inline float process(const float input, const float feedbackLevel) noexcept
+    {
+#define REVERB_DAMP 0
+        last = buffer[bufferIndex];
+        // last = (output * (1.0f - REVERB_DAMP)) + (last * REVERB_DAMP);
+        // JUCE_UNDENORMALISE (last);
+
+        float temp = input + (last * feedbackLevel);
+        JUCE_UNDENORMALISE(temp);
+        buffer[bufferIndex] = temp;
+        bufferIndex = (bufferIndex + 1) % bufferSize;
+
+        return last;
+    }
+    // process() FOR A BLOCK IN SPANS LIKE AllPassFilter::process_block, THE OUTPUTS ARE ADDED TO
+    // sum_
+    inline void process_block(const float *const in_, const float *const feedbacks_,
+                              float *const sum_, const int num_samples_) noexcept
+    {
+        for (int sid = 0; sid != num_samples_;)
+        {
+            const int span = juce::jmin(num_samples_ - sid, bufferSize - bufferIndex);
+            float *const line = buffer + bufferIndex;
+            const float *const in = in_ + sid;
+            const float *const feedbacks = feedbacks_ + sid;
+            float *const sum = sum_ + sid;
+            last = line[span - 1];
+            for (int i = 0; i != span; ++i)
+            {
+                const float delayed = line[i];
+                float temp = in[i] + (delayed * feedbacks[i]);
+                JUCE_UNDENORMALISE(temp);
+                line[i] = temp;
+                sum[i] += delayed;
+            }
+            bufferIndex = (bufferIndex + span) % bufferSize;
+            sid += span;
+        }
+    }
+
+    //==============================================================================
+    COLD void setSize(const int size)
+    {
+        if (size != bufferSize)
+        {
+            bufferIndex = 0;
+            buffer.malloc((size_t)size);
+            bufferSize = size;
+        }
+
+        clear();
+    }
+    COLD void clear() noexcept
+    {
+        last = 0;
+        buffer.clear((size_t)bufferSize);
+    }
+    COLD std::size_t get_memory_usage() const noexcept { return bufferSize * sizeof(float); }
+
+  public:
+    //==============================================================================
+    COLD CombFilter() noexcept : last(0), bufferSize(0), bufferIndex(0) {}
+    COLD ~CombFilter() noexcept {}
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(CombFilter)
+};
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+class LinearSmoothedValue
+{
+    float currentValue, target, step, lastValue;
+    int countdown, stepsToTarget;
+
+  public:
+    //==========================================================================
+    inline float getNextValue() noexcept
+    {
+        if (countdown <= 0)
+        {
+            lastValue = target;
+        }
+        else
+        {
+            --countdown;
+            currentValue += step;
+
+            lastValue = currentValue;
+        }
+
+        return lastValue;
+    }
+    //==========================================================================
+    inline float getLastValue() noexcept { return lastValue; }
+
+    inline void setValue(float newValue) noexcept
+    {
+        if (target != newValue)
+        {
+            target = newValue;
+            countdown = stepsToTarget;
+
+            if (countdown <= 0)
+            {
+                currentValue = target;
+            }
+            else
+            {
+                step = (target - currentValue) / countdown;
+            }
+        }
+    }
+
+    //==============================================================================
+    COLD void reset(float sampleRate, float fadeLengthSeconds) noexcept
+    {
+        stepsToTarget = std::floor(fadeLengthSeconds * sampleRate);
+        currentValue = target;
+        countdown = 0;
+    }
+
+  public:
+    //==============================================================================
+    COLD LinearSmoothedValue() noexcept
+        : currentValue(0), target(0), step(0), lastValue(0), countdown(0), stepsToTarget(0)
+    {
+    }
+
+    COLD ~LinearSmoothedValue() noexcept {}
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(LinearSmoothedValue)
+};
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+class mono_Reverb;
+struct ReverbParameters
+{
+    float roomSize; /**< Room size, 0 to 1.0, where 1.0 is big, 0 is small. */
+    float wetLevel; /**< Wet level, 0 to 1.0 */
+    float dryLevel; /**< Dry level, 0 to 1.0 */
+    float width;    /**< mono_Reverb width, 0 to 1.0, where 1.0 is very wide. */
+
+  private:
+    //==============================================================================
+    friend class mono_Reverb;
+    COLD ReverbParameters() noexcept : roomSize(0.5f), wetLevel(0.33f), dryLevel(0.4f), width(1.0f)
+    {
+    }
+    COLD ~ReverbParameters() noexcept {}
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ReverbParameters)
+};
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+class mono_Reverb : RuntimeListener
+{
+    const bool left_or_right;
+
+    enum
+    {
+        numCombs = 8,
+        numAllPasses = 4
+    };
+
+    CombFilter comb[numCombs];
+    AllPassFilter allPass[numAllPasses];
+
+    ReverbParameters parameters;
+#define REVERB_GAIN 0.013f
+
+    float wetGain1, wetGain2, feedback; // dryGain,  feedback
+
+    TailBypass tail;
+    int tail_samples; // THE LONGEST COMB AND ALL ALLPASSES
+
+  public:
+    //==========================================================================
+    inline float processSingleSampleRaw(float in) noexcept
+    {
+        float out = 0;
+        {
+            const float input = in * REVERB_GAIN;
+            for (int j = 0; j != numCombs; ++j) // accumulate the comb filters in parallel
+            {
+                out += comb[j].process(input, feedback);
+            }
+        }
+        for (int j = 0; j != numAllPasses; ++j) // run the allpass filters in series
+        {
+            out = allPass[j].process(out);
+        }
+
+        return out * wetGain1 + out * wetGain2 + in * parameters.dryLevel;
+    }
+
+    //==========================================================================
+    inline ReverbParameters &get_parameters() noexcept { return parameters; }
+    inline void update_parameters() noexcept
+    {
+#define ROOM_SCALE 1.0f
+#define WET_SCALE_FACTOR 3.0f
+#define DRY_SCALE_FACTOR 1.0f
+#define ROOM_SCALE_FACTOR (0.28f * ROOM_SCALE)
+#define ROOM_OFFSET (1.0f - 0.28f * ROOM_SCALE - 0.02f)
+        const float wet = parameters.wetLevel * WET_SCALE_FACTOR;
+        // dryGain.setValue (parameters.dryLevel * DRY_SCALE_FACTOR);
+        wetGain1 = 0.5f * wet * (1.0f + parameters.width);
+        wetGain2 = 0.5f * wet * (1.0f - parameters.width);
+        feedback = parameters.roomSize * ROOM_SCALE_FACTOR + ROOM_OFFSET;
+    }
+
+    //==========================================================================
+    // THE PARAMETERS OF update_parameters() FOR EVERY SAMPLE OF A BLOCK, ONCE FOR LEFT AND RIGHT
+    static inline void calc_block_parameters(const float *const rooms_,
+                                             const float *const dry_wet_mixes_,
+                                             const float *const widths_,
+                                             mono_ArenaBuffer<SUM_REVERB_BUFFERS> &buffers_,
+                                             const int num_samples_) noexcept
+    {
+        float *const feedbacks = buffers_.getWritePointer(REVERB_FEEDBACK);
+        float *const wet_gains_1 = buffers_.getWritePointer(REVERB_WET_GAIN_1);
+        float *const wet_gains_2 = buffers_.getWritePointer(REVERB_WET_GAIN_2);
+        float *const dry_levels = buffers_.getWritePointer(REVERB_DRY_LEVEL);
+        for (int sid = 0; sid != num_samples_; ++sid)
+        {
+            const float dry_level = 1.0f - dry_wet_mixes_[sid];
+            const float wet = (1.0f - dry_level) * WET_SCALE_FACTOR;
+            wet_gains_1[sid] = 0.5f * wet * (1.0f + widths_[sid]);
+            wet_gains_2[sid] = 0.5f * wet * (1.0f - widths_[sid]);
+            dry_levels[sid] = dry_level;
+            feedbacks[sid] = rooms_[sid] * ROOM_SCALE_FACTOR + ROOM_OFFSET;
+        }
+    }
+    // processSingleSampleRaw FOR A BLOCK WITH THE PARAMETERS OF calc_block_parameters, COMB BY COMB
+    // AND ALLPASS BY ALLPASS INSTEAD OF SAMPLE BY SAMPLE. out_ CAN NOT BE in_
+    inline void process_block(const float *const in_, float *const out_,
+                              mono_ArenaBuffer<SUM_REVERB_BUFFERS> &buffers_,
+                              const int num_samples_) noexcept
+    {
+        const float *const dry_levels = buffers_.getReadPointer(REVERB_DRY_LEVEL);
+
+        // WITHOUT INPUT AND A DECAYED TAIL ONLY THE DRY PART IS LEFT
+        const bool input_is_silent = is_silent_block(in_, num_samples_);
+        if (tail.can_skip(input_is_silent))
+        {
+            for (int sid = 0; sid != num_samples_; ++sid)
+            {
+                out_[sid] = in_[sid] * dry_levels[sid];
+            }
+            return;
+        }
+
+        float *const input = buffers_.getWritePointer(REVERB_INPUT);
+        for (int sid = 0; sid != num_samples_; ++sid)
+        {
+            input[sid] = in_[sid] * REVERB_GAIN;
+            out_[sid] = 0;
+        }
+
+        const float *const feedbacks = buffers_.getReadPointer(REVERB_FEEDBACK);
+        for (int j = 0; j != numCombs; ++j) // accumulate the comb filters in parallel
+        {
+            comb[j].process_block(input, feedbacks, out_, num_samples_);
+        }
+        for (int j = 0; j != numAllPasses; ++j) // run the allpass filters in series
+        {
+            allPass[j].process_block(out_, num_samples_);
+        }
+        // THE WET SIGNAL BEFORE ITS GAIN, A MUTED TAIL COULD STILL BE TURNED UP
+        if (tail.settle(input_is_silent, is_silent_block(out_, num_samples_), tail_samples,
+                        num_samples_))
+        {
+            reset();
+        }
+
+        const float *const wet_gains_1 = buffers_.getReadPointer(REVERB_WET_GAIN_1);
+        const float *const wet_gains_2 = buffers_.getReadPointer(REVERB_WET_GAIN_2);
+        for (int sid = 0; sid != num_samples_; ++sid)
+        {
+            const float out = out_[sid];
+            out_[sid] =
+                out * wet_gains_1[sid] + out * wet_gains_2[sid] + in_[sid] * dry_levels[sid];
+        }
+    }
+
+    //==============================================================================
+    COLD void sample_rate_or_block_changed() noexcept override
+    {
+        static const int combTunings[] = {1116, 1188, 1277, 1356,
+                                          1422, 1491, 1557, 1617}; // (at 44100Hz)
+        static const int allPassTunings[] = {556, 441, 341, 225};
+        const int stereoSpread = 23;
+        const int intSampleRate = (int)sample_rate;
+
+        tail_samples = (intSampleRate * (combTunings[numCombs - 1] + stereoSpread)) / 44100;
+        for (int i = 0; i < numAllPasses; ++i)
+        {
+            tail_samples += (intSampleRate * (allPassTunings[i] + stereoSpread)) / 44100;
+        }
+
+        for (int i = 0; i < numCombs; ++i)
+        {
+            if (left_or_right == LEFT)
+            {
+                comb[i].setSize((intSampleRate * combTunings[i] * ROOM_SCALE) / 44100);
+            }
+            else
+            {
+                comb[i].setSize(
+                    (intSampleRate * (combTunings[i] * ROOM_SCALE + stereoSpread * ROOM_SCALE)) /
+                    44100);
+            }
+        }
+        for (int i = 0; i < numAllPasses; ++i)
+        {
+            if (left_or_right == LEFT)
+            {
+                allPass[i].setSize((intSampleRate * allPassTunings[i] * ROOM_SCALE) / 44100);
+            }
+            else
+            {
+                allPass[i].setSize(
+                    (intSampleRate * (allPassTunings[i] * ROOM_SCALE + stereoSpread * ROOM_SCALE)) /
+                    44100);
+            }
+        }
+    }
+    COLD void reset() noexcept
+    {
+        for (int i = 0; i < numCombs; ++i)
+        {
+            comb[i].clear();
+        }
+
+        for (int i = 0; i < numAllPasses; ++i)
+        {
+            allPass[i].clear();
+        }
+    }
+    COLD std::size_t get_memory_usage() const noexcept
+    {
+        std::size_t bytes = 0;
+        for (int i = 0; i < numCombs; ++i)
+        {
+            bytes += comb[i].get_memory_usage();
+        }
+        for (int i = 0; i < numAllPasses; ++i)
+        {
+            bytes += allPass[i].get_memory_usage();
+        }
+        return bytes;
+    }
+
+  public:
+    //==========================================================================
+    COLD mono_Reverb(RuntimeNotifyer *const notifyer_, bool left_or_right_) noexcept
+        : RuntimeListener(notifyer_), left_or_right(left_or_right_), wetGain1(0), wetGain2(0),
+          feedback(0), tail_samples(0)
+    {
+        update_parameters();
+        sample_rate_or_block_changed();
+    }
+    COLD ~mono_Reverb() noexcept {}
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(mono_Reverb)
+};
+
+#endif
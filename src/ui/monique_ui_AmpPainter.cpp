@@ -192,6 +192,7 @@ Monique_Ui_AmpPainter::~Monique_Ui_AmpPainter()
 //==============================================================================
 void Monique_Ui_AmpPainter::paint(juce::Graphics &g)
 {
+    MONIQUE_UI_PROFILE_SCOPE(profiler, "AmpPainter::paint");
     // TODO paint all or only values
     if (!is_currently_painting)
     {
@@ -635,6 +636,7 @@ void Monique_Ui_AmpPainter::buttonClicked(juce::Button *buttonThatWasClicked)
 //==============================================================================
 void Monique_Ui_AmpPainter::timerCallback()
 {
+    MONIQUE_UI_PROFILE_SCOPE(profiler, "AmpPainter::timerCallback");
     repaint(drawing_area->getBounds());
     refresh_buttons();
 }
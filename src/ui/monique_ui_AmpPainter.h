@@ -217,6 +217,10 @@ class Monique_Ui_AmpPainter : public juce::Timer,
     inline void add_osc(int id_, const float *values_, int num_samples_) noexcept;
     inline void clear_and_keep_minimum() noexcept;
 
+#if MONIQUE_UI_PROFILING
+    UiRefreshProfiler *profiler = nullptr; // SET BY THE MAINWINDOW
+#endif
+
   private:
     void timerCallback() override;
 
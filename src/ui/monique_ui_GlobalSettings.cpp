@@ -127,6 +127,28 @@ void Monique_Ui_GlobalSettings::refresh() noexcept
             label_buttons__->repaint();
         }
     }
+
+#if MONIQUE_STAGE_TIMING
+    // STAGE TIMINGS
+    {
+        // ABSOLUTE TIMES PER BLOCK, THE LOAD IS THEIR SUM OVER THE BLOCK DURATION
+        const StageTimings &stage_timings = synth_data->runtime_info->stage_timings;
+        float sum_us = 0;
+        juce::String stages;
+        for (int i = 0; i != SUM_TIMING_STAGES; ++i)
+        {
+            const float us = stage_timings.get_us(i);
+            sum_us += us;
+            stages << StageTimings::get_stage_name(i) << ": " << juce::String(us, 1) << "us\n";
+        }
+        const float block_us = stage_timings.get_block_us();
+        const float sum_percent = block_us > 0 ? sum_us / block_us * 100 : 0;
+        label_cpu_stages->setText(stages, juce::dontSendNotification);
+        label_cpu_usage->setText(
+            juce::String(cpu_usage_smoother.add_and_get_average(sum_percent)) + "%",
+            juce::dontSendNotification);
+    }
+#endif
 }
 
 void Monique_Ui_GlobalSettings::open_colour_selector(COLOUR_CODES code_)
@@ -337,6 +359,17 @@ Monique_Ui_GlobalSettings::Monique_Ui_GlobalSettings(Monique_Ui_Refresher *ui_re
     label_cpu_usage->setColour(juce::TextEditor::textColourId, juce::Colour(0xffff3b00));
     label_cpu_usage->setColour(juce::TextEditor::backgroundColourId, juce::Colour(0x00000000));
 
+#if MONIQUE_STAGE_TIMING
+    label_cpu_stages = std::make_unique<juce::Label>(juce::String(), juce::String());
+    addAndMakeVisible(*label_cpu_stages);
+    label_cpu_stages->setFont(juce::Font(11.00f, juce::Font::plain));
+    label_cpu_stages->setJustificationType(juce::Justification::topLeft);
+    label_cpu_stages->setEditable(false, false, false);
+    label_cpu_stages->setColour(juce::Label::textColourId, juce::Colour(0xffff3b00));
+    label_cpu_stages->setColour(juce::TextEditor::textColourId, juce::Colour(0xffff3b00));
+    label_cpu_stages->setColour(juce::TextEditor::backgroundColourId, juce::Colour(0x00000000));
+#endif
+
     label_16 = std::make_unique<juce::Label>(juce::String(), TRANS("ANI-ENV\'S"));
     addAndMakeVisible(*label_16);
     label_16->setTooltip(TRANS("Turn amp animations on buttons on or off."));
@@ -787,8 +820,17 @@ Monique_Ui_GlobalSettings::Monique_Ui_GlobalSettings(Monique_Ui_Refresher *ui_re
                                          juce::dontSendNotification);
         }
 
+#if MONIQUE_STAGE_TIMING
+        // THE TIMINGS TAKE THE PLACE OF THE CREDITS
+        label_ui_headline_3->setVisible(false);
+        label_ui_headline_7->setVisible(false);
+        label_ui_headline_9->setVisible(false);
+        credits_poper->setVisible(false);
+        image_vst->setVisible(false);
+#else
         label_2->setVisible(false);
         label_cpu_usage->setVisible(false);
+#endif
 
         label_ui_headline_6->setText(juce::String("MONIQUE ") +
                                          juce::String(ProjectInfo::versionString),
@@ -888,6 +930,9 @@ Monique_Ui_GlobalSettings::~Monique_Ui_GlobalSettings()
     label_section__ = nullptr;
     label_2 = nullptr;
     label_cpu_usage = nullptr;
+#if MONIQUE_STAGE_TIMING
+    label_cpu_stages = nullptr;
+#endif
     label_16 = nullptr;
     toggle_animate_input_env = nullptr;
     label_18 = nullptr;
@@ -989,6 +1034,9 @@ void Monique_Ui_GlobalSettings::resized()
     label_section__->setBounds(450, 40, 80, 30);
     label_2->setBounds(1295, 90, 60, 30);
     label_cpu_usage->setBounds(1355, 90, 80, 33);
+#if MONIQUE_STAGE_TIMING
+    label_cpu_stages->setBounds(1150, 32, 145, 148);
+#endif
     label_16->setBounds(60, 50, 100, 30);
     toggle_animate_input_env->setBounds(30, 50, 33, 30);
     label_18->setBounds(60, 130, 100, 30);
@@ -124,6 +124,9 @@ class Monique_Ui_GlobalSettings : public juce::Component,
     std::unique_ptr<juce::Label> label_section__;
     std::unique_ptr<juce::Label> label_2;
     std::unique_ptr<juce::Label> label_cpu_usage;
+#if MONIQUE_STAGE_TIMING
+    std::unique_ptr<juce::Label> label_cpu_stages;
+#endif
     std::unique_ptr<juce::Label> label_16;
     std::unique_ptr<juce::ToggleButton> toggle_animate_input_env;
     std::unique_ptr<juce::Label> label_18;
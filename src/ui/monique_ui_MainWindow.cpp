@@ -30,6 +30,7 @@
 #include "monique_ui_Morph.h"
 #include "monique_ui_OptionPopup.h"
 #include "monique_ui_Overlay.h"
+#include "monique_ui_ProfilerOverlay.h"
 #include "monique_ui_Playback.h"
 #include "monique_ui_SegmentedMeter.h"
 #include "monique_ui_SliderConfig.h"
@@ -111,11 +112,26 @@ void Monique_Ui_Mainwindow::refresh() noexcept
         combo_programm->setEditableText(false);
     }
 
-    show_current_voice_data();
-    show_current_poly_data();
-    resize_sequence_buttons();
-    show_programs_and_select(false);
-    show_ctrl_state();
+    {
+        MONIQUE_UI_PROFILE_SCOPE(&ui_refresher->profiler, "Mainwindow::show_current_voice_data");
+        show_current_voice_data();
+    }
+    {
+        MONIQUE_UI_PROFILE_SCOPE(&ui_refresher->profiler, "Mainwindow::show_current_poly_data");
+        show_current_poly_data();
+    }
+    {
+        MONIQUE_UI_PROFILE_SCOPE(&ui_refresher->profiler, "Mainwindow::resize_sequence_buttons");
+        resize_sequence_buttons();
+    }
+    {
+        MONIQUE_UI_PROFILE_SCOPE(&ui_refresher->profiler, "Mainwindow::show_programs_and_select");
+        show_programs_and_select(false);
+    }
+    {
+        MONIQUE_UI_PROFILE_SCOPE(&ui_refresher->profiler, "Mainwindow::show_ctrl_state");
+        show_ctrl_state();
+    }
 }
 void Monique_Ui_Mainwindow::update_tooltip_handling(bool is_help_key_down_) noexcept
 {
@@ -5977,6 +5993,9 @@ void Monique_Ui_Mainwindow::buttonClicked(juce::Button *buttonThatWasClicked)
             close_all_subeditors();
 
             amp_painter = new Monique_Ui_AmpPainter(synth_data, look_and_feel);
+#if MONIQUE_UI_PROFILING
+            amp_painter->profiler = &ui_refresher->profiler;
+#endif
 
             addChildComponent(amp_painter);
             resize_subeditors();
@@ -6580,6 +6599,25 @@ bool Monique_Ui_Mainwindow::keyPressed(const juce::KeyPress &key)
         credits->setAlwaysOnTop(credits->isVisible());
         success = true;
     }
+#if MONIQUE_UI_PROFILING
+    else if (key.getTextDescription() == "ctrl + P")
+    {
+        if (!profiler_overlay)
+        {
+            profiler_overlay = std::make_unique<Monique_Ui_ProfilerOverlay>(ui_refresher->profiler);
+            addChildComponent(*profiler_overlay);
+        }
+        profiler_overlay->setTopLeftPosition(20, 20);
+        profiler_overlay->setVisible(!profiler_overlay->isVisible());
+        profiler_overlay->setAlwaysOnTop(profiler_overlay->isVisible());
+        success = true;
+    }
+    else if (key.getTextDescription() == "ctrl + shift + P")
+    {
+        ui_refresher->profiler.dump();
+        success = true;
+    }
+#endif
     else if (key.getTextDescription() == "ctrl + M")
     {
         midi_control_handler->toggle_midi_learn();
@@ -45,6 +45,7 @@ struct ModulationSliderConfigBase;
 
 class monique_ui_Overlay;
 class monique_ui_Credits;
+class Monique_Ui_ProfilerOverlay;
 
 struct ENVData;
 struct LFOData;
@@ -106,6 +107,9 @@ class Monique_Ui_Mainwindow : public juce::AudioProcessorEditor,
     std::unique_ptr<Monique_Ui_Playback> playback;
     Monique_Ui_AmpPainter *amp_painter;
     std::unique_ptr<Monique_Ui_Info> vers_info;
+#if MONIQUE_UI_PROFILING
+    std::unique_ptr<Monique_Ui_ProfilerOverlay> profiler_overlay;
+#endif
 
     void refresh() noexcept override;
     void update_tooltip_handling(bool is_help_key_down_) noexcept;
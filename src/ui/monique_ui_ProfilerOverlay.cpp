@@ -0,0 +1,57 @@
+/*
+** Monique is Free and Open Source Software
+**
+** Monique is made available under the Gnu General Public License, v3.0
+** https://www.gnu.org/licenses/gpl-3.0.en.html; The authors of the code
+** reserve the right to re-license their contributions under the MIT license in the
+** future at the discretion of the project maintainers.
+**
+** Copyright 2016-2022 by various individuals as described by the git transaction log
+**
+** All source at: https://github.com/surge-synthesizer/monique-monosynth.git
+**
+** Monique was a commercial product from 2016-2021, with copyright and ownership
+** in that period held by Thomas Arndt at Monoplugs. Thomas made Monique
+** open source in December 2021.
+*/
+
+#include "monique_ui_ProfilerOverlay.h"
+
+#if MONIQUE_UI_PROFILING
+//==============================================================================
+COLD Monique_Ui_ProfilerOverlay::Monique_Ui_ProfilerOverlay(UiRefreshProfiler &profiler_) noexcept
+    : profiler(profiler_)
+{
+    setInterceptsMouseClicks(true, false);
+    setSize(560, 420);
+}
+COLD Monique_Ui_ProfilerOverlay::~Monique_Ui_ProfilerOverlay() noexcept { stopTimer(); }
+
+//==============================================================================
+void Monique_Ui_ProfilerOverlay::timerCallback()
+{
+    report = profiler.get_report(24);
+    repaint();
+}
+void Monique_Ui_ProfilerOverlay::visibilityChanged()
+{
+    if (isVisible())
+    {
+        timerCallback();
+        startTimer(500);
+    }
+    else
+    {
+        stopTimer();
+    }
+}
+void Monique_Ui_ProfilerOverlay::paint(juce::Graphics &g)
+{
+    g.fillAll(juce::Colour(0xdd161616));
+
+    g.setColour(juce::Colours::white);
+    g.setFont(juce::Font(juce::Font::getDefaultMonospacedFontName(), 12, juce::Font::plain));
+    g.drawMultiLineText("UI REFRESH PROFILE (CTRL+SHIFT+P DUMPS TO FILE)\n\n" + report, 8, 16,
+                        getWidth() - 16);
+}
+#endif
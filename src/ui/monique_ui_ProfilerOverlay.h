@@ -0,0 +1,44 @@
+/*
+** Monique is Free and Open Source Software
+**
+** Monique is made available under the Gnu General Public License, v3.0
+** https://www.gnu.org/licenses/gpl-3.0.en.html; The authors of the code
+** reserve the right to re-license their contributions under the MIT license in the
+** future at the discretion of the project maintainers.
+**
+** Copyright 2016-2022 by various individuals as described by the git transaction log
+**
+** All source at: https://github.com/surge-synthesizer/monique-monosynth.git
+**
+** Monique was a commercial product from 2016-2021, with copyright and ownership
+** in that period held by Thomas Arndt at Monoplugs. Thomas made Monique
+** open source in December 2021.
+*/
+
+#ifndef MONIQUE_UI_PROFILEROVERLAY_H_INCLUDED
+#define MONIQUE_UI_PROFILEROVERLAY_H_INCLUDED
+
+#include "App.h"
+
+#if MONIQUE_UI_PROFILING
+//==============================================================================
+// SHOWS THE SLOWEST REFRESHABLES ON TOP OF THE EDITOR, CLICK TO HIDE
+class Monique_Ui_ProfilerOverlay : public juce::Component, public juce::Timer
+{
+    UiRefreshProfiler &profiler;
+    juce::String report;
+
+    void timerCallback() override;
+    void paint(juce::Graphics &g) override;
+    void mouseDown(const juce::MouseEvent &) override { setVisible(false); }
+    void visibilityChanged() override;
+
+  public:
+    COLD Monique_Ui_ProfilerOverlay(UiRefreshProfiler &profiler_) noexcept;
+    COLD ~Monique_Ui_ProfilerOverlay() noexcept;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(Monique_Ui_ProfilerOverlay)
+};
+#endif
+
+#endif // MONIQUE_UI_PROFILEROVERLAY_H_INCLUDED
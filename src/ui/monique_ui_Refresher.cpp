@@ -17,6 +17,16 @@
 
 #include "monique_ui_Refresher.h"
 
+#if MONIQUE_UI_PROFILING
+#include "monique_ui_MainWindow.h"
+
+#include <algorithm>
+#include <typeinfo>
+#if !JUCE_MSVC
+#include <cxxabi.h>
+#endif
+#endif
+
 //==============================================================================
 
 Monique_Ui_Refresher::~Monique_Ui_Refresher() noexcept {}
@@ -24,11 +34,36 @@ Monique_Ui_Refresher::~Monique_Ui_Refresher() noexcept {}
 //==============================================================================
 void Monique_Ui_Refresher::timerCallback()
 {
+#if MONIQUE_UI_PROFILING
+    const std::int64_t start_ticks = juce::Time::getHighResolutionTicks();
+    for (int i = 0; i != refreshables.size(); ++i)
+    {
+        Monique_Ui_Refreshable *const refreshable = refreshables.getUnchecked(i);
+        profiler.add_refreshable(refreshable);
+        {
+            const std::int64_t refresh_start_ticks = juce::Time::getHighResolutionTicks();
+            refreshable->refresh();
+            profiler.add(refreshable, nullptr, refresh_start_ticks);
+        }
+    }
+    const std::int64_t refreshed_ticks = juce::Time::getHighResolutionTicks();
+
+    // PAINT WHAT THE REFRESH INVALIDATED NOW, OTHERWISE IT IS NOT PART OF THE FRAME
+    if (editor)
+    {
+        if (juce::ComponentPeer *const peer = editor->getPeer())
+        {
+            peer->performAnyPendingRepaintsNow();
+        }
+    }
+    profiler.add_frame(start_ticks, refreshed_ticks, juce::Time::getHighResolutionTicks());
+#else
     // MessageManagerLock mmLock;
     for (int i = 0; i != refreshables.size(); ++i)
     {
         refreshables.getUnchecked(i)->refresh();
     }
+#endif
 }
 
 void Monique_Ui_Refresher::add(Monique_Ui_Refreshable *const r_) noexcept
@@ -43,6 +78,9 @@ void Monique_Ui_Refresher::remove(Monique_Ui_Refreshable *const r_) noexcept
         juce::ScopedLock locked(lock);
         refreshables.removeFirstMatchingValue(r_);
     }
+#if MONIQUE_UI_PROFILING
+    profiler.forget(r_);
+#endif
 }
 void Monique_Ui_Refresher::remove_all() noexcept
 {
@@ -64,3 +102,124 @@ Monique_Ui_Mainwindow *Monique_Ui_Refreshable::get_editor() noexcept
 {
     return ui_refresher->editor;
 }
+
+#if MONIQUE_UI_PROFILING
+//==============================================================================
+//==============================================================================
+//==============================================================================
+COLD UiRefreshProfiler::UiRefreshProfiler() noexcept
+    : ticks_to_us(1e6 / double(juce::Time::getHighResolutionTicksPerSecond()))
+{
+    frame_refresh.name = "FRAME REFRESH";
+    frame_repaint.name = "FRAME REPAINT";
+}
+COLD UiRefreshProfiler::~UiRefreshProfiler() noexcept {}
+
+//==============================================================================
+void UiRefreshProfiler::Entry::add(double us_) noexcept
+{
+    last_us = us_;
+    smoothed_us = calls == 0 ? us_ : smoothed_us * 0.95 + us_ * 0.05;
+    peak_us = juce::jmax(peak_us, us_);
+    sum_us += us_;
+    ++calls;
+}
+
+void UiRefreshProfiler::add(const void *owner_, const char *name_,
+                            std::int64_t start_ticks_) noexcept
+{
+    Entry &entry = entries[std::make_pair(owner_, name_)];
+    if (entry.name.isEmpty())
+    {
+        entry.name = name_ ? name_ : "?";
+    }
+    entry.add((juce::Time::getHighResolutionTicks() - start_ticks_) * ticks_to_us);
+}
+void UiRefreshProfiler::add_refreshable(Monique_Ui_Refreshable *refreshable_) noexcept
+{
+    Entry &entry = entries[std::make_pair(static_cast<const void *>(refreshable_), nullptr)];
+    if (entry.name.isNotEmpty())
+    {
+        return;
+    }
+
+    // CLASS NAME AND COMPONENT NAME OR POSITION, ONLY ON THE FIRST CALL
+    const char *const mangled = typeid(*refreshable_).name();
+#if JUCE_MSVC
+    entry.name = juce::String(mangled).fromFirstOccurrenceOf(" ", false, false);
+#else
+    int status = 0;
+    char *const demangled = abi::__cxa_demangle(mangled, nullptr, nullptr, &status);
+    entry.name = status == 0 && demangled ? demangled : mangled;
+    std::free(demangled);
+#endif
+    if (juce::Component *const component = dynamic_cast<juce::Component *>(refreshable_))
+    {
+        if (component->getName().isNotEmpty())
+        {
+            entry.name << " " << component->getName();
+        }
+        else
+        {
+            entry.name << " @" << component->getX() << "," << component->getY();
+        }
+    }
+}
+void UiRefreshProfiler::add_frame(std::int64_t start_ticks_, std::int64_t refreshed_ticks_,
+                                  std::int64_t end_ticks_) noexcept
+{
+    frame_refresh.add((refreshed_ticks_ - start_ticks_) * ticks_to_us);
+    frame_repaint.add((end_ticks_ - refreshed_ticks_) * ticks_to_us);
+}
+void UiRefreshProfiler::forget(const void *owner_) noexcept
+{
+    for (auto entry = entries.begin(); entry != entries.end();)
+    {
+        entry = entry->first.first == owner_ ? entries.erase(entry) : std::next(entry);
+    }
+}
+void UiRefreshProfiler::reset() noexcept
+{
+    entries.clear();
+    frame_refresh = Entry{"FRAME REFRESH"};
+    frame_repaint = Entry{"FRAME REPAINT"};
+}
+
+//==============================================================================
+juce::String UiRefreshProfiler::get_report(int top_n_) const noexcept
+{
+    auto line = [](const Entry &entry_) {
+        return juce::String(entry_.smoothed_us, 1).paddedLeft(' ', 10) +
+               juce::String(entry_.peak_us, 1).paddedLeft(' ', 10) +
+               juce::String(entry_.calls > 0 ? entry_.sum_us / entry_.calls : 0, 1)
+                   .paddedLeft(' ', 10) +
+               juce::String(entry_.calls).paddedLeft(' ', 9) + "  " + entry_.name + "\n";
+    };
+
+    // THE SLOWEST BY THE ROLLING AVERAGE
+    juce::Array<const Entry *> sorted;
+    for (const auto &entry : entries)
+    {
+        sorted.add(&entry.second);
+    }
+    std::sort(sorted.begin(), sorted.end(), [](const Entry *a_, const Entry *b_) {
+        return a_->smoothed_us > b_->smoothed_us;
+    });
+
+    juce::String report;
+    report << "    avg us   peak us   mean us    calls  NAME\n";
+    report << line(frame_refresh) << line(frame_repaint) << "\n";
+    for (int i = 0; i < sorted.size() && i < top_n_; ++i)
+    {
+        report << line(*sorted.getUnchecked(i));
+    }
+    return report;
+}
+bool UiRefreshProfiler::dump() const noexcept
+{
+    juce::File file(GET_ROOT_FOLDER().getFullPathName() + PROJECT_FOLDER + "ui-profile.txt");
+    file.getParentDirectory().createDirectory();
+    return file.replaceWithText(juce::Time::getCurrentTime().toString(true, true) + "\n" +
+                                get_report(int(entries.size())));
+}
+#endif
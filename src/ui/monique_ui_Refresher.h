@@ -20,15 +20,97 @@
 
 #include "App.h"
 
+#if MONIQUE_UI_PROFILING
+#include <map>
+#endif
+
 //==============================================================================
 class MoniqueAudioProcessor;
 class Monique_Ui_Refresher;
+class Monique_Ui_Refreshable;
 class UiLookAndFeel;
 class MIDIControlHandler;
 struct MoniqueSynthData;
 class Monique_Ui_Mainwindow;
 class MoniqueSynthesiserVoice;
 
+#ifndef MONIQUE_UI_PROFILING
+#define MONIQUE_UI_PROFILING 0
+#endif
+
+#if MONIQUE_UI_PROFILING
+//==============================================================================
+// MESSAGE THREAD TIME OF THE EDITOR, PER REFRESHABLE AND PER NAMED SCOPE
+class UiRefreshProfiler
+{
+  public:
+    struct Entry
+    {
+        juce::String name;
+        double last_us = 0;
+        double smoothed_us = 0;
+        double peak_us = 0;
+        double sum_us = 0;
+        std::int64_t calls = 0;
+
+        void add(double us_) noexcept;
+    };
+
+    // TIMES ITS LIFETIME, USE MONIQUE_UI_PROFILE_SCOPE
+    class Scope
+    {
+        UiRefreshProfiler *const profiler;
+        const void *const owner;
+        const char *const name;
+        const std::int64_t start_ticks;
+
+      public:
+        Scope(UiRefreshProfiler *profiler_, const void *owner_, const char *name_) noexcept
+            : profiler(profiler_), owner(owner_), name(name_),
+              start_ticks(juce::Time::getHighResolutionTicks())
+        {
+        }
+        ~Scope() noexcept
+        {
+            if (profiler)
+            {
+                profiler->add(owner, name, start_ticks);
+            }
+        }
+
+        JUCE_DECLARE_NON_COPYABLE(Scope)
+    };
+
+  private:
+    // REFRESHABLES ARE KEYED WITH A NULL NAME
+    std::map<std::pair<const void *, const char *>, Entry> entries;
+    Entry frame_refresh;
+    Entry frame_repaint;
+    const double ticks_to_us;
+
+  public:
+    void add(const void *owner_, const char *name_, std::int64_t start_ticks_) noexcept;
+    void add_refreshable(Monique_Ui_Refreshable *refreshable_) noexcept;
+    void add_frame(std::int64_t start_ticks_, std::int64_t refreshed_ticks_,
+                   std::int64_t end_ticks_) noexcept;
+    void forget(const void *owner_) noexcept;
+    void reset() noexcept;
+
+    juce::String get_report(int top_n_) const noexcept;
+    bool dump() const noexcept;
+
+    COLD UiRefreshProfiler() noexcept;
+    COLD ~UiRefreshProfiler() noexcept;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(UiRefreshProfiler)
+};
+#define MONIQUE_UI_PROFILE_SCOPE(profiler_, name_)                                                 \
+    UiRefreshProfiler::Scope ui_profile_scope(profiler_, this, name_)
+#else
+#define MONIQUE_UI_PROFILE_SCOPE(profiler_, name_)
+#endif
+
+//==============================================================================
 class Monique_Ui_Refreshable
 {
   protected:
@@ -73,6 +155,10 @@ class Monique_Ui_Refresher : public juce::Timer
     void pause() noexcept { stopTimer(); }
     void go_on() noexcept { startTimer(UI_REFRESH_RATE); }
 
+#if MONIQUE_UI_PROFILING
+    UiRefreshProfiler profiler;
+#endif
+
   private:
     //==========================================================================
     friend class Monique_Ui_Refreshable;
@@ -114,6 +114,7 @@ void Monique_Ui_SegmentedMeter::moved() { needsRepaint = true; }
 
 void Monique_Ui_SegmentedMeter::paint(juce::Graphics &g)
 {
+    MONIQUE_UI_PROFILE_SCOPE(&ui_refresher->profiler, "SegmentedMeter::paint");
     {
         const SectionTheme &theme = look_and_feel->colours.get_theme(COLOUR_THEMES::MASTER_THEME);
         if (my_red != theme.oszi_3 || my_yellow != theme.oszi_2 || my_green != theme.oszi_1 ||